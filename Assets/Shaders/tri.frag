@@ -5,6 +5,7 @@
 layout (push_constant) uniform PushConstants
 {
 	int textureIdx;
+	int transformBufferIdx;
 	int transformDataIdx;
 } pushConstants;
 
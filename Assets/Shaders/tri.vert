@@ -1,14 +1,15 @@
 #version 450
 #extension GL_EXT_nonuniform_qualifier : enable
 
-layout (set = 0, binding = 4) uniform TransformData
+layout (set = 0, binding = 5) readonly buffer TransformData
 {
-	mat4 modelViewProj;
+	mat4 modelViewProj[];
 } transformData[];
 
 layout (push_constant) uniform PushConstants
 {
 	int textureIdx;
+	int transformBufferIdx;
 	int transformDataIdx;
 } pushConstants;
 
@@ -21,7 +22,7 @@ layout (location = 1) out vec3 normal;
 
 void main()
 {
-	gl_Position = transformData[pushConstants.transformDataIdx].modelViewProj * vec4(vPos, 1.f);
+	gl_Position = transformData[pushConstants.transformBufferIdx].modelViewProj[pushConstants.transformDataIdx] * vec4(vPos, 1.f);
 	outUV = vTexCoord;
 	normal = vNormal;
 }
\ No newline at end of file
@@ -17,6 +17,9 @@
 #include <Window/Window.h>
 #include <Window/WindowBuilder.h>
 #include <Asset/AssetImporter.h>
+#include <Asset/TextureTranscodeTable.h>
+#include <Asset/TranscodedTextureCache.h>
+#include <Asset/Constants.h>
 
 namespace sy::app
 {
@@ -50,12 +53,17 @@ void Context::Startup()
 
     timer->Startup();
     window->Startup();
+    if (cmdLineParser.IsDescriptorBufferDisabled())
+    {
+        vulkanContext->GetDescriptorAllocator().SetPreferredBackend(vk::EDescriptorBackend::DescriptorSet);
+    }
     vulkanContext->Startup();
     handleManager->Startup();
 
     InitDefaultEngineResources();
     ExecuteAssetImportProcess();
 
+    renderer->SetRenderGraphExecutionEnabled(cmdLineParser.IsRenderGraphExecutionEnabled());
     renderer->Startup();
 }
 
@@ -155,6 +163,14 @@ void Context::InitDefaultEngineResources()
     auto defaultMaterial =
         handleManager->Add<render::Material>(defaultWhiteDescriptor);
     defaultMaterial.SetAlias(core::constants::res::DefaultMaterialInstance);
+
+    auto transcodeTable = handleManager->Add<asset::TextureTranscodeTable>(vulkanContext->GetRHI());
+    transcodeTable.SetAlias(core::constants::res::TextureTranscodeTable);
+
+    /** 1 GiB */
+    constexpr size_t TranscodedCacheCapacity = 1024ull * 1024ull * 1024ull;
+    auto             transcodedCache         = handleManager->Add<asset::TranscodedTextureCache>(asset::constants::path::TranscodedCache, TranscodedCacheCapacity);
+    transcodedCache.SetAlias(core::constants::res::TranscodedTextureCache);
 }
 
 void Context::ExecuteAssetImportProcess()
@@ -17,6 +17,7 @@ namespace sy::asset::constants::path
 {
 constexpr std::string_view AssetRootRelative  = "Assets";
 constexpr std::string_view AssetImportConfigs = "Assets/AssetImportConfigs.meta";
+constexpr std::string_view TranscodedCache    = "Cache/TranscodedTextures";
 } // namespace sy::asset::constants::path
 
 namespace sy::asset::constants::metadata::key
@@ -41,6 +42,9 @@ constexpr std::string_view VerticesBlobRange          = "VerticesBlobRange";
 constexpr std::string_view IndicesBlobRange           = "IndicesBlobRange";
 constexpr std::string_view NumVertices                = "NumVertices";
 constexpr std::string_view NumIndices                 = "NumIndices";
+constexpr std::string_view Bounds                     = "Bounds";
+constexpr std::string_view Min                        = "Min";
+constexpr std::string_view Max                        = "Max";
 constexpr std::string_view Quality                    = "Quality";
 constexpr std::string_view GenMips                    = "GenerateMips";
 constexpr std::string_view GenerateMaterialPerMesh    = "GenerateMaterialPerMesh";
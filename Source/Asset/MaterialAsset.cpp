@@ -2,6 +2,7 @@
 #include <Asset/MaterialAsset.h>
 #include <Asset/TextureAsset.h>
 #include <Render/Material.h>
+#include <Render/TextureResidencyManager.h>
 
 namespace sy::asset
 {
@@ -81,6 +82,10 @@ bool Material::InitializeExternal()
             else
             {
                 baseTextureAsset.SetAlias(baseTexturePathStr);
+                if (auto residencyManager = handleManager.QueryAlias<render::TextureResidencyManager>(core::constants::res::TextureResidencyManager))
+                {
+                    residencyManager->Register(baseTextureAsset);
+                }
             }
         }
 
@@ -136,6 +136,7 @@ bool Model::InitializeBlob(const std::vector<uint8_t> blob)
                     .Build(),
 
                 material);
+            mesh->SetBounds(meshData.Bounds);
         }
 
         meshes.emplace_back(mesh);
@@ -213,6 +214,11 @@ nlohmann::json Model::Mesh::Serialize() const
     root[predefined_key::NumVertices] = NumVertices;
     root[predefined_key::NumIndices]  = NumIndices;
 
+    json serializedBounds;
+    serializedBounds[predefined_key::Min] = {Bounds.Min.x, Bounds.Min.y, Bounds.Min.z};
+    serializedBounds[predefined_key::Max] = {Bounds.Max.x, Bounds.Max.y, Bounds.Max.z};
+    root[predefined_key::Bounds]          = serializedBounds;
+
     return root;
 }
 
@@ -236,5 +242,15 @@ void Model::Mesh::Deserialize(const nlohmann::json& root)
 
     NumVertices = root[predefined_key::NumVertices];
     NumIndices  = root[predefined_key::NumIndices];
+
+    if (root.contains(predefined_key::Bounds))
+    {
+        const json serializedBounds = root[predefined_key::Bounds];
+        const json serializedMin    = serializedBounds[predefined_key::Min];
+        const json serializedMax    = serializedBounds[predefined_key::Max];
+        Bounds                      = render::VertexBounds{
+                                 .Min = glm::vec3{serializedMin[0].get<float>(), serializedMin[1].get<float>(), serializedMin[2].get<float>()},
+                                 .Max = glm::vec3{serializedMax[0].get<float>(), serializedMax[1].get<float>(), serializedMax[2].get<float>()}};
+    }
 }
 } // namespace sy::asset
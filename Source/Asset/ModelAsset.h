@@ -34,6 +34,8 @@ public:
         Range<size_t> IndicesBlobRange;
         size_t        NumVertices;
         size_t        NumIndices;
+        /** Required to dequantize positions of quantized vertex types. */
+        render::VertexBounds Bounds = {};
     };
 
 public:
@@ -1,5 +1,6 @@
 #include <PCH.h>
 #include <Asset/ModelImporter.h>
+#include <Asset/VertexConversion.h>
 #include <Asset/ModelAsset.h>
 #include <Asset/MaterialAsset.h>
 #include <Core/Constants.h>
@@ -73,89 +74,8 @@ bool ModelImporter::Import(const fs::path& path, const ModelImportConfig config)
         meshIndicesBlob.resize(sizeof(render::IndexType) * numMeshIndices);
 
         /** Process Mesh vertices */
-        uint8_t*   verticesBase          = meshVerticesBlob.data();
-        const auto targetModelVertexType = config.GetVertexType();
-        for (size_t vIdx = 0; vIdx < numMeshVertices; ++vIdx)
-        {
-            if (const auto colorAttributeRange = QueryRangeOfVertexAttribute(targetModelVertexType, render::EVertexAttributeType::Color);
-                colorAttributeRange)
-            {
-                if (const auto colorAttribute = colorAttributeRange->CastTo<glm::vec4>(verticesBase);
-                    colorAttribute)
-                {
-                    glm::vec4& color = colorAttribute->get();
-                    color.r          = mesh->mColors[0][vIdx].r;
-                    color.g          = mesh->mColors[0][vIdx].g;
-                    color.b          = mesh->mColors[0][vIdx].b;
-                    color.a          = mesh->mColors[0][vIdx].a;
-                }
-            }
-
-            if (const auto posAttributeRange = QueryRangeOfVertexAttribute(targetModelVertexType, render::EVertexAttributeType::Position);
-                posAttributeRange)
-            {
-                if (const auto posAttribute = posAttributeRange->CastTo<glm::vec3>(verticesBase);
-                    posAttribute)
-                {
-                    glm::vec3& pos = posAttribute->get();
-                    pos.x          = mesh->mVertices[vIdx].x;
-                    pos.y          = mesh->mVertices[vIdx].y;
-                    pos.z          = mesh->mVertices[vIdx].z;
-                }
-            }
-
-            if (const auto texCoords0AttributeRange = QueryRangeOfVertexAttribute(targetModelVertexType, render::EVertexAttributeType::TexCoords0);
-                texCoords0AttributeRange)
-            {
-                if (const auto texCoords0Attribute = texCoords0AttributeRange->CastTo<glm::vec2>(verticesBase);
-                    texCoords0Attribute)
-                {
-                    glm::vec2& texCoords = texCoords0Attribute->get();
-                    texCoords.s          = mesh->mTextureCoords[0][vIdx].x;
-                    texCoords.t          = mesh->mTextureCoords[0][vIdx].y;
-                }
-            }
-
-            if (const auto normalAttributeRange = QueryRangeOfVertexAttribute(targetModelVertexType, render::EVertexAttributeType::Normal);
-                normalAttributeRange)
-            {
-                if (const auto normalAttribute = normalAttributeRange->CastTo<glm::vec3>(verticesBase))
-                {
-                    glm::vec3& normal = normalAttribute->get();
-                    normal.x          = mesh->mNormals[vIdx].x;
-                    normal.y          = mesh->mNormals[vIdx].y;
-                    normal.z          = mesh->mNormals[vIdx].z;
-                }
-            }
-
-            if (const auto bitangentAttributeRange = QueryRangeOfVertexAttribute(targetModelVertexType, render::EVertexAttributeType::Bitangent);
-                bitangentAttributeRange)
-            {
-                if (const auto bitangentAttribute = bitangentAttributeRange->CastTo<glm::vec3>(verticesBase);
-                    bitangentAttribute)
-                {
-                    glm::vec3& bitangent = bitangentAttribute->get();
-                    bitangent.x          = mesh->mBitangents[vIdx].x;
-                    bitangent.y          = mesh->mBitangents[vIdx].y;
-                    bitangent.z          = mesh->mBitangents[vIdx].z;
-                }
-            }
-
-            if (const auto tangentAttributeRange = QueryRangeOfVertexAttribute(targetModelVertexType, render::EVertexAttributeType::Tangent);
-                tangentAttributeRange)
-            {
-                if (const auto tangentAttribute = tangentAttributeRange->CastTo<glm::vec3>(verticesBase);
-                    tangentAttribute)
-                {
-                    glm::vec3& tangent = tangentAttribute->get();
-                    tangent.x          = mesh->mTangents[vIdx].x;
-                    tangent.y          = mesh->mTangents[vIdx].y;
-                    tangent.z          = mesh->mTangents[vIdx].z;
-                }
-            }
-
-            verticesBase += sizeOfVertex;
-        }
+        const render::VertexBounds meshBounds = CalculateVertexBounds(*mesh);
+        ConvertVertices(config.GetVertexType(), *mesh, meshBounds, meshVerticesBlob);
 
         /** Process Mesh indices */
         uint8_t* indicesBase = meshIndicesBlob.data();
@@ -234,7 +154,8 @@ bool ModelImporter::Import(const fs::path& path, const ModelImportConfig config)
             verticesBlobRange,
             indicesBlobRange,
             numMeshVertices,
-            numMeshIndices);
+            numMeshIndices,
+            meshBounds);
 
         meshVerticesBlob.shrink_to_fit();
         meshIndicesBlob.shrink_to_fit();
@@ -1,10 +1,14 @@
 #include <PCH.h>
 #include <Asset/TextureAsset.h>
+#include <Asset/TextureTranscodeTable.h>
+#include <Asset/TranscodedTextureCache.h>
 #include <VK/Texture.h>
 #include <VK/TextureBuilder.h>
 #include <VK/TextureView.h>
 #include <VK/Sampler.h>
 #include <VK/DescriptorAllocator.h>
+#include <VK/VulkanContext.h>
+#include <VK/VulkanRHI.h>
 #include <ktx.h>
 #include <ktxvulkan.h>
 
@@ -73,93 +77,266 @@ void Texture::Deserialize(const json& root)
 
 bool Texture::InitializeExternal()
 {
-    using UniqueKtxTexture2 = std::unique_ptr<ktxTexture2, std::function<void(ktxTexture2*)>>;
-    UniqueKtxTexture2 externalTexture;
+    KTXTexture2UniquePtr externalTexture = LoadExternalTexture(QueryLoadContext());
+    if (!externalTexture)
     {
-        const std::string pathStr = GetOriginPath().string();
+        return false;
+    }
 
-        ktxTexture2*           raw    = nullptr;
-        const ktx_error_code_e result = ktxTexture_CreateFromNamedFile(
-            pathStr.c_str(),
-            KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT,
-            reinterpret_cast<ktxTexture**>(&raw));
-        if (result != KTX_SUCCESS)
-        {
-            spdlog::error("Failed to load ktx texture from {}. Error: {}", pathStr, magic_enum::enum_name<ktx_error_code_e>(result));
-            return false;
-        }
+    SetFormat(static_cast<VkFormat>(externalTexture->vkFormat));
 
-        externalTexture = UniqueKtxTexture2(raw, [](ktxTexture2* ptr) {
-            ktxTexture_Destroy(ktxTexture(ptr));
-        });
+    if (!handleManager)
+    {
+        SY_ASSERT(false, "Trying to initialize texture without HandleManager.");
+        return false;
     }
 
-    ktx_transcode_fmt_e targetFormat = KTX_TTF_RGBA32;
-    switch (compressionMode)
+    if (!vulkanContext)
     {
-        case ETextureCompressionMode::BC1:
-            targetFormat = KTX_TTF_BC1_RGB;
-            break;
-        case ETextureCompressionMode::BC3:
-            targetFormat = KTX_TTF_BC3_RGBA;
-            break;
-        case ETextureCompressionMode::BC7:
-            targetFormat = KTX_TTF_BC7_RGBA;
-            break;
-        case ETextureCompressionMode::BC4:
-            targetFormat = KTX_TTF_BC4_R;
-            break;
-        case ETextureCompressionMode::BC5:
-            targetFormat = KTX_TTF_BC5_RG;
-            break;
+        SY_ASSERT(false, "Trying to initialize texture without VulkanContext.");
+        return false;
     }
 
-    // #todo check support format
-
-    if (ktxTexture2_NeedsTranscoding(externalTexture.get()))
+    /**
+     * Residency budget is accounted by VMA allocation size, so sizes of every base mips are queried from memory requirements of the device,
+     * which VMA allocates, instead of estimated from size of ktx image data.
+     */
+    numMips = externalTexture->numLevels;
+    residentSizes.resize(numMips);
+    for (uint32_t baseMip = 0; baseMip < numMips; ++baseMip)
     {
-        ktxTexture2_TranscodeBasis(externalTexture.get(), targetFormat, 0);
+        const auto builder     = BuildResidentTextureTemplate(vulkanContext->get(), baseMip, externalTexture->numLayers);
+        residentSizes[baseMip] = vk::Texture::QueryMemoryRequirements(builder).size;
     }
 
-    SetFormat(static_cast<VkFormat>(externalTexture->vkFormat));
+    return CreateResidentResources(*externalTexture, 0);
+}
 
-    if (!handleManager)
+bool Texture::RequestResidentBaseMip(const uint32_t newBaseMip)
+{
+    if (!(*this) || newBaseMip >= numMips)
     {
-        SY_ASSERT(false, "Trying to initialize texture without HandleManager.");
         return false;
     }
 
-    if (!vulkanContext)
+    pendingBaseMip = newBaseMip;
+    if (newBaseMip == residentBaseMip || pendingSource.valid())
+    {
+        return true;
+    }
+
+    pendingSource = std::async(std::launch::async,
+                               [this, context = QueryLoadContext()]() {
+                                   return LoadExternalTexture(context);
+                               });
+    return true;
+}
+
+std::optional<bool> Texture::ApplyResidentBaseMip()
+{
+    if (!pendingSource.valid() || pendingSource.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+    {
+        return std::nullopt;
+    }
+
+    KTXTexture2UniquePtr externalTexture = pendingSource.get();
+    if (!externalTexture)
     {
-        SY_ASSERT(false, "Trying to initialize texture without VulkanContext.");
         return false;
     }
 
+    return pendingBaseMip == residentBaseMip || CreateResidentResources(*externalTexture, pendingBaseMip);
+}
+
+Texture::LoadContext Texture::QueryLoadContext() const
+{
+    LoadContext context;
+    if (handleManager)
+    {
+        auto&      handleManager   = this->handleManager->get();
+        const auto transcodeTable  = handleManager.QueryAlias<TextureTranscodeTable>(core::constants::res::TextureTranscodeTable);
+        auto       transcodedCache = handleManager.QueryAlias<TranscodedTextureCache>(core::constants::res::TranscodedTextureCache);
+        context.TranscodeTable     = transcodeTable ? &(*transcodeTable) : nullptr;
+        context.TranscodedCache    = transcodedCache ? &(*transcodedCache) : nullptr;
+    }
+
+    return context;
+}
+
+size_t Texture::GetResidentBytes() const
+{
+    if (!texture || !vulkanContext)
+    {
+        return 0;
+    }
+
+    VmaAllocationInfo allocationInfo{};
+    vmaGetAllocationInfo(vulkanContext->get().GetRHI().GetAllocator(), texture->GetAllocation(), &allocationInfo);
+    return allocationInfo.size;
+}
+
+KTXTexture2UniquePtr Texture::LoadExternalTexture(const LoadContext& context) const
+{
+    const auto beginTime = std::chrono::steady_clock::now();
+
+    const auto wrapKtxTexture = [](ktxTexture2* raw) {
+        return KTXTexture2UniquePtr(raw, [](ktxTexture2* ptr) {
+            ktxTexture_Destroy(ktxTexture(ptr));
+        });
+    };
+
+    const std::string pathStr = GetOriginPath().string();
+
+    /** Only header and metadata are read here. Image data loaded lazily from the file, it does not required when transcoded payload hits the cache. */
+    KTXTexture2UniquePtr externalTexture;
+    {
+        ktxTexture2*           raw    = nullptr;
+        const ktx_error_code_e result = ktxTexture2_CreateFromNamedFile(
+            pathStr.c_str(),
+            KTX_TEXTURE_CREATE_NO_FLAGS,
+            &raw);
+        if (result != KTX_SUCCESS)
+        {
+            spdlog::error("Failed to load ktx texture from {}. Error: {}", pathStr, magic_enum::enum_name<ktx_error_code_e>(result));
+            return nullptr;
+        }
+
+        externalTexture = wrapKtxTexture(raw);
+    }
+
+    if (ktxTexture2_NeedsTranscoding(externalTexture.get()))
+    {
+        /** KHR_DF_TRANSFER_SRGB of khr_df.h */
+        constexpr ktx_uint32_t TransferSRGB = 2;
+
+        auto channelLayout = TextureTranscodeTable::QueryChannelLayout(ktxTexture2_GetNumComponents(externalTexture.get()));
+        /** sRGB encoded data should not be transcoded to single or dual channel formats. */
+        if (ktxTexture2_GetOETF(externalTexture.get()) == TransferSRGB &&
+            (channelLayout == ETextureChannelLayout::R || channelLayout == ETextureChannelLayout::RG))
+        {
+            channelLayout = ETextureChannelLayout::RGB;
+        }
+
+        TranscodedTextureCache* const transcodedCache = context.TranscodedCache;
+        const ktx_transcode_fmt_e     targetFormat    = context.TranscodeTable != nullptr ? context.TranscodeTable->Select(channelLayout, compressionMode) :
+                                                                                            TextureTranscodeTable::QueryTranscodeFormat(compressionMode);
+
+        const VkFormat targetVkFormat = TextureTranscodeTable::QueryVkFormat(targetFormat);
+        uint64_t       contentHash    = 0;
+        if (transcodedCache)
+        {
+            /** Whole source is read and hashed only when it is seen first time or its size/last write time changed. */
+            const auto sourceStamp = TranscodedTextureCache::QuerySourceStamp(GetOriginPath());
+            const auto stampedHash = sourceStamp ? transcodedCache->FindContentHash(GetOriginPath(), *sourceStamp) : std::nullopt;
+            if (stampedHash)
+            {
+                contentHash = *stampedHash;
+            }
+            else
+            {
+                contentHash = TranscodedTextureCache::HashContent(LoadBlobFromFile(GetOriginPath()));
+                if (sourceStamp)
+                {
+                    transcodedCache->RecordContentHash(GetOriginPath(), *sourceStamp, contentHash);
+                }
+            }
+
+            if (const auto cachedPath = transcodedCache->Find(contentHash, targetVkFormat);
+                cachedPath)
+            {
+                ktxTexture2*           raw    = nullptr;
+                const ktx_error_code_e result = ktxTexture2_CreateFromNamedFile(
+                    cachedPath->string().c_str(),
+                    KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT,
+                    &raw);
+                if (result == KTX_SUCCESS)
+                {
+                    spdlog::trace("Texture {} loaded from transcoded cache in {} ms.", GetName(),
+                                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - beginTime).count());
+                    return wrapKtxTexture(raw);
+                }
+
+                /** #fallback #1: Corrupted payload, transcode again and overwrite it. */
+                spdlog::warn("Failed to load transcoded cache {}. Error: {}", cachedPath->string(), magic_enum::enum_name<ktx_error_code_e>(result));
+                transcodedCache->Invalidate(contentHash);
+            }
+        }
+
+        ktx_error_code_e result = ktxTexture_LoadImageData(ktxTexture(externalTexture.get()), nullptr, 0);
+        if (result != KTX_SUCCESS)
+        {
+            spdlog::error("Failed to load image data of ktx texture {}. Error: {}", pathStr, magic_enum::enum_name<ktx_error_code_e>(result));
+            return nullptr;
+        }
+
+        result = ktxTexture2_TranscodeBasis(externalTexture.get(), targetFormat, 0);
+        if (result != KTX_SUCCESS)
+        {
+            spdlog::error("Failed to transcode ktx texture {}. Error: {}", GetName(), magic_enum::enum_name<ktx_error_code_e>(result));
+            return nullptr;
+        }
+
+        if (transcodedCache)
+        {
+            ktx_uint8_t* payload     = nullptr;
+            ktx_size_t   payloadSize = 0;
+            if (ktxTexture_WriteToMemory(ktxTexture(externalTexture.get()), &payload, &payloadSize) == KTX_SUCCESS)
+            {
+                transcodedCache->Store(contentHash, targetVkFormat, std::span<const uint8_t>{payload, payloadSize});
+                std::free(payload);
+            }
+        }
+
+        spdlog::trace("Texture {} transcoded in {} ms.", GetName(),
+                      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - beginTime).count());
+    }
+    else
+    {
+        const ktx_error_code_e result = ktxTexture_LoadImageData(ktxTexture(externalTexture.get()), nullptr, 0);
+        if (result != KTX_SUCCESS)
+        {
+            spdlog::error("Failed to load image data of ktx texture {}. Error: {}", pathStr, magic_enum::enum_name<ktx_error_code_e>(result));
+            return nullptr;
+        }
+    }
+
+    return externalTexture;
+}
+
+vk::TextureBuilder Texture::BuildResidentTextureTemplate(vk::VulkanContext& vulkanContext, const uint32_t baseMip, const uint32_t numLayers) const
+{
+    return vk::TextureBuilder::Texture2DShaderResourceTemplate(vulkanContext)
+        .SetName(GetName())
+        .SetFormat(this->format)
+        .SetExtent(CalculateMipExtent(extent, baseMip))
+        .SetMips(numMips - baseMip)
+        .SetArrayLayers(numLayers);
+}
+
+bool Texture::CreateResidentResources(ktxTexture2& externalTexture, const uint32_t baseMip)
+{
     auto& handleManager = this->handleManager->get();
     auto& vulkanContext = this->vulkanContext->get();
 
     const auto name = GetName();
 
-    auto textureBuilder = vk::TextureBuilder::Texture2DShaderResourceTemplate(vulkanContext)
-                              .SetName(name)
-                              .SetFormat(this->format)
-                              .SetExtent(extent)
+    const uint32_t residentMips = externalTexture.numLevels - baseMip;
+
+    auto textureBuilder = BuildResidentTextureTemplate(vulkanContext, baseMip, externalTexture.numLayers)
                               .SetDataToTransfer(std::span{
-                                  reinterpret_cast<const uint8_t*>(externalTexture->pData),
-                                  externalTexture->dataSize})
-                              .SetTargetInitialState(vk::ETextureState::AnyShaderReadSampledImage)
-                              .SetMips(externalTexture->numLevels)
-                              .SetArrayLayers(externalTexture->numLayers);
+                                  reinterpret_cast<const uint8_t*>(externalTexture.pData),
+                                  externalTexture.dataSize})
+                              .SetTargetInitialState(vk::ETextureState::AnyShaderReadSampledImage);
 
-    const uint32_t mipLevels = externalTexture->numLevels;
-    if (mipLevels > 1)
+    /** Dropped top mips still exist in staging data, so copy infos are always required when base mip is not zero. */
+    if (externalTexture.numLevels > 1)
     {
-        const auto baseExtent = extent;
-        for (uint32_t mip = 0; mip < externalTexture->numLevels; ++mip)
+        for (uint32_t mip = 0; mip < residentMips; ++mip)
         {
-            const auto mipExtent       = CalculateMipExtent(baseExtent, mip);
-            size_t     mipBufferOffset = 0;
-            ktxTexture_GetImageOffset(ktxTexture(externalTexture.get()), mip, 0, 0, &mipBufferOffset);
+            const uint32_t sourceMip       = baseMip + mip;
+            const auto     mipExtent       = CalculateMipExtent(extent, sourceMip);
+            size_t         mipBufferOffset = 0;
+            ktxTexture_GetImageOffset(ktxTexture(&externalTexture), sourceMip, 0, 0, &mipBufferOffset);
             const VkBufferImageCopy copyInfo{
                 .bufferOffset     = mipBufferOffset,
                 .imageSubresource = {
@@ -169,25 +346,32 @@ bool Texture::InitializeExternal()
                     .layerCount     = 1},
                 .imageExtent = {mipExtent.width, mipExtent.height, 1}};
 
-			textureBuilder.AddCopyInfo(copyInfo);
+            textureBuilder.AddCopyInfo(copyInfo);
         }
     }
 
+    /**
+     * In-flight frames may still sample previous resources through previous descriptor slot,
+     * so new resources are created aside and previous ones are retired only after descriptor moved to new slot.
+     */
     // #todo into account mips, see "KTX-Software/vkloader.c/ktxTexture_VkUploadEx"
-    this->texture = handleManager.Add<vk::Texture>(textureBuilder.Build());
-    if (!this->texture)
+    auto newTexture = handleManager.Add<vk::Texture>(textureBuilder.Build());
+    if (!newTexture)
     {
         return false;
     }
-    this->texture.SetAlias(name);
 
-    this->textureView = handleManager.Add<vk::TextureView>(
+    auto newTextureView = handleManager.Add<vk::TextureView>(
         std::format("{}_View", name),
         vulkanContext,
-        *(this->texture),
+        *newTexture,
         VK_IMAGE_VIEW_TYPE_2D);
 
-    this->sampler = handleManager.QueryAlias<vk::Sampler>(samplerAlias);
+    if (!this->sampler)
+    {
+        this->sampler = handleManager.QueryAlias<vk::Sampler>(samplerAlias);
+    }
+
     if (!this->sampler)
     {
         /** #fallback #1 : Attempt to load engine default trilinear sampler. */
@@ -195,13 +379,37 @@ bool Texture::InitializeExternal()
     }
 
     auto& descriptorAllocator = vulkanContext.GetDescriptorAllocator();
-    this->descriptor        = handleManager.Add<vk::Descriptor>(
-        descriptorAllocator.RequestDescriptor(
-            *(this->texture),
-            *(this->textureView),
-            *(this->sampler),
-            vk::ETextureState::AnyShaderReadSampledImage));
+    if (!this->descriptor)
+    {
+        this->descriptor = handleManager.Add<vk::Descriptor>(
+            descriptorAllocator.RequestDescriptor(
+                *newTexture,
+                *newTextureView,
+                *(this->sampler),
+                vk::ETextureState::AnyShaderReadSampledImage));
+    }
+    else if (!descriptorAllocator.UpdateDescriptor(
+                 *(this->descriptor),
+                 *newTexture,
+                 *newTextureView,
+                 *(this->sampler),
+                 vk::ETextureState::AnyShaderReadSampledImage))
+    {
+        spdlog::error("Failed to move descriptor of texture {} to new resident resources.", name);
+        newTextureView.DestroySelf();
+        newTexture.DestroySelf();
+        return false;
+    }
+
+    /** Vulkan context defers destruction until every in-flight frames which could sample previous resources are completed. */
+    this->textureView.DestroySelf();
+    this->texture.DestroySelf();
+
+    this->texture     = std::move(newTexture);
+    this->textureView = std::move(newTextureView);
+    this->texture.SetAlias(name);
 
+    residentBaseMip = baseMip;
     return this->texture.IsValid();
 }
 
@@ -8,12 +8,15 @@ namespace sy::vk
 {
 class VulkanContext;
 class Texture;
+class TextureBuilder;
 class TextureView;
 class Sampler;
 } // namespace sy::vk
 
 namespace sy::asset
 {
+class TextureTranscodeTable;
+class TranscodedTextureCache;
 class Texture : public Asset
 {
 public:
@@ -29,6 +32,12 @@ public:
     [[nodiscard]] auto             GetExtent() const { return extent; }
     [[nodiscard]] auto             GetFormat() const { return format; }
     [[nodiscard]] std::string_view GetSamplerAlias() const { return sampler.GetAlias(); }
+    [[nodiscard]] auto             GetNumMips() const { return numMips; }
+    [[nodiscard]] auto             GetResidentBaseMip() const { return residentBaseMip; }
+    /** Device memory size of the texture for each resident base mip, which VMA allocates. */
+    [[nodiscard]] const auto&      GetResidentSizes() const { return residentSizes; }
+    /** Actual size of device memory which allocated for resident mips. */
+    [[nodiscard]] size_t           GetResidentBytes() const;
 
     void SetCompressionMode(const ETextureCompressionMode mode) { this->compressionMode = mode; }
     void SetCompressQuality(const ETextureCompressionQuality quality) { this->compressionQuality = quality; }
@@ -40,9 +49,32 @@ public:
     [[nodiscard]] json Serialize() const override;
     void               Deserialize(const nlohmann::json& serializedMetadata) override;
 
+    /**
+     * Recreate device texture which contains mips from base mip to tail. Descriptor handle keeps same, but it refers new slot.
+     * Source is loaded(and transcoded) on worker thread, and resources are recreated by ApplyResidentBaseMip of later frame.
+     * Request while source is loading only changes base mip to apply, since source always contains every mips.
+     */
+    bool RequestResidentBaseMip(uint32_t newBaseMip);
+    /** Returns nullopt if nothing is requested or source is still loading, otherwise whether resources are recreated. */
+    [[nodiscard]] std::optional<bool> ApplyResidentBaseMip();
+    [[nodiscard]] bool                IsResidentBaseMipPending() const { return pendingSource.valid(); }
+
+private:
+    /** Services which loading of external texture depends on. Resolved on caller thread, since handle manager is not thread-safe. */
+    struct LoadContext
+    {
+        const TextureTranscodeTable* TranscodeTable  = nullptr;
+        TranscodedTextureCache*      TranscodedCache = nullptr;
+    };
+
 private:
     bool InitializeExternal() override;
 
+    [[nodiscard]] LoadContext          QueryLoadContext() const;
+    [[nodiscard]] KTXTexture2UniquePtr LoadExternalTexture(const LoadContext& context) const;
+    [[nodiscard]] vk::TextureBuilder   BuildResidentTextureTemplate(vk::VulkanContext& vulkanContext, uint32_t baseMip, uint32_t numLayers) const;
+    bool                               CreateResidentResources(ktxTexture2& externalTexture, uint32_t baseMip);
+
 private:
     /** Metadata */
     ETextureCompressionMode    compressionMode    = ETextureCompressionMode::None;
@@ -59,5 +91,13 @@ private:
     Handle<vk::TextureView>        textureView   = {};
     Handle<vk::Sampler>            sampler       = {};
     Handle<vk::Descriptor>         descriptor    = {};
+
+    /** Residency */
+    uint32_t                          numMips         = 1;
+    uint32_t                          residentBaseMip = 0;
+    std::vector<size_t>               residentSizes;
+    uint32_t                          pendingBaseMip  = 0;
+    /** Declared last, so destruction waits on loading before other members are destroyed. */
+    std::future<KTXTexture2UniquePtr> pendingSource;
 };
 } // namespace sy::asset
\ No newline at end of file
@@ -114,6 +114,7 @@ void TextureImporter::ReadbackGeneratedMipsToBuffer()
                             .SetMemoryProperty(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
                             .SetSize(textureSizeBytes)
                             .SetUsage(VK_BUFFER_USAGE_TRANSFER_DST_BIT)
+                            .SetPersistentlyMapped()
                             .Build();
 
         const auto cmdBuffer = cmdPool.RequestCommandBuffer("Mip Transfer Command Buffer");
@@ -128,11 +129,12 @@ void TextureImporter::ReadbackGeneratedMipsToBuffer()
 
 void TextureImporter::SetGeneratedMipsToKtxTextureFromReadbackBuffers()
 {
-    auto& vulkanRHI = vulkanContext.GetRHI();
     uint32_t mipLevel = 1;
     for (const auto& readbackBuffer : generatedMipReadbackBuffers)
     {
-        const uint8_t* mappedBuffer = reinterpret_cast<const uint8_t*>(vulkanRHI.Map(*readbackBuffer));
+        /** GPU_TO_CPU memory is usually host cached, which is not guaranteed to be coherent. */
+        readbackBuffer->Invalidate();
+        const uint8_t* mappedBuffer = reinterpret_cast<const uint8_t*>(readbackBuffer->GetMappedSpan().data());
         const auto result = ktxTexture_SetImageFromMemory(ktxTexture(ktxTextureFromRawImage.get()),
                                                           mipLevel, 0, 0,
                                                           mappedBuffer,
@@ -142,7 +144,6 @@ void TextureImporter::SetGeneratedMipsToKtxTextureFromReadbackBuffers()
             spdlog::warn("Failed to set mip texture {} to ktx texture from memory. Error: {}", mipLevel, magic_enum::enum_name<ktx_error_code_e>(result));
         }
 
-        vulkanRHI.Unmap(*readbackBuffer);
         ++mipLevel;
     }
 }
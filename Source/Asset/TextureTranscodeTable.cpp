@@ -0,0 +1,151 @@
+#include <PCH.h>
+#include <Asset/TextureTranscodeTable.h>
+#include <VK/VulkanRHI.h>
+
+namespace sy::asset
+{
+TextureTranscodeTable::TextureTranscodeTable()
+{
+    Build([](const VkFormat format) { return format == VK_FORMAT_R8G8B8A8_UNORM; });
+}
+
+TextureTranscodeTable::TextureTranscodeTable(const vk::VulkanRHI& vulkanRHI)
+{
+    Build([&vulkanRHI](const VkFormat format) {
+        return vulkanRHI.IsFormatSupportFeatures(format, VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_2_TRANSFER_DST_BIT);
+    });
+}
+
+TextureTranscodeTable::TextureTranscodeTable(const FormatSupportQuery& query)
+{
+    Build(query);
+}
+
+void TextureTranscodeTable::Build(const FormatSupportQuery& query)
+{
+    /** Ordered by quality. */
+    constexpr std::array rgbaCandidates = {KTX_TTF_BC7_RGBA, KTX_TTF_ASTC_4x4_RGBA, KTX_TTF_BC3_RGBA, KTX_TTF_ETC2_RGBA};
+    constexpr std::array rgbCandidates  = {KTX_TTF_BC7_RGBA, KTX_TTF_ASTC_4x4_RGBA, KTX_TTF_BC1_RGB, KTX_TTF_ETC1_RGB};
+    constexpr std::array rgCandidates   = {KTX_TTF_BC5_RG, KTX_TTF_ETC2_EAC_RG11, KTX_TTF_BC7_RGBA, KTX_TTF_ASTC_4x4_RGBA};
+    constexpr std::array rCandidates    = {KTX_TTF_BC4_R, KTX_TTF_ETC2_EAC_R11, KTX_TTF_BC7_RGBA, KTX_TTF_ASTC_4x4_RGBA};
+
+    constexpr std::array allFormats = {
+        KTX_TTF_ETC1_RGB, KTX_TTF_ETC2_RGBA, KTX_TTF_BC1_RGB, KTX_TTF_BC3_RGBA,
+        KTX_TTF_BC4_R, KTX_TTF_BC5_RG, KTX_TTF_BC7_RGBA, KTX_TTF_ASTC_4x4_RGBA,
+        KTX_TTF_ETC2_EAC_R11, KTX_TTF_ETC2_EAC_RG11, KTX_TTF_RGBA32};
+
+    supportedFormats.clear();
+    for (const auto format : allFormats)
+    {
+        if (query(QueryVkFormat(format)))
+        {
+            supportedFormats.insert(format);
+        }
+    }
+    /** RGBA32 is always available as last resort. */
+    supportedFormats.insert(KTX_TTF_RGBA32);
+
+    const auto selectBest = [this](const std::span<const ktx_transcode_fmt_e> candidates) {
+        const auto found = std::find_if(candidates.begin(), candidates.end(),
+                                        [this](const ktx_transcode_fmt_e format) { return IsSupported(format); });
+        return found != candidates.end() ? *found : KTX_TTF_RGBA32;
+    };
+
+    bestFormats[ToUnderlying(ETextureChannelLayout::RGBA)] = selectBest(rgbaCandidates);
+    bestFormats[ToUnderlying(ETextureChannelLayout::RGB)]  = selectBest(rgbCandidates);
+    bestFormats[ToUnderlying(ETextureChannelLayout::RG)]   = selectBest(rgCandidates);
+    bestFormats[ToUnderlying(ETextureChannelLayout::R)]    = selectBest(rCandidates);
+
+    for (const auto layout : magic_enum::enum_values<ETextureChannelLayout>())
+    {
+        spdlog::trace("Transcode target of {} layout: {}", magic_enum::enum_name(layout), magic_enum::enum_name(GetBestFormat(layout)));
+    }
+}
+
+ktx_transcode_fmt_e TextureTranscodeTable::Select(const ETextureChannelLayout layout, const ETextureCompressionMode preferredMode) const
+{
+    if (preferredMode != ETextureCompressionMode::None)
+    {
+        const auto preferredFormat = QueryTranscodeFormat(preferredMode);
+        if (IsSupported(preferredFormat))
+        {
+            return preferredFormat;
+        }
+
+        spdlog::warn("Preferred compression mode {} does not supported by device.", magic_enum::enum_name(preferredMode));
+    }
+
+    return GetBestFormat(layout);
+}
+
+ETextureChannelLayout TextureTranscodeTable::QueryChannelLayout(const uint32_t numComponents)
+{
+    switch (numComponents)
+    {
+        case 1:
+            return ETextureChannelLayout::R;
+        case 2:
+            return ETextureChannelLayout::RG;
+        case 3:
+            return ETextureChannelLayout::RGB;
+        default:
+            break;
+    }
+
+    return ETextureChannelLayout::RGBA;
+}
+
+VkFormat TextureTranscodeTable::QueryVkFormat(const ktx_transcode_fmt_e format)
+{
+    switch (format)
+    {
+        case KTX_TTF_ETC1_RGB:
+            return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+        case KTX_TTF_ETC2_RGBA:
+            return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+        case KTX_TTF_BC1_RGB:
+            return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+        case KTX_TTF_BC3_RGBA:
+            return VK_FORMAT_BC3_UNORM_BLOCK;
+        case KTX_TTF_BC4_R:
+            return VK_FORMAT_BC4_UNORM_BLOCK;
+        case KTX_TTF_BC5_RG:
+            return VK_FORMAT_BC5_UNORM_BLOCK;
+        case KTX_TTF_BC7_RGBA:
+            return VK_FORMAT_BC7_UNORM_BLOCK;
+        case KTX_TTF_ASTC_4x4_RGBA:
+            return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+        case KTX_TTF_ETC2_EAC_R11:
+            return VK_FORMAT_EAC_R11_UNORM_BLOCK;
+        case KTX_TTF_ETC2_EAC_RG11:
+            return VK_FORMAT_EAC_R11G11_UNORM_BLOCK;
+        case KTX_TTF_RGBA32:
+            return VK_FORMAT_R8G8B8A8_UNORM;
+        default:
+            break;
+    }
+
+    return VK_FORMAT_UNDEFINED;
+}
+
+ktx_transcode_fmt_e TextureTranscodeTable::QueryTranscodeFormat(const ETextureCompressionMode mode)
+{
+    switch (mode)
+    {
+        case ETextureCompressionMode::BC1:
+            return KTX_TTF_BC1_RGB;
+        case ETextureCompressionMode::BC3:
+            return KTX_TTF_BC3_RGBA;
+        case ETextureCompressionMode::BC4:
+            return KTX_TTF_BC4_R;
+        case ETextureCompressionMode::BC5:
+            return KTX_TTF_BC5_RG;
+        case ETextureCompressionMode::BC7:
+            return KTX_TTF_BC7_RGBA;
+        default:
+            break;
+    }
+
+    return KTX_TTF_RGBA32;
+}
+} // namespace sy::asset
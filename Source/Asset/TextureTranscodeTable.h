@@ -0,0 +1,52 @@
+#pragma once
+#include <PCH.h>
+#include <Asset/TextureAssetEnums.h>
+
+namespace sy::vk
+{
+class VulkanRHI;
+}
+
+namespace sy::asset
+{
+enum class ETextureChannelLayout
+{
+    R,
+    RG,
+    RGB,
+    RGBA
+};
+
+/**
+ * Table of best supported transcode target per channel layout.
+ * Format capabilities of device are queried only once at construction.
+ */
+class TextureTranscodeTable : public NonCopyable
+{
+public:
+    using FormatSupportQuery = std::function<bool(VkFormat)>;
+
+public:
+    /** Every layout fallback to RGBA32. */
+    TextureTranscodeTable();
+    explicit TextureTranscodeTable(const vk::VulkanRHI& vulkanRHI);
+    explicit TextureTranscodeTable(const FormatSupportQuery& query);
+    ~TextureTranscodeTable() override = default;
+
+    /** Preferred mode of texture metadata has higher priority if it supported. */
+    [[nodiscard]] ktx_transcode_fmt_e Select(ETextureChannelLayout layout, ETextureCompressionMode preferredMode = ETextureCompressionMode::None) const;
+    [[nodiscard]] ktx_transcode_fmt_e GetBestFormat(const ETextureChannelLayout layout) const { return bestFormats[ToUnderlying(layout)]; }
+    [[nodiscard]] bool                IsSupported(const ktx_transcode_fmt_e format) const { return supportedFormats.contains(format); }
+
+    [[nodiscard]] static ETextureChannelLayout QueryChannelLayout(uint32_t numComponents);
+    [[nodiscard]] static VkFormat              QueryVkFormat(ktx_transcode_fmt_e format);
+    [[nodiscard]] static ktx_transcode_fmt_e   QueryTranscodeFormat(ETextureCompressionMode mode);
+
+private:
+    void Build(const FormatSupportQuery& query);
+
+private:
+    std::array<ktx_transcode_fmt_e, magic_enum::enum_count<ETextureChannelLayout>()> bestFormats;
+    robin_hood::unordered_set<ktx_transcode_fmt_e>                                   supportedFormats;
+};
+} // namespace sy::asset
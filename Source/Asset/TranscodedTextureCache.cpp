@@ -0,0 +1,363 @@
+#include <PCH.h>
+#include <Asset/TranscodedTextureCache.h>
+
+namespace sy::asset
+{
+namespace
+{
+constexpr std::string_view IndexFileName    = "Index.json";
+constexpr std::string_view VersionKey       = "Version";
+constexpr std::string_view AccessCounterKey = "AccessCounter";
+constexpr std::string_view EntriesKey       = "Entries";
+constexpr std::string_view FileKey          = "File";
+constexpr std::string_view ContentHashKey   = "ContentHash";
+constexpr std::string_view SizeKey          = "Size";
+constexpr std::string_view LastAccessKey    = "LastAccess";
+constexpr std::string_view SourcesKey       = "Sources";
+constexpr std::string_view PathKey          = "Path";
+constexpr std::string_view LastWriteTimeKey = "LastWriteTime";
+} // namespace
+
+TranscodedTextureCache::TranscodedTextureCache(fs::path directory, const size_t capacityBytes) :
+    directory(std::move(directory)),
+    capacityBytes(capacityBytes)
+{
+    if (!fs::exists(this->directory))
+    {
+        fs::create_directories(this->directory);
+    }
+
+    LoadIndex();
+}
+
+TranscodedTextureCache::~TranscodedTextureCache()
+{
+    Flush();
+}
+
+uint64_t TranscodedTextureCache::HashContent(const std::span<const uint8_t> content)
+{
+    /** FNV-1a 64 */
+    uint64_t hash = 14695981039346656037ull;
+    for (const uint8_t byte : content)
+    {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+std::optional<TranscodedTextureCache::SourceStamp> TranscodedTextureCache::QuerySourceStamp(const fs::path& source)
+{
+    std::error_code errorCode;
+    const auto      size = fs::file_size(source, errorCode);
+    if (errorCode)
+    {
+        return std::nullopt;
+    }
+
+    const auto lastWriteTime = fs::last_write_time(source, errorCode);
+    if (errorCode)
+    {
+        return std::nullopt;
+    }
+
+    return SourceStamp{
+        .Size          = static_cast<uint64_t>(size),
+        .LastWriteTime = static_cast<int64_t>(lastWriteTime.time_since_epoch().count())};
+}
+
+std::optional<uint64_t> TranscodedTextureCache::FindContentHash(const fs::path& source, const SourceStamp& stamp) const
+{
+    std::lock_guard lock{mutex};
+    const auto      itr = sources.find(MakeSourceKey(source));
+    if (itr == sources.end() || itr->second.Stamp != stamp)
+    {
+        return std::nullopt;
+    }
+
+    return itr->second.ContentHash;
+}
+
+void TranscodedTextureCache::RecordContentHash(const fs::path& source, const SourceStamp& stamp, const uint64_t contentHash)
+{
+    std::lock_guard lock{mutex};
+    sources[MakeSourceKey(source)] = Source{
+        .Stamp       = stamp,
+        .ContentHash = contentHash};
+    ++statistics.SourceHashes;
+}
+
+std::optional<fs::path> TranscodedTextureCache::Find(const uint64_t contentHash, const VkFormat format)
+{
+    std::lock_guard lock{mutex};
+    const std::string fileName = MakeFileName(contentHash, format);
+    const auto        itr      = entries.find(fileName);
+    if (itr == entries.end())
+    {
+        ++statistics.Misses;
+        return std::nullopt;
+    }
+
+    fs::path path = directory / fileName;
+    if (!fs::exists(path))
+    {
+        /** Payload removed from outside of cache. */
+        RemoveUnsafe(fileName);
+        ++statistics.Misses;
+        return std::nullopt;
+    }
+
+    itr->second.LastAccess = ++accessCounter;
+    ++statistics.Hits;
+    return path;
+}
+
+void TranscodedTextureCache::Store(const uint64_t contentHash, const VkFormat format, const std::span<const uint8_t> payload)
+{
+    if (payload.empty() || payload.size() > capacityBytes)
+    {
+        return;
+    }
+
+    std::lock_guard   lock{mutex};
+    const std::string fileName = MakeFileName(contentHash, format);
+    if (entries.contains(fileName))
+    {
+        RemoveUnsafe(fileName);
+    }
+
+    PruneUnsafe(capacityBytes - payload.size());
+
+    SaveBlobToFile(directory / fileName, payload);
+    entries[fileName] = Entry{
+        .ContentHash = contentHash,
+        .Size        = payload.size(),
+        .LastAccess  = ++accessCounter};
+
+    statistics.TotalBytes += payload.size();
+    statistics.NumOfEntries = entries.size();
+}
+
+void TranscodedTextureCache::Invalidate(const uint64_t contentHash)
+{
+    std::lock_guard          lock{mutex};
+    std::vector<std::string> invalidated;
+    for (const auto& [fileName, entry] : entries)
+    {
+        if (entry.ContentHash == contentHash)
+        {
+            invalidated.emplace_back(fileName);
+        }
+    }
+
+    for (const auto& fileName : invalidated)
+    {
+        RemoveUnsafe(fileName);
+    }
+}
+
+void TranscodedTextureCache::Clear()
+{
+    std::lock_guard lock{mutex};
+    PruneUnsafe(0);
+    SaveIndexUnsafe();
+}
+
+void TranscodedTextureCache::SetCapacity(const size_t newCapacityBytes)
+{
+    std::lock_guard lock{mutex};
+    capacityBytes = newCapacityBytes;
+    PruneUnsafe(capacityBytes);
+}
+
+void TranscodedTextureCache::Flush()
+{
+    std::lock_guard lock{mutex};
+    SaveIndexUnsafe();
+}
+
+std::string TranscodedTextureCache::MakeFileName(const uint64_t contentHash, const VkFormat format)
+{
+    return std::format("{:016x}_{}.ktx2", contentHash, ToUnderlying(format));
+}
+
+bool TranscodedTextureCache::IsPayloadFileName(const std::string_view fileName)
+{
+    /** {content hash:016x}_{format}.ktx2 */
+    constexpr std::string_view Extension  = ".ktx2";
+    constexpr size_t           HashLength = 16;
+    if (fileName.size() <= HashLength + 1 + Extension.size() || !fileName.ends_with(Extension) || fileName[HashLength] != '_')
+    {
+        return false;
+    }
+
+    const std::string_view hash   = fileName.substr(0, HashLength);
+    const std::string_view format = fileName.substr(HashLength + 1, fileName.size() - HashLength - 1 - Extension.size());
+    return std::all_of(hash.begin(), hash.end(), [](const char ch) { return std::isxdigit(static_cast<unsigned char>(ch)) != 0; }) &&
+           std::all_of(format.begin(), format.end(), [](const char ch) { return std::isdigit(static_cast<unsigned char>(ch)) != 0; });
+}
+
+std::string TranscodedTextureCache::MakeSourceKey(const fs::path& source)
+{
+    return source.lexically_normal().generic_string();
+}
+
+void TranscodedTextureCache::LoadIndex()
+{
+    const fs::path indexPath = directory / IndexFileName;
+    if (!fs::exists(indexPath))
+    {
+        RemoveOrphanedPayloadsUnsafe();
+        return;
+    }
+
+    const json root    = LoadJsonFromFile(indexPath);
+    const auto version = ResolveValueFromJson(root, VersionKey, static_cast<uint32_t>(0));
+    if (version != CacheVersion)
+    {
+        spdlog::info("Transcoded texture cache version mismatch({} != {}), invalidate every entries.", version, CacheVersion);
+        RemoveOrphanedPayloadsUnsafe();
+        return;
+    }
+
+    accessCounter = ResolveValueFromJson(root, AccessCounterKey, static_cast<size_t>(0));
+    if (const auto sourcesItr = root.find(SourcesKey);
+        sourcesItr != root.end())
+    {
+        for (const auto& sourceJson : *sourcesItr)
+        {
+            const std::string path = sourceJson[PathKey];
+            const SourceStamp stamp{
+                .Size          = sourceJson[SizeKey],
+                .LastWriteTime = sourceJson[LastWriteTimeKey]};
+            sources[path] = Source{
+                .Stamp       = stamp,
+                .ContentHash = sourceJson[ContentHashKey]};
+        }
+    }
+
+    if (const auto entriesItr = root.find(EntriesKey);
+        entriesItr != root.end())
+    {
+        for (const auto& entryJson : *entriesItr)
+        {
+            const std::string fileName = entryJson[FileKey];
+            if (!fs::exists(directory / fileName))
+            {
+                continue;
+            }
+
+            const Entry entry{
+                .ContentHash = entryJson[ContentHashKey],
+                .Size        = entryJson[SizeKey],
+                .LastAccess  = entryJson[LastAccessKey]};
+            statistics.TotalBytes += entry.Size;
+            entries[fileName] = entry;
+        }
+    }
+
+    statistics.NumOfEntries = entries.size();
+    RemoveOrphanedPayloadsUnsafe();
+    PruneUnsafe(capacityBytes);
+}
+
+void TranscodedTextureCache::RemoveOrphanedPayloadsUnsafe()
+{
+    std::vector<fs::path> orphans;
+    for (const auto& dirEntry : fs::directory_iterator(directory))
+    {
+        const std::string fileName = dirEntry.path().filename().string();
+        if (dirEntry.is_regular_file() && IsPayloadFileName(fileName) && !entries.contains(fileName))
+        {
+            orphans.emplace_back(dirEntry.path());
+        }
+    }
+
+    for (const fs::path& orphan : orphans)
+    {
+        std::error_code errorCode;
+        fs::remove(orphan, errorCode);
+    }
+}
+
+void TranscodedTextureCache::SaveIndexUnsafe() const
+{
+    json root;
+    root[VersionKey]       = CacheVersion;
+    root[AccessCounterKey] = accessCounter;
+
+    json entriesJson = json::array();
+    for (const auto& [fileName, entry] : entries)
+    {
+        json entryJson;
+        entryJson[FileKey]        = fileName;
+        entryJson[ContentHashKey] = entry.ContentHash;
+        entryJson[SizeKey]        = entry.Size;
+        entryJson[LastAccessKey]  = entry.LastAccess;
+        entriesJson.emplace_back(std::move(entryJson));
+    }
+    root[EntriesKey] = std::move(entriesJson);
+
+    json sourcesJson = json::array();
+    for (const auto& [path, source] : sources)
+    {
+        json sourceJson;
+        sourceJson[PathKey]          = path;
+        sourceJson[SizeKey]          = source.Stamp.Size;
+        sourceJson[LastWriteTimeKey] = source.Stamp.LastWriteTime;
+        sourceJson[ContentHashKey]   = source.ContentHash;
+        sourcesJson.emplace_back(std::move(sourceJson));
+    }
+    root[SourcesKey] = std::move(sourcesJson);
+
+    SaveJsonToFile(directory / IndexFileName, root);
+}
+
+void TranscodedTextureCache::PruneUnsafe(const size_t targetBytes)
+{
+    if (statistics.TotalBytes <= targetBytes)
+    {
+        return;
+    }
+
+    using Candidate = std::pair<std::string, size_t>;
+    std::vector<Candidate> candidates;
+    candidates.reserve(entries.size());
+    for (const auto& [fileName, entry] : entries)
+    {
+        candidates.emplace_back(fileName, entry.LastAccess);
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate& lhs, const Candidate& rhs) {
+                  return lhs.second < rhs.second;
+              });
+
+    for (const auto& [fileName, lastAccess] : candidates)
+    {
+        if (statistics.TotalBytes <= targetBytes)
+        {
+            break;
+        }
+
+        RemoveUnsafe(fileName);
+        ++statistics.Evictions;
+    }
+}
+
+void TranscodedTextureCache::RemoveUnsafe(const std::string& fileName)
+{
+    const auto itr = entries.find(fileName);
+    if (itr != entries.end())
+    {
+        statistics.TotalBytes -= itr->second.Size;
+        entries.erase(itr);
+        statistics.NumOfEntries = entries.size();
+
+        std::error_code errorCode;
+        fs::remove(directory / fileName, errorCode);
+    }
+}
+} // namespace sy::asset
@@ -0,0 +1,97 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::asset
+{
+/**
+ * Persistent cache of post-transcode KTX2 payloads.
+ * Entry is keyed by content hash of source KTX2 file and target VkFormat, so modified source never hits stale entry.
+ * Content hash of each source is recorded with its size and last write time, so unmodified source is not read and hashed again.
+ * Total size of cache is capped, least recently used entries are pruned first.
+ */
+class TranscodedTextureCache : public NonCopyable
+{
+public:
+    /** Increase when layout of cached payload changed, every entries of previous version will be invalidated. */
+    static constexpr uint32_t CacheVersion = 1;
+
+    struct Statistics
+    {
+        size_t Hits         = 0;
+        size_t Misses       = 0;
+        size_t Evictions    = 0;
+        size_t TotalBytes   = 0;
+        size_t NumOfEntries = 0;
+        /** Source hashed again because it was not recorded or its stamp mismatched. */
+        size_t SourceHashes = 0;
+    };
+
+    struct SourceStamp
+    {
+        uint64_t Size          = 0;
+        int64_t  LastWriteTime = 0;
+
+        [[nodiscard]] bool operator==(const SourceStamp&) const = default;
+    };
+
+public:
+    TranscodedTextureCache(fs::path directory, size_t capacityBytes);
+    ~TranscodedTextureCache() override;
+
+    [[nodiscard]] static uint64_t HashContent(std::span<const uint8_t> content);
+    /** Returns empty if the source does not exist. */
+    [[nodiscard]] static std::optional<SourceStamp> QuerySourceStamp(const fs::path& source);
+
+    /** Returns recorded content hash of the source only if the stamp is still same. */
+    [[nodiscard]] std::optional<uint64_t> FindContentHash(const fs::path& source, const SourceStamp& stamp) const;
+    void                                  RecordContentHash(const fs::path& source, const SourceStamp& stamp, uint64_t contentHash);
+
+    /** Returns path of cached payload if exist. It also marks entry as recently used. */
+    [[nodiscard]] std::optional<fs::path> Find(uint64_t contentHash, VkFormat format);
+    void                                  Store(uint64_t contentHash, VkFormat format, std::span<const uint8_t> payload);
+    void                                  Invalidate(uint64_t contentHash);
+    void                                  Clear();
+
+    void SetCapacity(size_t newCapacityBytes);
+    void Flush();
+
+    [[nodiscard]] const fs::path&   GetDirectory() const { return directory; }
+    [[nodiscard]] size_t            GetCapacity() const { return capacityBytes; }
+    [[nodiscard]] const Statistics& GetStatistics() const { return statistics; }
+
+private:
+    struct Entry
+    {
+        uint64_t ContentHash = 0;
+        size_t   Size        = 0;
+        size_t   LastAccess  = 0;
+    };
+
+    struct Source
+    {
+        SourceStamp Stamp;
+        uint64_t    ContentHash = 0;
+    };
+
+    [[nodiscard]] static std::string MakeFileName(uint64_t contentHash, VkFormat format);
+    [[nodiscard]] static bool        IsPayloadFileName(std::string_view fileName);
+    [[nodiscard]] static std::string MakeSourceKey(const fs::path& source);
+
+    void LoadIndex();
+    /** Payloads which are not in the index(ex. stored before crash) are never pruned, so they are removed on load. */
+    void RemoveOrphanedPayloadsUnsafe();
+    void SaveIndexUnsafe() const;
+    void PruneUnsafe(size_t targetBytes);
+    void RemoveUnsafe(const std::string& fileName);
+
+private:
+    const fs::path                                 directory;
+    size_t                                         capacityBytes;
+    size_t                                         accessCounter = 0;
+    Statistics                                     statistics;
+    robin_hood::unordered_map<std::string, Entry>  entries;
+    /** Sources are never pruned; they are tiny and stale one is simply overwritten. */
+    robin_hood::unordered_map<std::string, Source> sources;
+    mutable std::mutex                             mutex;
+};
+} // namespace sy::asset
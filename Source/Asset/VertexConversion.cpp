@@ -0,0 +1,31 @@
+#include <PCH.h>
+#include <Asset/VertexConversion.h>
+
+namespace sy::asset
+{
+render::VertexBounds CalculateVertexBounds(const aiMesh& mesh)
+{
+    if (mesh.mNumVertices == 0 || mesh.mVertices == nullptr)
+    {
+        return {};
+    }
+
+    const aiVector3D&    first = mesh.mVertices[0];
+    render::VertexBounds bounds{.Min = glm::vec3{first.x, first.y, first.z}, .Max = glm::vec3{first.x, first.y, first.z}};
+    for (const aiVector3D& vertex : std::span{mesh.mVertices, mesh.mNumVertices})
+    {
+        const glm::vec3 position{vertex.x, vertex.y, vertex.z};
+        bounds.Min = glm::min(bounds.Min, position);
+        bounds.Max = glm::max(bounds.Max, position);
+    }
+
+    return bounds;
+}
+
+void ConvertVertices(const render::EVertexType type, const aiMesh& mesh, const render::VertexBounds& bounds, const std::span<uint8_t> dst)
+{
+    render::VisitVertexType(type, [&]<typename VertexType>(std::type_identity<VertexType>) {
+        ConvertVertices<VertexType>(mesh, bounds, dst);
+    });
+}
+} // namespace sy::asset
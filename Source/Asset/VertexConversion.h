@@ -0,0 +1,63 @@
+#pragma once
+#include <PCH.h>
+#include <Render/Vertex.h>
+
+namespace sy::asset
+{
+[[nodiscard]] render::VertexBounds CalculateVertexBounds(const aiMesh& mesh);
+
+/**
+* Convert vertices of assimp mesh into vertex type.
+* Kernel is generated from render::VertexLayout at compile-time; each attribute converted by its own tight loop without any runtime attribute lookups.
+* Attributes which aren't exist in the source mesh are left untouched. (Destination expected to be zero initialized)
+*/
+template <typename VertexType>
+void ConvertVertices(const aiMesh& mesh, const render::VertexBounds& bounds, const std::span<uint8_t> dst)
+{
+    const size_t numVertices = mesh.mNumVertices;
+    SY_ASSERT(dst.size() == sizeof(VertexType) * numVertices, "Size of destination mismatch.");
+
+    VertexType* vertices = reinterpret_cast<VertexType*>(dst.data());
+    render::ForEachVertexAttribute<VertexType>([&]<typename Attribute>(Attribute, uint32_t) {
+        const auto convert = [&](const auto* source, const auto toGlm) {
+            if (source == nullptr)
+            {
+                return;
+            }
+
+            for (size_t idx = 0; idx < numVertices; ++idx)
+            {
+                vertices[idx].*Attribute::Member = Attribute::Encode(toGlm(source[idx]), bounds);
+            }
+        };
+
+        constexpr auto toVec3 = [](const aiVector3D& vector) { return glm::vec3{vector.x, vector.y, vector.z}; };
+        if constexpr (Attribute::Type == render::EVertexAttributeType::Color)
+        {
+            convert(mesh.mColors[0], [](const aiColor4D& color) { return glm::vec4{color.r, color.g, color.b, color.a}; });
+        }
+        else if constexpr (Attribute::Type == render::EVertexAttributeType::Position)
+        {
+            convert(mesh.mVertices, toVec3);
+        }
+        else if constexpr (Attribute::Type == render::EVertexAttributeType::TexCoords0)
+        {
+            convert(mesh.mTextureCoords[0], [](const aiVector3D& texCoords) { return glm::vec2{texCoords.x, texCoords.y}; });
+        }
+        else if constexpr (Attribute::Type == render::EVertexAttributeType::Normal)
+        {
+            convert(mesh.mNormals, toVec3);
+        }
+        else if constexpr (Attribute::Type == render::EVertexAttributeType::Bitangent)
+        {
+            convert(mesh.mBitangents, toVec3);
+        }
+        else if constexpr (Attribute::Type == render::EVertexAttributeType::Tangent)
+        {
+            convert(mesh.mTangents, toVec3);
+        }
+    });
+}
+
+void ConvertVertices(render::EVertexType type, const aiMesh& mesh, const render::VertexBounds& bounds, std::span<uint8_t> dst);
+} // namespace sy::asset
@@ -36,6 +36,35 @@ bool CommandLineParser::Argument(const char* argument)
         return true;
 	}
 
+    if (lstrcmpA(argument, "-disable_descriptor_buffer") == 0)
+    {
+        spdlog::info("Disabled: Descriptor buffer");
+        bDisableDescriptorBuffer = true;
+        return true;
+    }
+
+    if (lstrcmpA(argument, "-execute_render_graph") == 0)
+    {
+        spdlog::info("Enabled: Render graph execution");
+        bExecuteRenderGraph = true;
+        return true;
+    }
+
+    constexpr std::string_view SimulateScheduleArgument = "-simulate_schedule=";
+    constexpr std::string_view NodeCostsArgument        = "-node_costs=";
+    const std::string_view     argumentView{argument};
+    if (argumentView.starts_with(SimulateScheduleArgument))
+    {
+        scheduleSimulationPath = argumentView.substr(SimulateScheduleArgument.size());
+        return true;
+    }
+
+    if (argumentView.starts_with(NodeCostsArgument))
+    {
+        nodeCostsPath = argumentView.substr(NodeCostsArgument.size());
+        return true;
+    }
+
     return false;
 }
 } // namespace sy
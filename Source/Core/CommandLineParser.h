@@ -28,6 +28,29 @@ public:
         return bForceReimportAssets;
     }
 
+    /** Forces descriptor set backend of bindless descriptors even if descriptor buffer is supported. */
+    [[nodiscard]] auto IsDescriptorBufferDisabled() const noexcept
+    {
+        return bDisableDescriptorBuffer;
+    }
+
+    /** Schedule dump of render graph to simulate without launching application. Empty if not requested. */
+    [[nodiscard]] const auto& GetScheduleSimulationPath() const noexcept
+    {
+        return scheduleSimulationPath;
+    }
+
+    [[nodiscard]] const auto& GetNodeCostsPath() const noexcept
+    {
+        return nodeCostsPath;
+    }
+
+    /** Submits render graph on its queues every frame, before the render pass. */
+    [[nodiscard]] auto IsRenderGraphExecutionEnabled() const noexcept
+    {
+        return bExecuteRenderGraph;
+    }
+
 
 private:
     bool Argument(const char* argument);
@@ -35,7 +58,11 @@ private:
 private:
     fs::path executablePath;
     fs::path assetPath;
-    bool     bImportAssets        = false;
-    bool     bForceReimportAssets = false;
+    bool     bImportAssets            = false;
+    bool     bForceReimportAssets     = false;
+    bool     bDisableDescriptorBuffer = false;
+    bool     bExecuteRenderGraph      = false;
+    fs::path scheduleSimulationPath;
+    fs::path nodeCostsPath;
 };
 } // namespace sy
@@ -9,4 +9,7 @@ constexpr std::string_view DefaultBlackTexture     = "Engine/BlackTexture";
 constexpr std::string_view DefaultMaterialInstance = "Engine/DefaultMaterialInstance";
 /** Min: Linear, Mag: Linear, Mip: Linear, AddressModeUVW = Repeat */
 constexpr std::string_view TrilinearRepeatSampler  = "Engine/TrilinearRepeatSampler";
+constexpr std::string_view TextureResidencyManager = "Engine/TextureResidencyManager";
+constexpr std::string_view TextureTranscodeTable   = "Engine/TextureTranscodeTable";
+constexpr std::string_view TranscodedTextureCache  = "Engine/TranscodedTextureCache";
 }
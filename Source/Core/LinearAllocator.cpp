@@ -0,0 +1,35 @@
+#include <PCH.h>
+#include <Core/LinearAllocator.h>
+
+namespace sy
+{
+LinearAllocator::LinearAllocator(const size_t capacity) :
+    capacity(capacity)
+{
+}
+
+std::optional<size_t> LinearAllocator::Allocate(const size_t size, const size_t alignment)
+{
+    SY_ASSERT(alignment > 0, "Alignment must be greater than zero.");
+    size_t current = cursor.load(std::memory_order_relaxed);
+    size_t offset  = 0;
+    do
+    {
+        offset = ((current + alignment - 1) / alignment) * alignment;
+        if (offset + size > capacity)
+        {
+            numFailedAllocations.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+    } while (!cursor.compare_exchange_weak(current, offset + size, std::memory_order_relaxed));
+
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+    return offset;
+}
+
+void LinearAllocator::Reset()
+{
+    highWaterMark = GetHighWaterMark();
+    cursor.store(0, std::memory_order_relaxed);
+}
+} // namespace sy
@@ -0,0 +1,35 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy
+{
+/**
+ * Thread-safe bump allocator over offsets in [0, capacity). It does not own memory; offsets are mapped to storage by the owner.
+ * Allocation is a single compare-exchange on the cursor, and every allocations are released at once by Reset.
+ * Alignment does not have to be power of two, so allocation aligned to sizeof(T) can be addressed as element of T array.
+ */
+class LinearAllocator final : public NonCopyable
+{
+public:
+    explicit LinearAllocator(size_t capacity);
+
+    /** Returns empty if there is no space left until Reset. */
+    [[nodiscard]] std::optional<size_t> Allocate(size_t size, size_t alignment);
+    /** Must not be called concurrently with Allocate. */
+    void Reset();
+
+    [[nodiscard]] size_t GetCapacity() const { return capacity; }
+    [[nodiscard]] size_t GetUsedBytes() const { return std::min(cursor.load(std::memory_order_relaxed), capacity); }
+    /** Highest used bytes between resets. */
+    [[nodiscard]] size_t GetHighWaterMark() const { return std::max(highWaterMark, GetUsedBytes()); }
+    [[nodiscard]] size_t GetNumAllocations() const { return numAllocations.load(std::memory_order_relaxed); }
+    [[nodiscard]] size_t GetNumFailedAllocations() const { return numFailedAllocations.load(std::memory_order_relaxed); }
+
+private:
+    const size_t        capacity;
+    std::atomic<size_t> cursor               = 0;
+    std::atomic<size_t> numAllocations       = 0;
+    std::atomic<size_t> numFailedAllocations = 0;
+    size_t              highWaterMark        = 0;
+};
+} // namespace sy
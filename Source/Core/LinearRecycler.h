@@ -0,0 +1,50 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy
+{
+/**
+ * Hands out owned objects in order from a cursor, and Reset rewinds the cursor so every objects are reused from the beginning.
+ * There is no individual release; objects are only recycled in bulk, so each of them must be safe to reuse at Reset.
+ * Objects are created in chunks which grow geometrically, and they live until the recycler is destroyed.
+ * It is not thread-safe; keep one recycler per thread.
+ */
+template <typename T>
+class LinearRecycler final : public NonCopyable
+{
+public:
+    explicit LinearRecycler(const size_t minChunkSize) :
+        minChunkSize(minChunkSize)
+    {
+        SY_ASSERT(minChunkSize > 0, "Chunk size must be greater than zero.");
+    }
+
+    /** ChunkAllocator(size_t count, std::vector<std::unique_ptr<T>>& objects) appends count of new objects. */
+    template <typename ChunkAllocator>
+    [[nodiscard]] T& Request(ChunkAllocator&& allocateChunk)
+    {
+        if (cursor == objects.size())
+        {
+            const size_t numChunkObjects = std::max(minChunkSize, objects.size());
+            objects.reserve(objects.size() + numChunkObjects);
+            allocateChunk(numChunkObjects, objects);
+            SY_ASSERT(objects.size() > cursor, "Chunk allocator did not append any objects.");
+            ++numChunks;
+        }
+
+        return *objects[cursor++];
+    }
+
+    void Reset() { cursor = 0; }
+
+    [[nodiscard]] size_t GetNumRequested() const { return cursor; }
+    [[nodiscard]] size_t GetNumAllocated() const { return objects.size(); }
+    [[nodiscard]] size_t GetNumChunks() const { return numChunks; }
+
+private:
+    const size_t                    minChunkSize;
+    size_t                          cursor    = 0;
+    size_t                          numChunks = 0;
+    std::vector<std::unique_ptr<T>> objects;
+};
+} // namespace sy
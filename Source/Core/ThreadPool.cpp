@@ -0,0 +1,95 @@
+#include <PCH.h>
+#include <Core/ThreadPool.h>
+
+namespace sy
+{
+/** Pool whose task is running on this thread. */
+static thread_local const ThreadPool* runningPool = nullptr;
+
+ThreadPool::ThreadPool(const size_t numWorkers)
+{
+    workers.reserve(numWorkers);
+    for (size_t idx = 0; idx < numWorkers; ++idx)
+    {
+        workers.emplace_back([this](const std::stop_token stopToken) { WorkerLoop(stopToken); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    for (auto& worker : workers)
+    {
+        worker.request_stop();
+    }
+    jobCv.notify_all();
+    workers.clear();
+}
+
+void ThreadPool::ParallelFor(const size_t count, const std::function<void(size_t)>& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (workers.empty() || count == 1 || runningPool == this)
+    {
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            task(idx);
+        }
+        return;
+    }
+
+    std::lock_guard callerLock{callerMutex};
+    auto            job = std::make_shared<Job>(std::cref(task), count);
+    {
+        std::lock_guard lock{mutex};
+        currentJob = job;
+        ++generation;
+    }
+    jobCv.notify_all();
+
+    Run(*job);
+
+    std::unique_lock lock{mutex};
+    doneCv.wait(lock, [&job]() { return job->NumCompleted.load(std::memory_order_acquire) == job->Count; });
+    currentJob.reset();
+}
+
+void ThreadPool::WorkerLoop(const std::stop_token stopToken)
+{
+    size_t lastGeneration = 0;
+    while (!stopToken.stop_requested())
+    {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock lock{mutex};
+            if (!jobCv.wait(lock, stopToken, [this, &lastGeneration]() { return generation != lastGeneration && currentJob != nullptr; }))
+            {
+                break;
+            }
+
+            lastGeneration = generation;
+            job            = currentJob;
+        }
+
+        Run(*job);
+    }
+}
+
+void ThreadPool::Run(Job& job)
+{
+    const ThreadPool* const outerPool = std::exchange(runningPool, this);
+    for (size_t idx = job.NextIdx.fetch_add(1, std::memory_order_relaxed); idx < job.Count; idx = job.NextIdx.fetch_add(1, std::memory_order_relaxed))
+    {
+        job.Task.get()(idx);
+        if (job.NumCompleted.fetch_add(1, std::memory_order_acq_rel) + 1 == job.Count)
+        {
+            std::lock_guard lock{mutex};
+            doneCv.notify_all();
+        }
+    }
+    runningPool = outerPool;
+}
+} // namespace sy
@@ -0,0 +1,49 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy
+{
+/**
+ * Fixed size worker pool for fork-join style parallel loops.
+ * Caller thread also participates to the loop, so pool with N workers runs loop on N+1 threads.
+ */
+class ThreadPool final : public NonCopyable
+{
+public:
+    explicit ThreadPool(size_t numWorkers);
+    ~ThreadPool() override;
+
+    /**
+     * Invoke task for every index in [0, count) and blocks until all of them are completed.
+     * Nested call from task of the same pool runs serially on the calling thread, so pool can be shared by nested recorders.
+     * Calls from multiple outside threads are serialized; each call waits until loops of other callers are completed.
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    [[nodiscard]] size_t GetNumWorkers() const { return workers.size(); }
+    [[nodiscard]] size_t GetNumThreads() const { return workers.size() + 1; }
+
+private:
+    struct Job
+    {
+        Ref<const std::function<void(size_t)>> Task;
+        size_t                                 Count;
+        std::atomic<size_t>                    NextIdx      = 0;
+        std::atomic<size_t>                    NumCompleted = 0;
+    };
+
+    void WorkerLoop(std::stop_token stopToken);
+    void Run(Job& job);
+
+private:
+    /** Pool runs single job at a time, so outside callers take turns. */
+    std::mutex                  callerMutex;
+    std::mutex                  mutex;
+    std::condition_variable_any jobCv;
+    std::condition_variable     doneCv;
+    std::shared_ptr<Job>        currentJob;
+    size_t                      generation = 0;
+    /** Declared after synchronization primitives, so workers are joined before they are destroyed. */
+    std::vector<std::jthread>   workers;
+};
+} // namespace sy
@@ -122,6 +122,12 @@ consteval TypeHashType Hash()
 template <typename T>
 constexpr TypeHashType TypeHash = Hash<T>();
 
+/** Same as boost::hash_combine */
+constexpr size_t HashCombine(const size_t seed, const size_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
 /** Files */
 inline bool SaveJsonToFile(const fs::path& path, const nlohmann::json& json, const bool bReadableFormat = true, const bool bTruncExistFile = true)
 {
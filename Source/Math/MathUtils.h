@@ -19,4 +19,26 @@ constexpr bool IsPowOfTwo(const Extent3D<uint32_t> extent)
 {
     return IsPowOfTwo(extent.width) && (extent.width == extent.height) && (extent.height == extent.depth);
 }
+
+/** Half-float 2 component, compatible with VK_FORMAT_R16G16_SFLOAT */
+inline uint32_t PackHalf2(const glm::vec2 value)
+{
+    return glm::packHalf2x16(value);
+}
+
+/** Unit vector to 10-10-10-2 unorm(x in lowest bits), compatible with VK_FORMAT_A2B10G10R10_UNORM_PACK32. Decode: n = v.xyz * 2 - 1 */
+inline uint32_t PackUnitVector1010102(const glm::vec3 value)
+{
+    const float     length     = glm::length(value);
+    const glm::vec3 normalized = length > 0.f ? value / length : glm::vec3{0.f, 0.f, 1.f};
+    return glm::packUnorm3x10_1x2(glm::vec4{normalized * 0.5f + 0.5f, 0.f});
+}
+
+/** Position relative to bounds to 16-bit unorm, compatible with VK_FORMAT_R16G16B16A16_UNORM. Decode: p = v.xyz * extent + min */
+inline glm::u16vec4 QuantizePosition(const glm::vec3 position, const glm::vec3 boundsMin, const glm::vec3 boundsExtent)
+{
+    const glm::vec3 safeExtent = glm::max(boundsExtent, glm::vec3{std::numeric_limits<float>::epsilon()});
+    const glm::vec3 normalized = glm::clamp((position - boundsMin) / safeExtent, 0.f, 1.f);
+    return glm::u16vec4{glm::round(glm::vec4{normalized, 0.f} * 65535.f)};
+}
 } // namespace sy::math
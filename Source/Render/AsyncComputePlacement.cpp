@@ -0,0 +1,121 @@
+#include <PCH.h>
+#include <Render/AsyncComputePlacement.h>
+
+namespace sy::render
+{
+AsyncComputePlacement::Estimate AsyncComputePlacement::Evaluate(const std::span<const Node> nodes, const std::span<const vk::EQueueType> queues, const Config& config)
+{
+    SY_ASSERT(nodes.size() == queues.size(), "Every nodes must have its queue.");
+
+    constexpr int64_t NotSynchronized = -1;
+    using SyncIndices                 = std::array<int64_t, NumQueues>;
+
+    /** Latest execution index of each queue which the queue already synchronized with. */
+    std::array<SyncIndices, NumQueues> synchronized;
+    std::array<double, NumQueues>      queueAvailableAt{};
+    for (SyncIndices& indices : synchronized)
+    {
+        indices.fill(NotSynchronized);
+    }
+
+    Estimate            estimate;
+    std::vector<double> finishes(nodes.size());
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        const size_t queueIdx = ToUnderlying(queues[idx]);
+        double       start    = queueAvailableAt[queueIdx];
+
+        /** Node waits once per other queue, on the latest dependency of the queue; earlier ones are already completed by then. */
+        SyncIndices latestDependencies;
+        latestDependencies.fill(NotSynchronized);
+        for (const size_t dependency : nodes[idx].Dependencies)
+        {
+            SY_ASSERT(dependency < idx, "Dependency must be executed before dependent node.");
+            const size_t dependencyQueueIdx        = ToUnderlying(queues[dependency]);
+            latestDependencies[dependencyQueueIdx] = std::max(latestDependencies[dependencyQueueIdx], static_cast<int64_t>(dependency));
+            start                                  = std::max(start, finishes[dependency]);
+        }
+
+        for (size_t otherQueueIdx = 0; otherQueueIdx < NumQueues; ++otherQueueIdx)
+        {
+            const int64_t latestDependency = latestDependencies[otherQueueIdx];
+            if (otherQueueIdx != queueIdx && latestDependency > synchronized[queueIdx][otherQueueIdx])
+            {
+                synchronized[queueIdx][otherQueueIdx] = latestDependency;
+                start                                 = std::max(start, finishes[latestDependency] + config.SyncCostMs);
+                ++estimate.NumSyncPoints;
+            }
+        }
+
+        finishes[idx]              = start + nodes[idx].CostMs;
+        queueAvailableAt[queueIdx] = finishes[idx];
+        estimate.CriticalPathMs    = std::max(estimate.CriticalPathMs, finishes[idx]);
+    }
+
+    return estimate;
+}
+
+AsyncComputePlacement::Result AsyncComputePlacement::Solve(const std::span<const Node> nodes)
+{
+    return Solve(nodes, Config{});
+}
+
+AsyncComputePlacement::Result AsyncComputePlacement::Solve(const std::span<const Node> nodes, const Config& config)
+{
+    Result result;
+    result.Queues.reserve(nodes.size());
+    for (const Node& node : nodes)
+    {
+        SY_ASSERT(!node.bIsMovable || node.Queue == vk::EQueueType::Graphics || node.Queue == vk::EQueueType::Compute,
+                  "Only graphics or compute node can be moved.");
+        result.Queues.emplace_back(node.Queue);
+    }
+
+    result.Initial = Evaluate(nodes, result.Queues, config);
+    result.Placed  = result.Initial;
+
+    const auto toggle = [](const vk::EQueueType queue) {
+        return queue == vk::EQueueType::Compute ? vk::EQueueType::Graphics : vk::EQueueType::Compute;
+    };
+
+    for (size_t iteration = 0; iteration < config.MaxIterations; ++iteration)
+    {
+        std::optional<size_t> bestMove = std::nullopt;
+        Estimate              best     = result.Placed;
+        for (size_t idx = 0; idx < nodes.size(); ++idx)
+        {
+            if (!nodes[idx].bIsMovable)
+            {
+                continue;
+            }
+
+            result.Queues[idx]       = toggle(result.Queues[idx]);
+            const Estimate candidate = Evaluate(nodes, result.Queues, config);
+            result.Queues[idx]       = toggle(result.Queues[idx]);
+            if (candidate.CriticalPathMs < best.CriticalPathMs)
+            {
+                best     = candidate;
+                bestMove = idx;
+            }
+        }
+
+        if (!bestMove)
+        {
+            break;
+        }
+
+        result.Queues[*bestMove] = toggle(result.Queues[*bestMove]);
+        result.Placed            = best;
+    }
+
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        if (result.Queues[idx] != nodes[idx].Queue)
+        {
+            ++result.NumMovedNodes;
+        }
+    }
+
+    return result;
+}
+} // namespace sy::render
@@ -0,0 +1,58 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::render
+{
+/**
+ * CPU-only solver which decides which movable nodes run on async compute queue, to minimize estimated critical path.
+ * Nodes are given in execution order, and each queue executes its nodes in that order; so placement never reorders nodes.
+ * Wait on other queue is only counted when the queue does not already synchronized with the producer, as SSIS does.
+ * Solver greedily moves single node which reduces critical path the most until nothing improves. Candidates are visited in execution order
+ * and only strict improvement is accepted, so the result is deterministic.
+ */
+class AsyncComputePlacement
+{
+public:
+    constexpr static size_t NumQueues = magic_enum::enum_count<vk::EQueueType>();
+
+    struct Config
+    {
+        /** Cost of semaphore wait between queues, which is paid by every sync point. */
+        double SyncCostMs        = 0.05;
+        /** Cost of node which does not have estimate. */
+        double DefaultNodeCostMs = 0.1;
+        /** Upper bound of accepted moves. */
+        size_t MaxIterations     = 64;
+    };
+
+    struct Node
+    {
+        /** Execution indices of nodes which this node depends on. Must be smaller than index of this node. */
+        std::vector<size_t> Dependencies;
+        double              CostMs     = 0.0;
+        vk::EQueueType      Queue      = vk::EQueueType::Graphics;
+        /** Node can be executed on both of graphics and async compute queue. */
+        bool                bIsMovable = false;
+    };
+
+    struct Estimate
+    {
+        double CriticalPathMs = 0.0;
+        size_t NumSyncPoints  = 0;
+    };
+
+    struct Result
+    {
+        /** Indexed by execution index. */
+        std::vector<vk::EQueueType> Queues;
+        Estimate                    Initial;
+        Estimate                    Placed;
+        size_t                      NumMovedNodes = 0;
+    };
+
+public:
+    [[nodiscard]] static Estimate Evaluate(std::span<const Node> nodes, std::span<const vk::EQueueType> queues, const Config& config);
+    [[nodiscard]] static Result   Solve(std::span<const Node> nodes);
+    [[nodiscard]] static Result   Solve(std::span<const Node> nodes, const Config& config);
+};
+} // namespace sy::render
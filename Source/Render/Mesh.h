@@ -1,6 +1,7 @@
 #pragma once
 #include <PCH.h>
 #include <VK/BufferBuilder.h>
+#include <Render/Vertex.h>
 
 namespace sy::vk
 {
@@ -59,6 +60,10 @@ public:
 
 	[[nodiscard]] Handle<Material> GetMaterial() const { return material; }
 
+    /** Bounds of vertices in object space. Quantized positions are relative to it. */
+    [[nodiscard]] const VertexBounds& GetBounds() const { return bounds; }
+    void                              SetBounds(const VertexBounds& newBounds) { bounds = newBounds; }
+
 private:
     std::unique_ptr<vk::Buffer> vertexBuffer;
     std::unique_ptr<vk::Buffer> indexBuffer;
@@ -68,5 +73,6 @@ private:
 
 	// #todo Add Handle to Material
     Handle<Material> material;
+    VertexBounds     bounds;
 };
 } // namespace sy::render
@@ -1,144 +1,2153 @@
 #include <PCH.h>
 #include <Render/RenderGraph.h>
 #include <Render/RenderNode.h>
+#include <Render/RenderGraphSchedule.h>
 #include <VK/Texture.h>
+#include <VK/TextureView.h>
 #include <VK/Buffer.h>
+#include <VK/VulkanContext.h>
+#include <VK/VulkanRHI.h>
+#include <VK/CommandBuffer.h>
+#include <VK/TextureStateTransition.h>
+#include <VK/BufferStateTransition.h>
+#include <VK/Semaphore.h>
+#include <VK/Event.h>
+#include <VK/CommandPoolAllocator.h>
+#include <VK/CommandPool.h>
+#include <VK/FrameTracker.h>
+#include <VK/QueryPool.h>
+#include <Core/ThreadPool.h>
 
 namespace sy::render
 {
+template <typename StateType>
+static bool IsReadState(const StateType state)
+{
+    return state != StateType::None && state < StateType::EndOfRead;
+}
+
+static bool IsSameLayout(const vk::ETextureState lhs, const vk::ETextureState rhs)
+{
+    return vk::QueryAccessPattern(lhs).ImageLayout == vk::QueryAccessPattern(rhs).ImageLayout;
+}
+
+static bool IsSameLayout(const vk::EBufferState, const vk::EBufferState)
+{
+    return true;
+}
+
+/** Promote read states of readers at the same dependency level to single state which covers all of them. */
+static vk::ETextureState CombineReadStates(const vk::ETextureState lhs, const vk::ETextureState rhs)
+{
+    if (lhs == rhs)
+    {
+        return lhs;
+    }
+
+    constexpr VkAccessFlags2 ShaderReadAccess = VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+    const vk::AccessPattern  lhsPattern       = vk::QueryAccessPattern(lhs);
+    const vk::AccessPattern  rhsPattern       = vk::QueryAccessPattern(rhs);
+    const bool               bShaderReadsOnly = ((lhsPattern.Access | rhsPattern.Access) & ~ShaderReadAccess) == 0;
+    if (bShaderReadsOnly)
+    {
+        const bool bBothReadOnlyLayout = lhsPattern.ImageLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && rhsPattern.ImageLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        return bBothReadOnlyLayout ? vk::ETextureState::AnyShaderReadSampledImage : vk::ETextureState::AnyShaderReadGeneral;
+    }
+
+    return vk::ETextureState::General;
+}
+
+static vk::EBufferState CombineReadStates(const vk::EBufferState lhs, const vk::EBufferState rhs)
+{
+    if (lhs == rhs)
+    {
+        return lhs;
+    }
+
+    constexpr VkAccessFlags2 ShaderReadAccess = VK_ACCESS_2_UNIFORM_READ_BIT | VK_ACCESS_2_SHADER_READ_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+    const VkAccessFlags2     combinedAccess   = vk::QueryAccessPattern(lhs).Access | vk::QueryAccessPattern(rhs).Access;
+    if (combinedAccess == VK_ACCESS_2_UNIFORM_READ_BIT)
+    {
+        return vk::EBufferState::AnyShaderReadUniformBuffer;
+    }
+
+    return (combinedAccess & ~ShaderReadAccess) == 0 ? vk::EBufferState::AnyShaderReadGeneral : vk::EBufferState::General;
+}
+
+static bool IsColorAttachmentState(const vk::ETextureState state)
+{
+    return state == vk::ETextureState::ColorAttachmentRead || state == vk::ETextureState::ColorAttachmentAdvancedBlending ||
+           state == vk::ETextureState::ColorAttachmentWrite || state == vk::ETextureState::ColorAttachmentReadWrite;
+}
+
+static bool IsDepthStencilAttachmentState(const vk::ETextureState state)
+{
+    return state == vk::ETextureState::DepthStencilAttachmentRead || state == vk::ETextureState::DepthStencilAttachmentWrite ||
+           state == vk::ETextureState::DepthAttachmentWriteStencilReadOnly || state == vk::ETextureState::StencilAttachmentWriteDepthReadOnly;
+}
+
+/** Attachment reads are ordered with attachment writes by rasterization order, so they don't need any barrier inside of rendering scope. */
+static bool IsAttachmentReadState(const vk::ETextureState state)
+{
+    return state == vk::ETextureState::ColorAttachmentRead || state == vk::ETextureState::DepthStencilAttachmentRead;
+}
+
+/** Unknown extent(ex. imported texture which is not bound yet) is compatible with any extent. */
+static bool IsCompatibleAttachment(const RenderGraphTexture& lhs, const RenderGraphTexture& rhs)
+{
+    const auto queryExtent = [](const RenderGraphTexture& texture) -> std::optional<Extent3D<uint32_t>> {
+        if (texture.IsInstantiated())
+        {
+            return texture.GetInstance().GetExtent();
+        }
+
+        return texture.GetBuilder().GetExtent();
+    };
+
+    const auto lhsExtent = queryExtent(lhs);
+    const auto rhsExtent = queryExtent(rhs);
+    if (lhsExtent && rhsExtent && (lhsExtent->width != rhsExtent->width || lhsExtent->height != rhsExtent->height))
+    {
+        return false;
+    }
+
+    return lhs.GetBuilder().GetSampleCount() == rhs.GetBuilder().GetSampleCount();
+}
+
 // #todo clean up and simplify all things!!
 RenderGraph::RenderGraph(vk::VulkanContext& vulkanContext) :
     vulkanContext(vulkanContext)
 {
 }
 
-RenderGraph::~RenderGraph()
+RenderGraph::~RenderGraph()
+{
+    ReleaseTransientResources();
+}
+
+RenderGraphTexture& RenderGraph::GetOrCreateTexture(const std::string_view name)
+{
+    if (!textureMap.contains(name.data()))
+    {
+        textureMap[name.data()] = std::make_unique<RenderGraphTexture>(vulkanContext, name, numResources++);
+    }
+
+    return *textureMap.at(name.data());
+}
+
+RenderGraphBuffer& RenderGraph::GetOrCreateBuffer(std::string_view name)
+{
+    if (!bufferMap.contains(name.data()))
+    {
+        bufferMap[name.data()] = std::make_unique<RenderGraphBuffer>(vulkanContext, name, numResources++);
+    }
+
+    return *bufferMap.at(name.data());
+}
+
+void RenderGraph::RegisterNode(std::unique_ptr<RenderNode> node)
+{
+    SY_ASSERT(!nodeIdMap.contains(node->GetName().data()), "Node {} already exists in graph.", node->GetName());
+    node->SetId(GetNumNodes());
+    nodeIdMap[node->GetName().data()] = node->GetId();
+    nodes.emplace_back(std::move(node));
+}
+
+size_t RenderGraph::QueryQueueIndex(const vk::EQueueType queueType)
+{
+    const auto itr = std::find(SupportedQueues.cbegin(), SupportedQueues.cend(), queueType);
+    SY_ASSERT(itr != SupportedQueues.cend(), "Render graph does not support queue {}.", magic_enum::enum_name(queueType));
+    return static_cast<size_t>(std::distance(SupportedQueues.cbegin(), itr));
+}
+
+size_t RenderGraph::QueryQueueIndex(const RenderNode& node)
+{
+    return QueryQueueIndex(node.GetQueueType());
+}
+
+vk::EQueueType RenderGraph::QueryQueueType(const RenderNode& node)
+{
+    return node.GetQueueType();
+}
+
+void RenderGraph::CullNodes()
+{
+    /** Back to declaration order, so position of node is equal to its ID until topological sort. */
+    std::move(culledNodes.begin(), culledNodes.end(), std::back_inserter(nodes));
+    culledNodes.clear();
+    std::sort(nodes.begin(), nodes.end(),
+              [](const auto& lhs, const auto& rhs) {
+                  return lhs->GetId() < rhs->GetId();
+              });
+
+    cullingReport = {};
+
+    /** Walk backward from writers of outputs through read dependencies. History reads keep writers of previous frame alive. */
+    std::vector<bool>   bIsLive(nodes.size());
+    std::vector<size_t> pending;
+    for (const ResourceEdges& edges : compiled.Resources)
+    {
+        if ((edges.bIsExported || edges.bIsImported) && edges.Writer && !bIsLive[*edges.Writer])
+        {
+            bIsLive[*edges.Writer] = true;
+            pending.emplace_back(*edges.Writer);
+        }
+    }
+
+    if (pending.empty())
+    {
+        return;
+    }
+
+    while (!pending.empty())
+    {
+        const size_t nodeId = pending.back();
+        pending.pop_back();
+        for (const auto& reads : {std::cref(compiled.Nodes[nodeId].Reads), std::cref(compiled.Nodes[nodeId].HistoryReads)})
+        {
+            for (const size_t resourceId : reads.get())
+            {
+                const auto writerId = compiled.Resources[resourceId].Writer;
+                if (writerId && !bIsLive[*writerId])
+                {
+                    bIsLive[*writerId] = true;
+                    pending.emplace_back(*writerId);
+                }
+            }
+        }
+    }
+
+    /** Culled slots are left empty, so positions of live nodes still match its IDs. */
+    for (size_t nodeId = 0; nodeId < nodes.size(); ++nodeId)
+    {
+        if (!bIsLive[nodeId])
+        {
+            cullingReport.CulledNodes.emplace_back(nodes[nodeId]->GetName());
+            culledNodes.emplace_back(std::move(nodes[nodeId]));
+        }
+    }
+
+    for (ResourceEdges& edges : compiled.Resources)
+    {
+        const bool bHasLiveWriter = edges.Writer && bIsLive[*edges.Writer];
+        const bool bHasLiveReader = std::any_of(edges.Readers.cbegin(), edges.Readers.cend(), [&bIsLive](const size_t readerId) { return bIsLive[readerId]; }) ||
+                                    std::any_of(edges.HistoryReaders.cbegin(), edges.HistoryReaders.cend(), [&bIsLive](const size_t readerId) { return bIsLive[readerId]; });
+        const bool bHasAnyUser    = edges.Writer || !edges.Readers.empty() || !edges.HistoryReaders.empty();
+        edges.bIsCulled           = bHasAnyUser && !bHasLiveWriter && !bHasLiveReader;
+        cullingReport.NumCulledResources += edges.bIsCulled ? 1 : 0;
+    }
+}
+
+void RenderGraph::TopologicalSort()
+{
+    std::vector<size_t> sorted;
+    sorted.reserve(nodes.size());
+    std::vector<bool> visited(nodes.size());
+    std::vector<bool> onStack(nodes.size());
+
+    for (size_t nodeId = 0; nodeId < nodes.size(); ++nodeId)
+    {
+        if (nodes[nodeId] != nullptr)
+        {
+            DFS(nodeId, sorted, visited, onStack);
+        }
+    }
+
+    std::reverse(sorted.begin(), sorted.end());
+    nodes = Permute(std::move(nodes), sorted);
+    ComputeDependencyLevels();
+
+    /**
+     * Execute nodes level by level, so readers at the same dependency level are contiguous in execution order.
+     * Nodes of a level are grouped by queue, so same-level readers on a queue never interleave with readers on other queue.
+     * Declaration order is tie-breaker to keep execution order deterministic.
+     */
+    std::vector<size_t> levelOrder(nodes.size());
+    std::iota(levelOrder.begin(), levelOrder.end(), 0);
+    std::sort(levelOrder.begin(), levelOrder.end(),
+              [this](const size_t lhs, const size_t rhs) {
+                  const size_t         lhsLevel = nodes[lhs]->GetDependencyLevel();
+                  const size_t         rhsLevel = nodes[rhs]->GetDependencyLevel();
+                  const vk::EQueueType lhsQueue = QueryQueueType(*nodes[lhs]);
+                  const vk::EQueueType rhsQueue = QueryQueueType(*nodes[rhs]);
+                  if (lhsLevel != rhsLevel)
+                  {
+                      return lhsLevel < rhsLevel;
+                  }
+
+                  return lhsQueue != rhsQueue ? lhsQueue < rhsQueue : nodes[lhs]->GetId() < nodes[rhs]->GetId();
+              });
+    nodes = Permute(std::move(nodes), levelOrder);
+
+    compiled.ExecutionIndices.assign(GetNumNodes(), InvalidExecutionIndex);
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        compiled.ExecutionIndices[nodes[idx]->GetId()] = idx;
+    }
+}
+
+void RenderGraph::DFS(const size_t nodeId, std::vector<size_t>& sorted, std::vector<bool>& visited, std::vector<bool>& onStack) const
+{
+    SY_ASSERT(!onStack[nodeId], "Found circular dependency in graph.");
+    if (!visited[nodeId])
+    {
+        visited[nodeId] = true;
+        onStack[nodeId] = true;
+        for (const size_t resourceId : compiled.Nodes[nodeId].Writes)
+        {
+            for (const size_t readerId : compiled.Resources[resourceId].Readers)
+            {
+                if (nodes[readerId] != nullptr)
+                {
+                    DFS(readerId, sorted, visited, onStack);
+                }
+            }
+        }
+        onStack[nodeId] = false;
+        sorted.emplace_back(nodeId);
+    }
+}
+
+void RenderGraph::ComputeDependencyLevels()
+{
+    /** Longest path from read-independent nodes. Nodes must be topologically sorted. */
+    std::vector<size_t> dependencyLevels(GetNumNodes());
+    for (auto& node : nodes)
+    {
+        size_t dependencyLevel = 0;
+        for (const size_t resourceId : compiled.Nodes[node->GetId()].Reads)
+        {
+            const auto writerId = compiled.Resources[resourceId].Writer;
+            if (writerId)
+            {
+                dependencyLevel = std::max(dependencyLevel, dependencyLevels[*writerId] + 1);
+            }
+        }
+
+        dependencyLevels[node->GetId()] = dependencyLevel;
+        node->SetDependencyLevel(dependencyLevel);
+    }
+}
+
+size_t RenderGraph::QueryMaxDependencyLevel() const
+{
+    size_t maxDependencyLevel = 0;
+    for (const auto& node : nodes)
+    {
+        maxDependencyLevel = std::max(maxDependencyLevel, node->GetDependencyLevel());
+    }
+
+    return maxDependencyLevel;
+}
+
+RenderGraph::ECompileResult RenderGraph::Compile()
+{
+    const auto [structuralHash, parameterHash] = ComputeGraphHashes();
+    if (compiled.bIsValid && compiled.StructuralHash == structuralHash)
+    {
+        if (compiled.ParameterHash == parameterHash)
+        {
+            return ECompileResult::Cached;
+        }
+
+        /** Order and synchronization only depend on structure. Rendering scopes depend on access states, and scopes widen lifetimes. */
+        const auto previousLifetimes = QueryResourceLifetimes();
+        ComputeResourceLifetimes();
+        ScheduleStateTransitions();
+        BuildRenderingScopes();
+        BuildSplitBarriers();
+        /** Placements on transient heaps are only valid for lifetimes which they are packed with. */
+        if (transientMemoryRequirementsQuery && QueryResourceLifetimes() != previousLifetimes)
+        {
+            if (transientHeaps.empty())
+            {
+                PlanTransientResources(MemoryRequirementsQuery{transientMemoryRequirementsQuery});
+            }
+            else
+            {
+                AllocateTransientResources();
+            }
+        }
+        else
+        {
+            ResolveAliasingBarriers();
+        }
+        compiled.ParameterHash = parameterHash;
+        return ECompileResult::Incremental;
+    }
+
+    BuildCompiledEdges();
+    CullNodes();
+    TopologicalSort();
+    ComputeResourceLifetimes();
+    ScheduleStateTransitions();
+    InitSSIS();
+    BuildMinDependencyLevelSyncPoints();
+    BuildSubmitBatches();
+    BuildRenderingScopes();
+    BuildSplitBarriers();
+    compiled.StructuralHash = structuralHash;
+    compiled.ParameterHash  = parameterHash;
+    compiled.bIsValid       = true;
+
+    if (renderPassMergeReport.NumEliminatedScopes > 0)
+    {
+        spdlog::info("[RenderGraph] Merged {} rendering nodes into {} rendering scopes. (eliminated loads: {}, stores: {})",
+                     renderPassMergeReport.NumRenderingNodes,
+                     renderPassMergeReport.NumScopes,
+                     renderPassMergeReport.NumEliminatedLoads,
+                     renderPassMergeReport.NumEliminatedStores);
+    }
+
+    if (splitBarrierReport.NumSplitTransitions > 0)
+    {
+        spdlog::info("[RenderGraph] Split {} of {} transitions with {} events.",
+                     splitBarrierReport.NumSplitTransitions,
+                     splitBarrierReport.NumTransitions,
+                     splitBarrierReport.NumEvents);
+    }
+
+    if (!cullingReport.CulledNodes.empty())
+    {
+        spdlog::info("[RenderGraph] Culled {} nodes and {} resources which do not contribute to any output.",
+                     cullingReport.CulledNodes.size(),
+                     cullingReport.NumCulledResources);
+    }
+
+	for (size_t dl = 0; dl <= QueryMaxDependencyLevel(); ++dl)
+	{
+		if (!minDependencyLevelSyncPoints[dl].empty())
+		{
+            spdlog::info("Dependency Level {}, required to sync with below queues.", dl);
+            for (const size_t queueIdx : minDependencyLevelSyncPoints[dl])
+            {
+                spdlog::info("Q{}", queueIdx);
+            }
+		}
+	}
+
+    return ECompileResult::Full;
+}
+
+std::pair<size_t, size_t> RenderGraph::ComputeGraphHashes() const
+{
+    const std::hash<std::string_view> hasher;
+    enum class EAccess
+    {
+        Write = 1,
+        Read,
+        HistoryRead
+    };
+
+    const auto queryEdgeHashes = [this, &hasher](const std::string& resourceName, const std::string_view nodeName, const EAccess access) {
+        const auto hashOf = [&](const auto& resource, const size_t type) {
+            const size_t flags          = (resource.IsImported() ? 1 : 0) | (resource.IsExported() ? 2 : 0) | (resource.IsMultiBuffered() ? 4 : 0) | (resource.IsHistory() ? 8 : 0);
+            const size_t structuralHash = HashCombine(HashCombine(hasher(resourceName), type), flags);
+            const size_t parameterHash  = ToUnderlying(access == EAccess::Write  ? resource.GetWriterState() :
+                                                       access == EAccess::Read   ? resource.GetReaderState(nodeName) :
+                                                                                   resource.GetHistoryReaderState(nodeName));
+            return std::make_pair(HashCombine(structuralHash, ToUnderlying(access)), parameterHash);
+        };
+
+        if (const auto itr = textureMap.find(resourceName); itr != textureMap.end())
+        {
+            return hashOf(*itr->second, 1);
+        }
+
+        SY_ASSERT(bufferMap.contains(resourceName), "Invalid resource name {}.", resourceName);
+        return hashOf(*bufferMap.at(resourceName), 2);
+    };
+
+    /** Dependencies are unordered sets, so edges are sorted by its structural hash before combined. */
+    std::vector<std::pair<size_t, size_t>> nodeHashes(GetNumNodes());
+    std::vector<std::pair<size_t, size_t>> edgeHashes;
+    const auto                             hashNode = [&](const RenderNode& node) {
+        edgeHashes.clear();
+        for (const auto& resourceName : node.GetWriteDependencies())
+        {
+            edgeHashes.emplace_back(queryEdgeHashes(resourceName, node.GetName(), EAccess::Write));
+        }
+
+        for (const auto& resourceName : node.GetReadDependencies())
+        {
+            edgeHashes.emplace_back(queryEdgeHashes(resourceName, node.GetName(), EAccess::Read));
+        }
+
+        for (const auto& resourceName : node.GetHistoryReadDependencies())
+        {
+            edgeHashes.emplace_back(queryEdgeHashes(resourceName, node.GetName(), EAccess::HistoryRead));
+        }
+        std::sort(edgeHashes.begin(), edgeHashes.end());
+
+        size_t structuralHash = HashCombine(hasher(node.GetName()), QueryQueueIndex(node));
+        size_t parameterHash  = 0;
+        for (const auto [edgeStructuralHash, edgeParameterHash] : edgeHashes)
+        {
+            structuralHash = HashCombine(structuralHash, edgeStructuralHash);
+            parameterHash  = HashCombine(parameterHash, edgeParameterHash);
+        }
+
+        nodeHashes[node.GetId()] = {structuralHash, parameterHash};
+    };
+
+    for (const auto& node : nodes)
+    {
+        hashNode(*node);
+    }
+
+    for (const auto& node : culledNodes)
+    {
+        hashNode(*node);
+    }
+
+    size_t structuralHash = HashCombine(GetNumNodes(), numResources);
+    size_t parameterHash  = 0;
+    for (const auto [nodeStructuralHash, nodeParameterHash] : nodeHashes)
+    {
+        structuralHash = HashCombine(structuralHash, nodeStructuralHash);
+        parameterHash  = HashCombine(parameterHash, nodeParameterHash);
+    }
+
+    return {structuralHash, parameterHash};
+}
+
+void RenderGraph::BuildCompiledEdges()
+{
+    compiled.Nodes.clear();
+    compiled.Nodes.resize(GetNumNodes());
+    compiled.Resources.clear();
+    compiled.Resources.resize(numResources);
+
+    const auto resolve = [this](const auto& resource) {
+        ResourceEdges& edges = compiled.Resources[resource.GetId()];
+        edges.bIsImported    = resource.IsImported();
+        edges.bIsExported    = resource.IsExported();
+        if (resource.HasWriter())
+        {
+            if (const auto itr = nodeIdMap.find(resource.GetWriter().data()); itr != nodeIdMap.end())
+            {
+                edges.Writer = itr->second;
+                compiled.Nodes[itr->second].Writes.emplace_back(resource.GetId());
+            }
+        }
+
+        for (const auto& readerName : resource.GetReaders())
+        {
+            if (const auto itr = nodeIdMap.find(readerName); itr != nodeIdMap.end())
+            {
+                edges.Readers.emplace_back(itr->second);
+                compiled.Nodes[itr->second].Reads.emplace_back(resource.GetId());
+            }
+        }
+        std::sort(edges.Readers.begin(), edges.Readers.end());
+
+        /** History reads access instance of previous frame, so they do not make edges of DAG. Previous frame in flight is waited by state transitions. */
+        for (const auto& readerName : resource.GetHistoryReaders())
+        {
+            if (const auto itr = nodeIdMap.find(readerName); itr != nodeIdMap.end())
+            {
+                edges.HistoryReaders.emplace_back(itr->second);
+                compiled.Nodes[itr->second].HistoryReads.emplace_back(resource.GetId());
+            }
+        }
+        std::sort(edges.HistoryReaders.begin(), edges.HistoryReaders.end());
+    };
+
+    for (const auto& [name, texture] : textureMap)
+    {
+        resolve(*texture);
+    }
+
+    for (const auto& [name, buffer] : bufferMap)
+    {
+        resolve(*buffer);
+    }
+
+    for (auto& edges : compiled.Nodes)
+    {
+        std::sort(edges.Reads.begin(), edges.Reads.end());
+        std::sort(edges.Writes.begin(), edges.Writes.end());
+        std::sort(edges.HistoryReads.begin(), edges.HistoryReads.end());
+    }
+}
+
+void RenderGraph::ComputeResourceLifetimes()
+{
+    const auto computeLifetime = [this](auto& resource) {
+        const ResourceEdges&  edges    = compiled.Resources[resource.GetId()];
+        std::optional<size_t> firstUse = std::nullopt;
+        size_t                lastUse  = 0;
+        const auto            extend   = [&](const size_t nodeId) {
+            const size_t executionIdx = compiled.ExecutionIndices[nodeId];
+            if (executionIdx != InvalidExecutionIndex)
+            {
+                firstUse = std::min(firstUse.value_or(executionIdx), executionIdx);
+                lastUse  = std::max(lastUse, executionIdx);
+            }
+        };
+
+        if (edges.Writer)
+        {
+            extend(*edges.Writer);
+        }
+
+        for (const size_t readerId : edges.Readers)
+        {
+            extend(readerId);
+        }
+
+        resource.ClearLifetime();
+        if (firstUse)
+        {
+            /** Exported resource is consumed after graph, so it must not be aliased with any later resources. */
+            resource.SetLifetime(*firstUse, resource.IsExported() ? nodes.size() - 1 : lastUse);
+        }
+    };
+
+    for (auto& [name, texture] : textureMap)
+    {
+        computeLifetime(*texture);
+    }
+
+    for (auto& [name, buffer] : bufferMap)
+    {
+        computeLifetime(*buffer);
+    }
+}
+
+std::vector<std::optional<std::pair<size_t, size_t>>> RenderGraph::QueryResourceLifetimes() const
+{
+    std::vector<std::optional<std::pair<size_t, size_t>>> lifetimes(compiled.Resources.size());
+    const auto                                            queryLifetime = [&lifetimes](const auto& resource) {
+        if (resource.HasLifetime())
+        {
+            lifetimes[resource.GetId()] = std::make_pair(resource.GetFirstUse(), resource.GetLastUse());
+        }
+    };
+
+    for (const auto& [name, texture] : textureMap)
+    {
+        queryLifetime(*texture);
+    }
+
+    for (const auto& [name, buffer] : bufferMap)
+    {
+        queryLifetime(*buffer);
+    }
+
+    return lifetimes;
+}
+
+void RenderGraph::PlanTransientResources(const MemoryRequirementsQuery& queryMemoryRequirements)
+{
+    ReleaseTransientResources();
+    transientMemoryRequirementsQuery = queryMemoryRequirements;
+
+    std::vector<TransientResourceAliasing::Request> requests;
+    std::vector<QueueLifetime>                      lifetimes;
+    cullingReport.CulledTransientBytes = 0;
+    /**
+     * Imported resources are owned outside, and resources only used by culled nodes are never allocated.
+     * Instances of multi-buffered resource outlive the frame, so they own dedicated memory.
+     */
+    const auto appendRequest = [this, &requests, &lifetimes, &queryMemoryRequirements](const auto& resource) {
+        if (resource.IsImported())
+        {
+            return false;
+        }
+
+        const VkMemoryRequirements memoryRequirements = queryMemoryRequirements(resource.GetName());
+        if (!resource.HasLifetime())
+        {
+            cullingReport.CulledTransientBytes += compiled.Resources[resource.GetId()].bIsCulled ? memoryRequirements.size : 0;
+            return false;
+        }
+
+        if (resource.IsMultiBuffered())
+        {
+            return false;
+        }
+
+        requests.emplace_back(memoryRequirements.size, memoryRequirements.alignment, memoryRequirements.memoryTypeBits,
+                              resource.GetFirstUse(), resource.GetLastUse());
+        lifetimes.emplace_back(QueryQueueLifetime(resource));
+        return true;
+    };
+
+    /** Textures come first, then buffers. */
+    for (const auto& [name, texture] : textureMap)
+    {
+        if (appendRequest(*texture))
+        {
+            transientResourceNames.emplace_back(texture->GetName());
+        }
+    }
+
+    for (const auto& [name, buffer] : bufferMap)
+    {
+        if (appendRequest(*buffer))
+        {
+            transientResourceNames.emplace_back(buffer->GetName());
+        }
+    }
+
+    /** Resources on different queues may run at the same time even if their ranges of execution order are disjoint. */
+    transientMemoryReport = TransientResourceAliasing::Pack(requests,
+                                                            [this, &lifetimes](const size_t lhs, const size_t rhs) {
+                                                                return !IsCompletedBefore(lifetimes[lhs], lifetimes[rhs]) && !IsCompletedBefore(lifetimes[rhs], lifetimes[lhs]);
+                                                            });
+
+    for (size_t idx = 0; idx < requests.size(); ++idx)
+    {
+        const auto& placement = transientMemoryReport.Placements[idx];
+        for (size_t previousIdx = 0; previousIdx < requests.size(); ++previousIdx)
+        {
+            const auto& previousPlacement = transientMemoryReport.Placements[previousIdx];
+            const bool  bSharesMemory     = previousIdx != idx && previousPlacement.HeapIndex == placement.HeapIndex &&
+                                            previousPlacement.Offset < placement.Offset + requests[idx].Size &&
+                                            placement.Offset < previousPlacement.Offset + requests[previousIdx].Size;
+            if (bSharesMemory && IsCompletedBefore(lifetimes[previousIdx], lifetimes[idx]))
+            {
+                AliasingBarrier& aliasingBarrier = aliasingBarriers[transientResourceNames[idx]];
+                aliasingBarrier.Resource         = transientResourceNames[idx];
+                aliasingBarrier.Queue            = QueryQueueType(*nodes[lifetimes[idx].FirstUse]);
+                aliasingBarrier.PreviousResources.emplace_back(transientResourceNames[previousIdx]);
+            }
+        }
+    }
+    ResolveAliasingBarriers();
+}
+
+void RenderGraph::AllocateTransientResources()
+{
+    PlanTransientResources([this](const std::string_view resourceName) {
+        if (const auto textureItr = textureMap.find(resourceName.data()); textureItr != textureMap.end())
+        {
+            return textureItr->second->QueryMemoryRequirements();
+        }
+
+        return bufferMap.at(resourceName.data())->QueryMemoryRequirements();
+    });
+
+    const auto instantiateMultiBuffered = [](auto& resource) {
+        if (!resource.IsImported() && resource.HasLifetime() && resource.IsMultiBuffered())
+        {
+            resource.Instantiate();
+        }
+    };
+
+    for (auto& [name, texture] : textureMap)
+    {
+        instantiateMultiBuffered(*texture);
+    }
+
+    for (auto& [name, buffer] : bufferMap)
+    {
+        instantiateMultiBuffered(*buffer);
+    }
+
+    const VmaAllocator allocator = vulkanContext.GetRHI().GetAllocator();
+    for (const auto& heap : transientMemoryReport.Heaps)
+    {
+        const VkMemoryRequirements heapRequirements{
+            .size           = heap.Size,
+            .alignment      = heap.Alignment,
+            .memoryTypeBits = heap.MemoryTypeBits};
+
+        const VmaAllocationCreateInfo allocationCreateInfo{
+            .usage         = VMA_MEMORY_USAGE_GPU_ONLY,
+            .requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT};
+
+        VmaAllocation heapAllocation = VK_NULL_HANDLE;
+        VK_ASSERT(vmaAllocateMemory(allocator, &heapRequirements, &allocationCreateInfo, &heapAllocation, nullptr),
+                  "Failed to allocate render graph transient heap of {} bytes.", heap.Size);
+        transientHeaps.emplace_back(heapAllocation);
+    }
+
+    for (size_t idx = 0; idx < transientResourceNames.size(); ++idx)
+    {
+        const auto&        placement    = transientMemoryReport.Placements[idx];
+        const std::string& resourceName = transientResourceNames[idx];
+        if (const auto textureItr = textureMap.find(resourceName); textureItr != textureMap.end())
+        {
+            textureItr->second->Instantiate(transientHeaps[placement.HeapIndex], placement.Offset);
+        }
+        else
+        {
+            bufferMap.at(resourceName)->Instantiate(transientHeaps[placement.HeapIndex], placement.Offset);
+        }
+    }
+
+    spdlog::info("[RenderGraph] Transient memory: {} bytes without aliasing, {} bytes with aliasing on {} heaps. (peak alive {} bytes)",
+                 transientMemoryReport.BytesWithoutAliasing,
+                 transientMemoryReport.BytesWithAliasing,
+                 transientMemoryReport.Heaps.size(),
+                 transientMemoryReport.PeakLiveBytes);
+    if (cullingReport.CulledTransientBytes > 0)
+    {
+        spdlog::info("[RenderGraph] Culling saved {} bytes of transient memory.", cullingReport.CulledTransientBytes);
+    }
+}
+
+template <typename ResourceType>
+RenderGraph::QueueLifetime RenderGraph::QueryQueueLifetime(const ResourceType& resource) const
+{
+    QueueLifetime lifetime{.FirstUse = resource.GetFirstUse(), .LastUses = {}, .bIsExported = resource.IsExported()};
+    const auto    extend = [this, &lifetime](const size_t nodeId) {
+        const size_t executionIdx = compiled.ExecutionIndices[nodeId];
+        if (executionIdx == InvalidExecutionIndex)
+        {
+            return;
+        }
+
+        /** Resource stays alive until the end of rendering scope of its user. */
+        const auto        scope    = QueryRenderingScope(executionIdx);
+        const RenderNode& lastNode = *nodes[scope ? scope->get().LastNode : executionIdx];
+        auto&             lastUse  = lifetime.LastUses[QueryQueueIndex(lastNode)];
+        lastUse                    = std::max(lastUse.value_or(0), lastNode.GetSynchronizationIndex());
+    };
+
+    const ResourceEdges& edges = compiled.Resources[resource.GetId()];
+    if (edges.Writer)
+    {
+        extend(*edges.Writer);
+    }
+
+    for (const size_t readerId : edges.Readers)
+    {
+        extend(readerId);
+    }
+
+    return lifetime;
+}
+
+bool RenderGraph::IsCompletedBefore(const QueueLifetime& lhs, const QueueLifetime& rhs) const
+{
+    if (lhs.bIsExported)
+    {
+        return false;
+    }
+
+    /** Same queue is ordered by aliasing barrier. Last use on other queue must be already waited at first use. */
+    const RenderNode& firstNode = *nodes[rhs.FirstUse];
+    const size_t      queueIdx  = QueryQueueIndex(firstNode);
+    const size_t      syncIdx   = firstNode.GetSynchronizationIndex();
+    const SSIS&       ssis      = ssises[syncIdx - 1];
+    for (size_t lastUseQueueIdx = 0; lastUseQueueIdx < NumOfSupportedQueues; ++lastUseQueueIdx)
+    {
+        const auto lastUse = lhs.LastUses[lastUseQueueIdx];
+        if (lastUse && (lastUseQueueIdx == queueIdx ? *lastUse >= syncIdx : ssis.Now[lastUseQueueIdx] < *lastUse))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void RenderGraph::ResolveAliasingBarriers()
+{
+    for (auto& [name, aliasingBarrier] : aliasingBarriers)
+    {
+        aliasingBarrier.SourceStage  = VK_PIPELINE_STAGE_2_NONE;
+        aliasingBarrier.SourceAccess = VK_ACCESS_2_NONE;
+        for (const std::string& previousResource : aliasingBarrier.PreviousResources)
+        {
+            /** Stages of other queue may not be supported by this queue. */
+            const size_t       resourceId  = textureMap.contains(previousResource) ? textureMap.at(previousResource)->GetId() : bufferMap.at(previousResource)->GetId();
+            const FinalAccess& finalAccess = finalAccesses[resourceId];
+            if (finalAccess.Queue == aliasingBarrier.Queue)
+            {
+                aliasingBarrier.SourceStage |= finalAccess.Pattern.PipelineStage;
+                aliasingBarrier.SourceAccess |= finalAccess.Pattern.Access;
+            }
+        }
+    }
+}
+
+CRefOptional<RenderGraph::AliasingBarrier> RenderGraph::QueryAliasingBarrier(const std::string_view resourceName) const
+{
+    const auto itr = aliasingBarriers.find(resourceName.data());
+    if (itr == aliasingBarriers.end())
+    {
+        return std::nullopt;
+    }
+
+    return itr->second;
+}
+
+void RenderGraph::ReleaseTransientResources()
+{
+    for (auto& [name, texture] : textureMap)
+    {
+        texture->ReleaseInstance();
+    }
+
+    for (auto& [name, buffer] : bufferMap)
+    {
+        buffer->ReleaseInstance();
+    }
+
+    /** Aliased resources are destroyed by deferred deallocation, heaps must be freed after them. */
+    for (VmaAllocation heap : transientHeaps)
+    {
+        vulkanContext.EnqueueDeferredDeallocation(
+            [heap](const vk::VulkanRHI& rhi) {
+                vmaFreeMemory(rhi.GetAllocator(), heap);
+            });
+    }
+    transientHeaps.clear();
+    transientResourceNames.clear();
+    transientMemoryRequirementsQuery = nullptr;
+    aliasingBarriers.clear();
+    attachmentViews.clear();
+}
+
+template <typename StateType>
+static json SerializeStateTransitions(const std::span<const RenderGraph::ScheduledStateTransition<StateType>> transitions)
+{
+    namespace key = schedule_key;
+    json serialized = json::array();
+    for (const auto& transition : transitions)
+    {
+        json transitionJson;
+        transitionJson[key::Resource]         = transition.Resource;
+        transitionJson[key::Source]           = magic_enum::enum_name(transition.Source);
+        transitionJson[key::Destination]      = magic_enum::enum_name(transition.Destination);
+        transitionJson[key::SourceQueue]      = magic_enum::enum_name(transition.SourceQueue);
+        transitionJson[key::DestinationQueue] = magic_enum::enum_name(transition.DestinationQueue);
+        transitionJson[key::IsHistory]        = transition.bIsHistory;
+        transitionJson[key::IsAfterHistory]   = transition.bIsAfterHistory;
+        serialized.emplace_back(std::move(transitionJson));
+    }
+
+    return serialized;
+}
+
+static json SerializeRenderingAttachment(const RenderGraph::RenderingAttachment& attachment)
+{
+    namespace key = schedule_key;
+    json serialized;
+    serialized[key::Resource] = attachment.Resource;
+    serialized[key::State]    = magic_enum::enum_name(attachment.State);
+    serialized[key::LoadOp]   = magic_enum::enum_name(attachment.LoadOp);
+    serialized[key::StoreOp]  = magic_enum::enum_name(attachment.StoreOp);
+    return serialized;
+}
+
+json RenderGraph::BuildScheduleDump() const
+{
+    namespace key = schedule_key;
+    json root;
+    root[key::Version] = RenderGraphSchedule::Version;
+
+    json nodesJson = json::array();
+    for (size_t executionIdx = 0; executionIdx < nodes.size(); ++executionIdx)
+    {
+        const RenderNode& node    = *nodes[executionIdx];
+        const size_t      syncIdx = node.GetSynchronizationIndex();
+        const SSIS        ssis    = syncIdx > 0 && syncIdx <= ssises.size() ? ssises[syncIdx - 1] : SSIS{};
+
+        json nodeJson;
+        nodeJson[key::Name]                 = node.GetName();
+        nodeJson[key::ExecutionIndex]       = executionIdx;
+        nodeJson[key::Queue]                = magic_enum::enum_name(QueryQueueType(node));
+        nodeJson[key::DependencyLevel]      = node.GetDependencyLevel();
+        nodeJson[key::SynchronizationIndex] = syncIdx;
+        nodeJson[key::SSISNow]              = ssis.Now;
+        nodeJson[key::SSISNext]             = ssis.Next;
+        nodeJson[key::Batch]                = executionIdx < batchOfNode.size() ? json(batchOfNode[executionIdx]) : json();
+        nodeJson[key::RenderingScope]       = executionIdx < scopeOfNode.size() && scopeOfNode[executionIdx] ? json(*scopeOfNode[executionIdx]) : json();
+        if (executionIdx < nodeStateTransitions.size())
+        {
+            const NodeStateTransitions& transitions = nodeStateTransitions[executionIdx];
+            nodeJson[key::Textures]                 = SerializeStateTransitions<vk::ETextureState>(transitions.Textures);
+            nodeJson[key::Buffers]                  = SerializeStateTransitions<vk::EBufferState>(transitions.Buffers);
+            nodeJson[key::ReleaseTextures]          = SerializeStateTransitions<vk::ETextureState>(transitions.ReleaseTextures);
+            nodeJson[key::ReleaseBuffers]           = SerializeStateTransitions<vk::EBufferState>(transitions.ReleaseBuffers);
+            nodeJson[key::ReleasedBy]               = transitions.ReleasedBy;
+        }
+        nodesJson.emplace_back(std::move(nodeJson));
+    }
+    root[key::Nodes] = std::move(nodesJson);
+
+    json culledNodesJson = json::array();
+    for (const auto& node : culledNodes)
+    {
+        culledNodesJson.emplace_back(node->GetName());
+    }
+    root[key::CulledNodes] = std::move(culledNodesJson);
+
+    /** Sorted by resource ID, so dumps of the same graph are comparable. */
+    std::vector<std::pair<size_t, json>> resourcesJson;
+    const auto                           serializeResource = [&resourcesJson](const auto& resource, const std::string_view type) {
+        json resourceJson;
+        resourceJson[key::Name]         = resource.GetName();
+        resourceJson[key::Type]         = type;
+        resourceJson[key::IsImported]   = resource.IsImported();
+        resourceJson[key::IsExported]   = resource.IsExported();
+        resourceJson[key::IsHistory]    = resource.IsHistory();
+        resourceJson[key::NumInstances] = resource.GetNumInstances();
+        if (resource.HasLifetime())
+        {
+            resourceJson[key::FirstUse] = resource.GetFirstUse();
+            resourceJson[key::LastUse]  = resource.GetLastUse();
+        }
+
+        if (resource.HasWriter())
+        {
+            resourceJson[key::Writer]      = resource.GetWriter();
+            resourceJson[key::WriterState] = magic_enum::enum_name(resource.GetWriterState());
+        }
+
+        std::vector<std::string> readers{resource.GetReaders().begin(), resource.GetReaders().end()};
+        std::sort(readers.begin(), readers.end());
+        json readersJson = json::array();
+        for (const std::string& reader : readers)
+        {
+            json readerJson;
+            readerJson[key::Node]  = reader;
+            readerJson[key::State] = magic_enum::enum_name(resource.GetReaderState(reader));
+            readersJson.emplace_back(std::move(readerJson));
+        }
+        resourceJson[key::Readers] = std::move(readersJson);
+
+        std::vector<std::string> historyReaders{resource.GetHistoryReaders().begin(), resource.GetHistoryReaders().end()};
+        std::sort(historyReaders.begin(), historyReaders.end());
+        json historyReadersJson = json::array();
+        for (const std::string& reader : historyReaders)
+        {
+            json readerJson;
+            readerJson[key::Node]  = reader;
+            readerJson[key::State] = magic_enum::enum_name(resource.GetHistoryReaderState(reader));
+            historyReadersJson.emplace_back(std::move(readerJson));
+        }
+        resourceJson[key::HistoryReaders] = std::move(historyReadersJson);
+        resourcesJson.emplace_back(resource.GetId(), std::move(resourceJson));
+    };
+
+    for (const auto& [name, texture] : textureMap)
+    {
+        serializeResource(*texture, "Texture");
+    }
+
+    for (const auto& [name, buffer] : bufferMap)
+    {
+        serializeResource(*buffer, "Buffer");
+    }
+
+    std::sort(resourcesJson.begin(), resourcesJson.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    root[key::Resources] = json::array();
+    for (auto& [id, resourceJson] : resourcesJson)
+    {
+        root[key::Resources].emplace_back(std::move(resourceJson));
+    }
+
+    json batchesJson = json::array();
+    for (const SubmitBatch& batch : submitBatches)
+    {
+        json batchJson;
+        batchJson[key::Queue]       = magic_enum::enum_name(batch.Queue);
+        batchJson[key::Nodes]       = batch.Nodes;
+        batchJson[key::WaitBatches] = batch.WaitBatches;
+        batchesJson.emplace_back(std::move(batchJson));
+    }
+    root[key::Batches] = std::move(batchesJson);
+
+    json scopesJson = json::array();
+    for (const RenderingScope& scope : renderingScopes)
+    {
+        json scopeJson;
+        scopeJson[key::FirstNode] = scope.FirstNode;
+        scopeJson[key::LastNode]  = scope.LastNode;
+        json colorAttachmentsJson = json::array();
+        for (const RenderingAttachment& attachment : scope.ColorAttachments)
+        {
+            colorAttachmentsJson.emplace_back(SerializeRenderingAttachment(attachment));
+        }
+        scopeJson[key::ColorAttachments]       = std::move(colorAttachmentsJson);
+        scopeJson[key::DepthStencilAttachment] = scope.DepthStencilAttachment ? SerializeRenderingAttachment(*scope.DepthStencilAttachment) : json();
+        scopeJson[key::Textures]               = SerializeStateTransitions<vk::ETextureState>(scope.Textures);
+        scopeJson[key::Buffers]                = SerializeStateTransitions<vk::EBufferState>(scope.Buffers);
+        scopeJson[key::RestoreTextures]        = SerializeStateTransitions<vk::ETextureState>(scope.RestoreTextures);
+        scopeJson[key::ReleaseTextures]        = SerializeStateTransitions<vk::ETextureState>(scope.ReleaseTextures);
+        scopeJson[key::ReleaseBuffers]         = SerializeStateTransitions<vk::EBufferState>(scope.ReleaseBuffers);
+        scopesJson.emplace_back(std::move(scopeJson));
+    }
+    root[key::RenderingScopes] = std::move(scopesJson);
+
+    json splitBarriersJson = json::array();
+    for (const SplitBarrier& splitBarrier : splitBarriers)
+    {
+        json splitBarrierJson;
+        splitBarrierJson[key::SignalNode] = splitBarrier.SignalNode;
+        splitBarrierJson[key::WaitNode]   = splitBarrier.WaitNode;
+        splitBarrierJson[key::Textures]   = SerializeStateTransitions<vk::ETextureState>(splitBarrier.Textures);
+        splitBarrierJson[key::Buffers]    = SerializeStateTransitions<vk::EBufferState>(splitBarrier.Buffers);
+        splitBarriersJson.emplace_back(std::move(splitBarrierJson));
+    }
+    root[key::SplitBarriers] = std::move(splitBarriersJson);
+
+    json heapsJson = json::array();
+    for (const auto& heap : transientMemoryReport.Heaps)
+    {
+        json heapJson;
+        heapJson[key::Size]      = heap.Size;
+        heapJson[key::Resources] = json::array();
+        heapsJson.emplace_back(std::move(heapJson));
+    }
+
+    for (size_t idx = 0; idx < transientResourceNames.size() && idx < transientMemoryReport.Placements.size(); ++idx)
+    {
+        const auto& placement = transientMemoryReport.Placements[idx];
+        json        placementJson;
+        placementJson[key::Name]   = transientResourceNames[idx];
+        placementJson[key::Offset] = placement.Offset;
+        heapsJson[placement.HeapIndex][key::Resources].emplace_back(std::move(placementJson));
+    }
+    root[key::AliasingHeaps] = std::move(heapsJson);
+
+    return root;
+}
+
+bool RenderGraph::DumpSchedule(const fs::path& path) const
+{
+    const json schedule = BuildScheduleDump();
+    if (!SaveJsonToFile(path, schedule))
+    {
+        return false;
+    }
+
+    std::ofstream dotFile{fs::path{path}.replace_extension(".dot"), std::ios::out | std::ios::trunc};
+    if (!dotFile.is_open())
+    {
+        return false;
+    }
+
+    dotFile << RenderGraphSchedule::ToGraphviz(schedule);
+    return true;
+}
+
+bool RenderGraph::PlaceAsyncCompute(const robin_hood::unordered_map<std::string, double>& nodeCosts)
+{
+    return PlaceAsyncCompute(nodeCosts, AsyncComputePlacement::Config{});
+}
+
+bool RenderGraph::PlaceAsyncCompute(const robin_hood::unordered_map<std::string, double>& nodeCosts, const AsyncComputePlacement::Config& config)
+{
+    SY_ASSERT(compiled.bIsValid, "Render graph does not compiled.");
+    std::vector<AsyncComputePlacement::Node> placementNodes(nodes.size());
+    for (size_t executionIdx = 0; executionIdx < nodes.size(); ++executionIdx)
+    {
+        const RenderNode&            node          = *nodes[executionIdx];
+        const NodeEdges&             edges         = compiled.Nodes[node.GetId()];
+        AsyncComputePlacement::Node& placementNode = placementNodes[executionIdx];
+
+        const auto costItr   = nodeCosts.find(std::string{node.GetName()});
+        placementNode.CostMs = costItr != nodeCosts.end() ? costItr->second : config.DefaultNodeCostMs;
+        placementNode.Queue  = QueryQueueType(node);
+        for (const size_t resourceId : edges.Reads)
+        {
+            if (const auto writerIdx = QueryWriterIndex(resourceId); writerIdx)
+            {
+                placementNode.Dependencies.emplace_back(*writerIdx);
+            }
+        }
+        std::sort(placementNode.Dependencies.begin(), placementNode.Dependencies.end());
+        placementNode.Dependencies.erase(std::unique(placementNode.Dependencies.begin(), placementNode.Dependencies.end()), placementNode.Dependencies.end());
+
+        /** Transitions of history resource have to stay on the queue of its last user. */
+        const auto isHistoryResource = [this](const size_t resourceId) { return !compiled.Resources[resourceId].HistoryReaders.empty(); };
+        const bool bTouchesHistory   = !edges.HistoryReads.empty() ||
+                                       std::any_of(edges.Reads.cbegin(), edges.Reads.cend(), isHistoryResource) ||
+                                       std::any_of(edges.Writes.cbegin(), edges.Writes.cend(), isHistoryResource);
+        placementNode.bIsMovable = node.IsAsyncComputeAllowed() && !bTouchesHistory &&
+                                   (placementNode.Queue == vk::EQueueType::Graphics || placementNode.Queue == vk::EQueueType::Compute);
+    }
+
+    asyncComputePlacement = AsyncComputePlacement::Solve(placementNodes, config);
+    if (asyncComputePlacement.NumMovedNodes == 0)
+    {
+        return false;
+    }
+
+    for (size_t executionIdx = 0; executionIdx < nodes.size(); ++executionIdx)
+    {
+        nodes[executionIdx]->ExecuteOn(asyncComputePlacement.Queues[executionIdx]);
+    }
+
+    spdlog::info("[RenderGraph] Async compute placement moved {} nodes. Estimated critical path: {:.3f} ms -> {:.3f} ms",
+                 asyncComputePlacement.NumMovedNodes,
+                 asyncComputePlacement.Initial.CriticalPathMs,
+                 asyncComputePlacement.Placed.CriticalPathMs);
+    return true;
+}
+
+void RenderGraph::ScheduleStateTransitions()
+{
+    nodeStateTransitions.clear();
+    nodeStateTransitions.resize(nodes.size());
+    finalAccesses.assign(compiled.Resources.size(), FinalAccess{});
+    for (const auto& [name, texture] : textureMap)
+    {
+        ScheduleStateTransitions(*texture);
+    }
+
+    for (const auto& [name, buffer] : bufferMap)
+    {
+        ScheduleStateTransitions(*buffer);
+    }
+
+    /** Sorted by resource name to keep barrier order deterministic. History of a resource comes after its current instance. */
+    const auto sortByResource = [](auto& transitions) {
+        std::sort(transitions.begin(), transitions.end(),
+                  [](const auto& lhs, const auto& rhs) {
+                      return lhs.Resource != rhs.Resource ? lhs.Resource < rhs.Resource : lhs.bIsHistory < rhs.bIsHistory;
+                  });
+    };
+
+    for (auto& transitions : nodeStateTransitions)
+    {
+        sortByResource(transitions.Textures);
+        sortByResource(transitions.Buffers);
+        sortByResource(transitions.ReleaseTextures);
+        sortByResource(transitions.ReleaseBuffers);
+    }
+}
+
+template <typename ResourceType>
+void RenderGraph::ScheduleStateTransitions(const ResourceType& resource)
+{
+    using StateType      = typename ResourceType::State;
+    using TransitionType = ScheduledStateTransition<StateType>;
+
+    const auto getTransitions = [this](const size_t executionIdx, const bool bRelease) -> std::vector<TransitionType>& {
+        auto& transitions = nodeStateTransitions[executionIdx];
+        if constexpr (std::is_same_v<StateType, vk::ETextureState>)
+        {
+            return bRelease ? transitions.ReleaseTextures : transitions.Textures;
+        }
+        else
+        {
+            return bRelease ? transitions.ReleaseBuffers : transitions.Buffers;
+        }
+    };
+
+    StateType             currentState = StateType::None;
+    vk::EQueueType        currentQueue = MostCompetentQueue;
+    std::optional<size_t> lastUser     = std::nullopt;
+    const auto            transit      = [&](const size_t executionIdx, const StateType dstState) {
+        const vk::EQueueType dstQueue = QueryQueueType(*nodes[executionIdx]);
+        const vk::EQueueType srcQueue = lastUser ? currentQueue : dstQueue;
+        if (srcQueue == dstQueue && IsReadState(currentState) && IsReadState(dstState))
+        {
+            /** Read after read does not need any barrier unless layout changes. */
+            const StateType combinedState = CombineReadStates(currentState, dstState);
+            if (IsSameLayout(currentState, dstState) && IsSameLayout(currentState, combinedState))
+            {
+                currentState = combinedState;
+                return;
+            }
+        }
+
+        if (currentState != dstState || srcQueue != dstQueue)
+        {
+            const TransitionType transition{
+                .Resource         = std::string{resource.GetName()},
+                .Source           = currentState,
+                .Destination      = dstState,
+                .SourceQueue      = srcQueue,
+                .DestinationQueue = dstQueue};
+
+            getTransitions(executionIdx, false).emplace_back(transition);
+            if (transition.IsQueueOwnershipTransfer())
+            {
+                getTransitions(*lastUser, true).emplace_back(transition);
+                nodeStateTransitions[executionIdx].ReleasedBy.emplace_back(*lastUser);
+            }
+        }
+
+        currentState = dstState;
+        currentQueue = dstQueue;
+    };
+
+    const ResourceEdges& edges = compiled.Resources[resource.GetId()];
+    std::vector<size_t>  historyReaders;
+    for (const size_t readerId : edges.HistoryReaders)
+    {
+        if (compiled.ExecutionIndices[readerId] != InvalidExecutionIndex)
+        {
+            historyReaders.emplace_back(compiled.ExecutionIndices[readerId]);
+        }
+    }
+    std::sort(historyReaders.begin(), historyReaders.end());
+
+    if (edges.Writer && compiled.ExecutionIndices[*edges.Writer] != InvalidExecutionIndex)
+    {
+        /**
+         * With multiple in-flight frames, current instance is the one which history readers of previous frame accessed.
+         * Writer starts from final state of them, and waits on them since previous frame may still be in flight.
+         */
+        const size_t writerIdx = compiled.ExecutionIndices[*edges.Writer];
+        if (!historyReaders.empty())
+        {
+            SY_ASSERT(QueryQueueType(*nodes[historyReaders.back()]) == QueryQueueType(*nodes[writerIdx]),
+                      "History of resource {} must be read on queue of its writer.", resource.GetName());
+            currentState = resource.GetHistoryReaderState(nodes[historyReaders.back()]->GetName());
+        }
+
+        transit(writerIdx, resource.GetWriterState());
+        if (!historyReaders.empty())
+        {
+            getTransitions(writerIdx, false).back().bIsAfterHistory = true;
+        }
+        lastUser = writerIdx;
+    }
+
+    std::vector<size_t> readers;
+    readers.reserve(edges.Readers.size());
+    for (const size_t readerId : edges.Readers)
+    {
+        if (compiled.ExecutionIndices[readerId] != InvalidExecutionIndex)
+        {
+            readers.emplace_back(compiled.ExecutionIndices[readerId]);
+        }
+    }
+    std::sort(readers.begin(), readers.end());
+
+    /**
+     * Readers at the same dependency level share single transition at the first of them.
+     * Resource is owned by single queue at a time, so readers of the level are grouped per queue and ownership is passed along groups in execution order.
+     */
+    for (size_t begin = 0; begin < readers.size();)
+    {
+        const size_t                dependencyLevel = nodes[readers[begin]]->GetDependencyLevel();
+        size_t                      end             = begin + 1;
+        std::vector<vk::EQueueType> readerQueues    = {QueryQueueType(*nodes[readers[begin]])};
+        for (; end < readers.size() && nodes[readers[end]]->GetDependencyLevel() == dependencyLevel; ++end)
+        {
+            const vk::EQueueType readerQueue = QueryQueueType(*nodes[readers[end]]);
+            if (std::find(readerQueues.cbegin(), readerQueues.cend(), readerQueue) == readerQueues.cend())
+            {
+                readerQueues.emplace_back(readerQueue);
+            }
+        }
+
+        for (const vk::EQueueType readerQueue : readerQueues)
+        {
+            std::optional<size_t> firstReader   = std::nullopt;
+            size_t                lastReader    = 0;
+            StateType             combinedState = StateType::None;
+            for (size_t idx = begin; idx < end; ++idx)
+            {
+                if (QueryQueueType(*nodes[readers[idx]]) == readerQueue)
+                {
+                    const StateType readerState = resource.GetReaderState(nodes[readers[idx]]->GetName());
+                    combinedState               = firstReader ? CombineReadStates(combinedState, readerState) : readerState;
+                    firstReader                 = firstReader.value_or(readers[idx]);
+                    lastReader                  = readers[idx];
+                }
+            }
+
+            /** Acquire can not wait on release which is recorded after it. */
+            SY_ASSERT(!lastUser || *lastUser < *firstReader,
+                      "Readers of resource {} on queue {} are interleaved with readers on other queue at dependency level {}.",
+                      resource.GetName(), magic_enum::enum_name(readerQueue), dependencyLevel);
+            transit(*firstReader, combinedState);
+            lastUser = lastReader;
+        }
+        begin = end;
+    }
+    finalAccesses[resource.GetId()] = FinalAccess{.Queue = currentQueue, .Pattern = vk::QueryAccessPattern(currentState)};
+
+    /**
+     * History readers access instance of previous frame, which is left in final state of this frame by previous frame.
+     * They do not wait on any node of current frame, but on last access of previous frame. Ownership of history is not transferred across frames.
+     */
+    StateType historyState = currentState;
+    for (const size_t readerIdx : historyReaders)
+    {
+        const vk::EQueueType readerQueue = QueryQueueType(*nodes[readerIdx]);
+        const StateType      dstState    = resource.GetHistoryReaderState(nodes[readerIdx]->GetName());
+        SY_ASSERT(!lastUser || currentQueue == readerQueue, "History of resource {} must be read on queue of its last user.", resource.GetName());
+        if (historyState != dstState)
+        {
+            getTransitions(readerIdx, false).emplace_back(TransitionType{
+                .Resource         = std::string{resource.GetName()},
+                .Source           = historyState,
+                .Destination      = dstState,
+                .SourceQueue      = readerQueue,
+                .DestinationQueue = readerQueue,
+                .bIsHistory       = true});
+        }
+        historyState = dstState;
+    }
+}
+
+const RenderGraph::NodeStateTransitions& RenderGraph::GetNodeStateTransitions(const std::string_view nodeName) const
+{
+    const auto idx = GetNodeIndex(nodeName);
+    SY_ASSERT(idx.has_value(), "Invalid node name {}.", nodeName);
+    return nodeStateTransitions[*idx];
+}
+
+void RenderGraph::Execute(vk::CommandBuffer& cmdBuffer)
+{
+    PrepareResourceInstances();
+    PrepareAttachmentViews();
+    PrepareSplitBarrierEvents();
+    BeginProfilingFrame();
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        RecordNode(idx, cmdBuffer);
+    }
+}
+
+void RenderGraph::RecordNode(const size_t executionIdx, vk::CommandBuffer& cmdBuffer)
+{
+    if (activeProfilingFrame == nullptr)
+    {
+        RecordNodeCommands(executionIdx, cmdBuffer);
+        return;
+    }
+
+    /** Each node only touches its own slot, so it is safe to record nodes in parallel. */
+    ProfilingFrame& frame         = *activeProfilingFrame;
+    const auto      queryIdx      = static_cast<uint32_t>(executionIdx * 2);
+    frame.ThreadIds[executionIdx] = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    frame.CpuBegin[executionIdx]  = std::chrono::steady_clock::now();
+    const bool bWriteTimestamps   = frame.bHasTimestamps && vulkanContext.GetRHI().IsTimestampSupported(cmdBuffer.GetQueueType());
+    if (bWriteTimestamps)
+    {
+        cmdBuffer.WriteTimestamp(*activeTimestampQueryPool, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT, queryIdx);
+    }
+
+    RecordNodeCommands(executionIdx, cmdBuffer);
+
+    if (bWriteTimestamps)
+    {
+        cmdBuffer.WriteTimestamp(*activeTimestampQueryPool, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, queryIdx + 1);
+    }
+    frame.CpuEnd[executionIdx] = std::chrono::steady_clock::now();
+}
+
+void RenderGraph::RecordNodeCommands(const size_t executionIdx, vk::CommandBuffer& cmdBuffer)
+{
+    SY_ASSERT(executionIdx < nodeStateTransitions.size(), "Render graph does not compiled.");
+    RenderNode& node = *nodes[executionIdx];
+    SY_ASSERT(QueryQueueType(node) == cmdBuffer.GetQueueType(), "Node {} must be recorded on its own queue.", node.GetName());
+
+    const std::span<const size_t> waitedSplitBarriers = splitBarriersWaitedBefore[executionIdx];
+    const auto                    scope               = QueryRenderingScope(executionIdx);
+    if (!scope)
+    {
+        const NodeStateTransitions& transitions = nodeStateTransitions[executionIdx];
+        WaitSplitBarriers(cmdBuffer, executionIdx);
+        FlushStateTransitions(cmdBuffer, transitions.Textures, transitions.Buffers, false, waitedSplitBarriers);
+        node.Record(cmdBuffer);
+        FlushStateTransitions(cmdBuffer, transitions.ReleaseTextures, transitions.ReleaseBuffers, true);
+        SignalSplitBarriers(cmdBuffer, executionIdx);
+        return;
+    }
+
+    /** Barriers are not allowed inside of rendering scope, transitions of every nodes in scope are flushed around it. */
+    const RenderingScope& renderingScope = scope->get();
+    if (renderingScope.FirstNode == executionIdx)
+    {
+        WaitSplitBarriers(cmdBuffer, executionIdx);
+        FlushStateTransitions(cmdBuffer, renderingScope.Textures, renderingScope.Buffers, false, waitedSplitBarriers);
+        BeginRenderingScope(cmdBuffer, renderingScope);
+    }
+
+    node.Record(cmdBuffer);
+
+    if (renderingScope.LastNode == executionIdx)
+    {
+        cmdBuffer.EndRendering();
+        FlushStateTransitions(cmdBuffer, renderingScope.RestoreTextures, {}, false);
+        FlushStateTransitions(cmdBuffer, renderingScope.ReleaseTextures, renderingScope.ReleaseBuffers, true);
+        SignalSplitBarriers(cmdBuffer, executionIdx);
+    }
+}
+
+void RenderGraph::SetProfilingEnabled(const bool bEnabled)
+{
+    bIsProfilingEnabled = bEnabled;
+    if (!bEnabled)
+    {
+        activeProfilingFrame     = nullptr;
+        activeTimestampQueryPool = nullptr;
+    }
+}
+
+void RenderGraph::BeginProfilingFrame()
+{
+    activeProfilingFrame     = nullptr;
+    activeTimestampQueryPool = nullptr;
+    if (!bIsProfilingEnabled)
+    {
+        return;
+    }
+
+    vk::FrameTracker& frameTracker = vulkanContext.GetFrameTracker();
+    vk::QueryPool&    queryPool    = frameTracker.GetInflightTimestampQueryPool();
+    ProfilingFrame&   frame        = profilingFrames[frameTracker.GetFrameIndex()];
+    if (frame.bIsPending)
+    {
+        ResolveProfilingFrame(frame, queryPool);
+    }
+
+    frame.Frame = frameTracker.GetFrameCounter();
+    frame.Begin = std::chrono::steady_clock::now();
+    frame.Nodes.resize(nodes.size());
+    frame.Queues.resize(nodes.size());
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        frame.Nodes[idx]  = nodes[idx]->GetName();
+        frame.Queues[idx] = QueryQueueType(*nodes[idx]);
+    }
+    frame.ThreadIds.assign(nodes.size(), 0);
+    frame.CpuBegin.assign(nodes.size(), frame.Begin);
+    frame.CpuEnd.assign(nodes.size(), frame.Begin);
+
+    const size_t numQueries = nodes.size() * 2;
+    frame.bHasTimestamps    = numQueries > 0 && numQueries <= queryPool.GetNumQueries();
+    if (frame.bHasTimestamps)
+    {
+        queryPool.Reset(0, static_cast<uint32_t>(numQueries));
+    }
+    frame.bIsPending = true;
+
+    activeProfilingFrame     = &frame;
+    activeTimestampQueryPool = &queryPool;
+}
+
+void RenderGraph::ResolveProfilingFrame(ProfilingFrame& frame, const vk::QueryPool& queryPool)
+{
+    frame.bIsPending = false;
+
+    const auto toMicroseconds = [](const std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    };
+
+    /**
+     * Results are queried per node, since queue family which does not support timestamp(ex. some dedicated transfer queues) leaves its queries unavailable.
+     * Frame which is not completed yet only reports CPU timings, instead of stalling.
+     */
+    const vk::VulkanRHI&  rhi = vulkanContext.GetRHI();
+    std::vector<uint64_t> timestamps(frame.bHasTimestamps ? frame.Nodes.size() * 2 : 0);
+    std::vector<bool>     bHasGpuTimings(frame.Nodes.size(), false);
+    uint64_t              firstTimestamp = std::numeric_limits<uint64_t>::max();
+    for (size_t idx = 0; idx < frame.Nodes.size() && frame.bHasTimestamps; ++idx)
+    {
+        const std::span<uint64_t> nodeTimestamps{timestamps.data() + idx * 2, 2};
+        bHasGpuTimings[idx] = rhi.IsTimestampSupported(frame.Queues[idx]) && queryPool.TryGetResults(static_cast<uint32_t>(idx * 2), nodeTimestamps);
+        if (bHasGpuTimings[idx])
+        {
+            firstTimestamp = std::min(firstTimestamp, nodeTimestamps[0]);
+        }
+    }
+    const double microsecondsPerTick = static_cast<double>(rhi.GetTimestampPeriod()) * 1e-03;
+
+    RenderGraphProfiler::FrameTimings timings{
+        .Frame = frame.Frame,
+        .Begin = toMicroseconds(frame.Begin.time_since_epoch()),
+        .Nodes = {}};
+    timings.Nodes.reserve(frame.Nodes.size());
+    for (size_t idx = 0; idx < frame.Nodes.size(); ++idx)
+    {
+        RenderGraphProfiler::NodeTiming& timing = timings.Nodes.emplace_back();
+        timing.Node                             = std::move(frame.Nodes[idx]);
+        timing.Queue                            = frame.Queues[idx];
+        timing.ThreadId                         = frame.ThreadIds[idx];
+        timing.CpuBegin                         = toMicroseconds(frame.CpuBegin[idx] - frame.Begin);
+        timing.CpuDuration                      = toMicroseconds(frame.CpuEnd[idx] - frame.CpuBegin[idx]);
+        if (bHasGpuTimings[idx])
+        {
+            const uint64_t begin = timestamps[idx * 2];
+            const uint64_t end   = std::max(timestamps[idx * 2 + 1], begin);
+            timing.GpuBegin      = static_cast<double>(begin - firstTimestamp) * microsecondsPerTick;
+            timing.GpuDuration   = static_cast<double>(end - begin) * microsecondsPerTick;
+        }
+    }
+
+    profiler.AddFrame(std::move(timings));
+}
+
+void RenderGraph::SetSplitBarrierPolicy(const SplitBarrierPolicy& policy)
+{
+    splitBarrierPolicy = policy;
+    compiled.bIsValid  = false;
+}
+
+void RenderGraph::BuildSplitBarriers()
+{
+    splitBarriers.clear();
+    splitBarriersSignaledAfter.assign(nodes.size(), {});
+    splitBarriersWaitedBefore.assign(nodes.size(), {});
+    splitBarrierReport = {};
+
+    /** Execution indices of nodes which access each resource, sorted. */
+    std::vector<std::vector<size_t>> accesses(compiled.Resources.size());
+    for (size_t resourceId = 0; resourceId < compiled.Resources.size(); ++resourceId)
+    {
+        const ResourceEdges& edges = compiled.Resources[resourceId];
+        if (const auto writerIdx = QueryWriterIndex(resourceId); writerIdx)
+        {
+            accesses[resourceId].emplace_back(*writerIdx);
+        }
+
+        for (const size_t readerId : edges.Readers)
+        {
+            if (compiled.ExecutionIndices[readerId] != InvalidExecutionIndex)
+            {
+                accesses[resourceId].emplace_back(compiled.ExecutionIndices[readerId]);
+            }
+        }
+        std::sort(accesses[resourceId].begin(), accesses[resourceId].end());
+    }
+
+    std::map<std::pair<size_t, size_t>, size_t> splitBarrierOfRange;
+    const auto                                  trySplit = [&](const size_t waitIdx, const auto& transition, const size_t resourceId) {
+        /** First use does not wait on anything, ownership transfer is already split by semaphores, and history waits on previous frame. */
+        if (transition.Source == std::decay_t<decltype(transition.Source)>::None || transition.IsQueueOwnershipTransfer() || transition.bIsHistory || transition.bIsAfterHistory)
+        {
+            return;
+        }
+
+        ++splitBarrierReport.NumTransitions;
+        const auto& resourceAccesses = accesses[resourceId];
+        const auto  nextAccess       = std::lower_bound(resourceAccesses.cbegin(), resourceAccesses.cend(), waitIdx);
+        if (!splitBarrierPolicy.bIsEnabled || nextAccess == resourceAccesses.cbegin())
+        {
+            return;
+        }
+
+        /** Event can not be set inside of rendering scope, and transfer queue does not support events at all. */
+        const auto   scope     = QueryRenderingScope(*std::prev(nextAccess));
+        const size_t signalIdx = scope ? scope->get().LastNode : *std::prev(nextAccess);
+        if (signalIdx >= waitIdx || (waitIdx - signalIdx - 1) < splitBarrierPolicy.MinNodesInBetween || batchOfNode[signalIdx] != batchOfNode[waitIdx] ||
+            QueryQueueType(*nodes[waitIdx]) == vk::EQueueType::Transfer)
+        {
+            return;
+        }
+
+        const auto [itr, bIsNew] = splitBarrierOfRange.try_emplace({signalIdx, waitIdx}, splitBarriers.size());
+        if (bIsNew)
+        {
+            splitBarriers.emplace_back(SplitBarrier{.SignalNode = signalIdx, .WaitNode = waitIdx});
+            splitBarriersSignaledAfter[signalIdx].emplace_back(itr->second);
+            splitBarriersWaitedBefore[waitIdx].emplace_back(itr->second);
+        }
+
+        SplitBarrier& splitBarrier = splitBarriers[itr->second];
+        if constexpr (std::is_same_v<std::decay_t<decltype(transition)>, ScheduledTextureStateTransition>)
+        {
+            splitBarrier.Textures.emplace_back(transition);
+        }
+        else
+        {
+            splitBarrier.Buffers.emplace_back(transition);
+        }
+        ++splitBarrierReport.NumSplitTransitions;
+    };
+
+    for (size_t executionIdx = 0; executionIdx < nodes.size(); ++executionIdx)
+    {
+        const auto scope = QueryRenderingScope(executionIdx);
+        if (scope && scope->get().FirstNode != executionIdx)
+        {
+            continue;
+        }
+
+        /** Transitions of rendering scope are waited at beginning of it. */
+        const auto& textures = scope ? scope->get().Textures : nodeStateTransitions[executionIdx].Textures;
+        const auto& buffers  = scope ? scope->get().Buffers : nodeStateTransitions[executionIdx].Buffers;
+        for (const auto& transition : textures)
+        {
+            trySplit(executionIdx, transition, textureMap.at(transition.Resource)->GetId());
+        }
+
+        for (const auto& transition : buffers)
+        {
+            trySplit(executionIdx, transition, bufferMap.at(transition.Resource)->GetId());
+        }
+    }
+
+    splitBarrierReport.NumEvents = splitBarriers.size();
+}
+
+void RenderGraph::PrepareSplitBarrierEvents()
+{
+    const size_t inFlightFrameIdx = vulkanContext.GetFrameTracker().GetFrameIndex();
+    auto&        events           = splitBarrierEvents[inFlightFrameIdx];
+    while (events.size() < splitBarriers.size())
+    {
+        events.emplace_back(std::make_unique<vk::Event>(std::format("RenderGraph Split Barrier {} (Frame {})", events.size(), inFlightFrameIdx), vulkanContext));
+    }
+}
+
+void RenderGraph::SignalSplitBarriers(vk::CommandBuffer& cmdBuffer, const size_t executionIdx) const
+{
+    const auto& events = splitBarrierEvents[vulkanContext.GetFrameTracker().GetFrameIndex()];
+    for (const size_t splitBarrierIdx : splitBarriersSignaledAfter[executionIdx])
+    {
+        const SplitBarrier& splitBarrier                             = splitBarriers[splitBarrierIdx];
+        const auto [textureStateTransitions, bufferStateTransitions] = BuildStateTransitions(splitBarrier.Textures, splitBarrier.Buffers, false);
+        cmdBuffer.SetEvent(*events[splitBarrierIdx], textureStateTransitions, bufferStateTransitions);
+    }
+}
+
+void RenderGraph::WaitSplitBarriers(vk::CommandBuffer& cmdBuffer, const size_t executionIdx) const
+{
+    const auto& events = splitBarrierEvents[vulkanContext.GetFrameTracker().GetFrameIndex()];
+    for (const size_t splitBarrierIdx : splitBarriersWaitedBefore[executionIdx])
+    {
+        const SplitBarrier& splitBarrier                             = splitBarriers[splitBarrierIdx];
+        const auto [textureStateTransitions, bufferStateTransitions] = BuildStateTransitions(splitBarrier.Textures, splitBarrier.Buffers, false);
+        cmdBuffer.WaitEvent(*events[splitBarrierIdx], textureStateTransitions, bufferStateTransitions);
+        cmdBuffer.ResetEvent(*events[splitBarrierIdx], VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    }
+}
+
+void RenderGraph::SetRenderPassMergingEnabled(const bool bEnabled)
+{
+    if (bIsRenderPassMergingEnabled != bEnabled)
+    {
+        bIsRenderPassMergingEnabled = bEnabled;
+        compiled.bIsValid           = false;
+    }
+}
+
+CRefOptional<RenderGraph::RenderingScope> RenderGraph::QueryRenderingScope(const size_t executionIdx) const
+{
+    if (executionIdx >= scopeOfNode.size() || !scopeOfNode[executionIdx])
+    {
+        return std::nullopt;
+    }
+
+    return renderingScopes[*scopeOfNode[executionIdx]];
+}
+
+void RenderGraph::CollectAttachments(RenderingScope& scope, const size_t executionIdx) const
+{
+    const RenderNode& node = *nodes[executionIdx];
+    if (QueryQueueType(node) != vk::EQueueType::Graphics)
+    {
+        return;
+    }
+
+    std::vector<std::string_view> textureNames;
+    for (const auto& dependencies : {std::cref(node.GetWriteDependencies()), std::cref(node.GetReadDependencies())})
+    {
+        for (const std::string& resourceName : dependencies.get())
+        {
+            if (textureMap.contains(resourceName))
+            {
+                textureNames.emplace_back(resourceName);
+            }
+        }
+    }
+    std::sort(textureNames.begin(), textureNames.end());
+
+    for (const std::string_view textureName : textureNames)
+    {
+        const RenderGraphTexture& texture = *textureMap.at(textureName.data());
+        const vk::ETextureState   state   = texture.IsWriteBy(node.GetName()) ? texture.GetWriterState() : texture.GetReaderState(node.GetName());
+        /** Writer always comes first in scope, so first access decides layout of attachment during the scope. */
+        if (IsDepthStencilAttachmentState(state))
+        {
+            if (!scope.DepthStencilAttachment)
+            {
+                scope.DepthStencilAttachment = RenderingAttachment{.Resource = std::string{textureName}, .State = state};
+            }
+        }
+        else if (IsColorAttachmentState(state))
+        {
+            const bool bIsInScope = std::any_of(scope.ColorAttachments.cbegin(), scope.ColorAttachments.cend(),
+                                                [textureName](const RenderingAttachment& attachment) {
+                                                    return attachment.Resource == textureName;
+                                                });
+            if (!bIsInScope)
+            {
+                scope.ColorAttachments.emplace_back(RenderingAttachment{.Resource = std::string{textureName}, .State = state});
+            }
+        }
+    }
+}
+
+void RenderGraph::ResolveAttachmentOperations(RenderingScope& scope) const
+{
+    const auto resolve = [this, &scope](RenderingAttachment& attachment) {
+        const RenderGraphTexture& texture   = *textureMap.at(attachment.Resource);
+        const auto                writerIdx = QueryWriterIndex(texture.GetId());
+        attachment.LoadOp                   = VK_ATTACHMENT_LOAD_OP_LOAD;
+        if (writerIdx && *writerIdx >= scope.FirstNode && *writerIdx <= scope.LastNode)
+        {
+            /** Contents of transient attachment are defined by its writer. Imported attachment may keep contents from outside of graph. */
+            const auto clearValue = nodes[*writerIdx]->QueryClearValue(attachment.Resource);
+            attachment.LoadOp     = clearValue ? VK_ATTACHMENT_LOAD_OP_CLEAR : (texture.IsImported() ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_DONT_CARE);
+            attachment.ClearValue = clearValue.value_or(VkClearValue{});
+        }
+
+        const bool bIsUsedAfterScope = texture.IsImported() || texture.IsExported() || texture.GetLastUse() > scope.LastNode;
+        attachment.StoreOp           = bIsUsedAfterScope ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    };
+
+    for (RenderingAttachment& attachment : scope.ColorAttachments)
+    {
+        resolve(attachment);
+    }
+
+    if (scope.DepthStencilAttachment)
+    {
+        resolve(*scope.DepthStencilAttachment);
+    }
+}
+
+void RenderGraph::ExtendLifetimesToScope(const RenderingScope& scope)
+{
+    const auto extend = [&scope](auto& resource) {
+        if (resource.HasLifetime())
+        {
+            resource.SetLifetime(std::min(resource.GetFirstUse(), scope.FirstNode), std::max(resource.GetLastUse(), scope.LastNode));
+        }
+    };
+
+    for (size_t idx = scope.FirstNode; idx <= scope.LastNode; ++idx)
+    {
+        for (const auto& dependencies : {std::cref(nodes[idx]->GetWriteDependencies()), std::cref(nodes[idx]->GetReadDependencies())})
+        {
+            for (const std::string& resourceName : dependencies.get())
+            {
+                if (const auto textureItr = textureMap.find(resourceName); textureItr != textureMap.end())
+                {
+                    extend(*textureItr->second);
+                }
+                else if (const auto bufferItr = bufferMap.find(resourceName); bufferItr != bufferMap.end())
+                {
+                    extend(*bufferItr->second);
+                }
+            }
+        }
+    }
+}
+
+void RenderGraph::BuildRenderingScopes()
 {
-}
+    renderingScopes.clear();
+    scopeOfNode.assign(nodes.size(), std::nullopt);
+    renderPassMergeReport = {};
 
-RenderGraphTexture& RenderGraph::GetOrCreateTexture(const std::string_view name)
-{
-    if (!textureMap.contains(name.data()))
+    const auto countOperations = [](const RenderingScope& scope, size_t& numLoads, size_t& numStores) {
+        const auto count = [&](const RenderingAttachment& attachment) {
+            numLoads += attachment.LoadOp == VK_ATTACHMENT_LOAD_OP_LOAD ? 1 : 0;
+            numStores += attachment.StoreOp == VK_ATTACHMENT_STORE_OP_STORE ? 1 : 0;
+        };
+
+        std::for_each(scope.ColorAttachments.cbegin(), scope.ColorAttachments.cend(), count);
+        if (scope.DepthStencilAttachment)
+        {
+            count(*scope.DepthStencilAttachment);
+        }
+    };
+
+    const auto isAttachmentOf = [](const RenderingScope& scope, const std::string_view textureName) {
+        return (scope.DepthStencilAttachment && scope.DepthStencilAttachment->Resource == textureName) ||
+               std::any_of(scope.ColorAttachments.cbegin(), scope.ColorAttachments.cend(),
+                           [textureName](const RenderingAttachment& attachment) {
+                               return attachment.Resource == textureName;
+                           });
+    };
+
+    const auto canShareRenderArea = [this](const RenderingScope& lhs, const RenderingScope& rhs) {
+        const auto firstAttachment = [](const RenderingScope& scope) -> const std::string& {
+            return scope.ColorAttachments.empty() ? scope.DepthStencilAttachment->Resource : scope.ColorAttachments.front().Resource;
+        };
+
+        return IsCompatibleAttachment(*textureMap.at(firstAttachment(lhs)), *textureMap.at(firstAttachment(rhs)));
+    };
+
+    size_t                                 numBaselineLoads  = 0;
+    size_t                                 numBaselineStores = 0;
+    robin_hood::unordered_set<std::string> touchedResources;
+    std::optional<size_t>                  currentScope = std::nullopt;
+    for (size_t executionIdx = 0; executionIdx < nodes.size(); ++executionIdx)
     {
-        textureMap[name.data()] = std::make_unique<RenderGraphTexture>(vulkanContext, name);
+        const RenderNode& node = *nodes[executionIdx];
+        RenderingScope    nodeScope{.FirstNode = executionIdx, .LastNode = executionIdx};
+        CollectAttachments(nodeScope, executionIdx);
+        if (nodeScope.ColorAttachments.empty() && !nodeScope.DepthStencilAttachment)
+        {
+            currentScope = std::nullopt;
+            continue;
+        }
+
+        /** Baseline is beginning rendering scope per node. */
+        ++renderPassMergeReport.NumRenderingNodes;
+        ResolveAttachmentOperations(nodeScope);
+        countOperations(nodeScope, numBaselineLoads, numBaselineStores);
+
+        const NodeStateTransitions& transitions = nodeStateTransitions[executionIdx];
+        std::vector<size_t>         localReads;
+        bool                        bIsMergeable = bIsRenderPassMergingEnabled && currentScope.has_value() &&
+                                                   renderingScopes[*currentScope].LastNode + 1 == executionIdx &&
+                                                   batchOfNode[executionIdx] == batchOfNode[executionIdx - 1];
+        if (bIsMergeable)
+        {
+            const RenderingScope& scope = renderingScopes[*currentScope];
+            bIsMergeable                = canShareRenderArea(scope, nodeScope) &&
+                                          (!scope.DepthStencilAttachment || !nodeScope.DepthStencilAttachment ||
+                                           scope.DepthStencilAttachment->Resource == nodeScope.DepthStencilAttachment->Resource);
+
+            /** Transitions of resources which are untouched by scope are hoisted. Only reads of attachments written in scope can stay inside. */
+            for (size_t transitionIdx = 0; bIsMergeable && transitionIdx < transitions.Textures.size(); ++transitionIdx)
+            {
+                const ScheduledTextureStateTransition& transition = transitions.Textures[transitionIdx];
+                if (!transition.bIsHistory && touchedResources.contains(transition.Resource))
+                {
+                    const auto writerIdx    = QueryWriterIndex(textureMap.at(transition.Resource)->GetId());
+                    const bool bIsLocalRead = IsAttachmentReadState(transition.Destination) && !transition.IsQueueOwnershipTransfer() &&
+                                              isAttachmentOf(scope, transition.Resource) && writerIdx && *writerIdx >= scope.FirstNode;
+                    bIsMergeable            = bIsLocalRead;
+                    localReads.emplace_back(transitionIdx);
+                }
+            }
+
+            bIsMergeable = bIsMergeable && std::none_of(transitions.Buffers.cbegin(), transitions.Buffers.cend(),
+                                                        [&touchedResources](const ScheduledBufferStateTransition& transition) {
+                                                            return !transition.bIsHistory && touchedResources.contains(transition.Resource);
+                                                        });
+        }
+
+        if (!bIsMergeable)
+        {
+            localReads.clear();
+            touchedResources.clear();
+            renderingScopes.emplace_back(RenderingScope{.FirstNode = executionIdx, .LastNode = executionIdx});
+            currentScope = renderingScopes.size() - 1;
+        }
+
+        RenderingScope& scope = renderingScopes[*currentScope];
+        scope.LastNode        = executionIdx;
+        CollectAttachments(scope, executionIdx);
+        for (size_t transitionIdx = 0; transitionIdx < transitions.Textures.size(); ++transitionIdx)
+        {
+            /** Local read keeps attachment in layout of its writer during the scope, so its transition is deferred to end of the scope. */
+            const bool bIsLocalRead = std::find(localReads.cbegin(), localReads.cend(), transitionIdx) != localReads.cend();
+            (bIsLocalRead ? scope.RestoreTextures : scope.Textures).emplace_back(transitions.Textures[transitionIdx]);
+        }
+        renderPassMergeReport.NumLocalReads += localReads.size();
+
+        scope.Buffers.insert(scope.Buffers.end(), transitions.Buffers.cbegin(), transitions.Buffers.cend());
+        scope.ReleaseTextures.insert(scope.ReleaseTextures.end(), transitions.ReleaseTextures.cbegin(), transitions.ReleaseTextures.cend());
+        scope.ReleaseBuffers.insert(scope.ReleaseBuffers.end(), transitions.ReleaseBuffers.cbegin(), transitions.ReleaseBuffers.cend());
+        touchedResources.insert(node.GetWriteDependencies().cbegin(), node.GetWriteDependencies().cend());
+        touchedResources.insert(node.GetReadDependencies().cbegin(), node.GetReadDependencies().cend());
+        scopeOfNode[executionIdx] = *currentScope;
     }
 
-    return *textureMap.at(name.data());
-}
+    size_t numLoads  = 0;
+    size_t numStores = 0;
+    for (RenderingScope& scope : renderingScopes)
+    {
+        ResolveAttachmentOperations(scope);
+        countOperations(scope, numLoads, numStores);
+    }
 
-RenderGraphBuffer& RenderGraph::GetOrCreateBuffer(std::string_view name)
-{
-    if (!bufferMap.contains(name.data()))
+    /** Operations are resolved with lifetimes of nodes. Widen them after, otherwise every attachments are stored until end of scope. */
+    for (const RenderingScope& scope : renderingScopes)
     {
-        bufferMap[name.data()] = std::make_unique<RenderGraphBuffer>(vulkanContext, name);
+        ExtendLifetimesToScope(scope);
     }
 
-    return *bufferMap.at(name.data());
+    renderPassMergeReport.NumScopes           = renderingScopes.size();
+    renderPassMergeReport.NumEliminatedScopes = renderPassMergeReport.NumRenderingNodes - renderPassMergeReport.NumScopes;
+    renderPassMergeReport.NumEliminatedLoads  = numBaselineLoads - numLoads;
+    renderPassMergeReport.NumEliminatedStores = numBaselineStores - numStores;
 }
 
-size_t RenderGraph::QueryQueueIndex(const vk::EQueueType queueType)
+void RenderGraph::PrepareResourceInstances()
 {
-    switch (queueType)
-    {
-        case vk::EQueueType::Graphics:
-            return 0;
+    const size_t inFlightFrameIdx = vulkanContext.GetFrameTracker().GetFrameIndex();
+    const auto   prepare          = [this, inFlightFrameIdx](auto& resource) {
+        if (!resource.IsMultiBuffered())
+        {
+            return;
+        }
 
-        case vk::EQueueType::Compute:
-            return 1;
+        resource.SetInFlightFrameIndex(inFlightFrameIdx);
+        SY_ASSERT(!resource.HasLifetime() || resource.IsInstantiated(), "Multi-buffered resource {} does not instantiated.", resource.GetName());
+        /** Current instance is never the previous one, so history of this frame is not affected. */
+        const auto writer = compiled.Resources[resource.GetId()].Writer;
+        if (writer && compiled.ExecutionIndices[*writer] != InvalidExecutionIndex)
+        {
+            resource.MarkCurrentInstanceAsWritten();
+        }
+    };
 
-        default:
-            break;
+    for (auto& [name, texture] : textureMap)
+    {
+        prepare(*texture);
     }
 
-    return 0;
+    for (auto& [name, buffer] : bufferMap)
+    {
+        prepare(*buffer);
+    }
 }
 
-size_t RenderGraph::QueryQueueIndex(const RenderNode& node)
+void RenderGraph::PrepareAttachmentViews()
 {
-    return QueryQueueIndex(node.IsExecuteOnAsyncCompute() ? vk::EQueueType::Compute : MostCompetentQueue);
-}
+    const auto prepare = [this](const RenderingAttachment& attachment) {
+        const vk::Texture& texture = textureMap.at(attachment.Resource)->GetInstance();
+        if (!attachmentViews.contains(texture.GetNative()))
+        {
+            attachmentViews[texture.GetNative()] = std::make_unique<vk::TextureView>(std::format("RenderGraph {} Attachment View", attachment.Resource), vulkanContext, texture, VK_IMAGE_VIEW_TYPE_2D);
+        }
+    };
 
-void RenderGraph::TopologicalSort()
-{
-    robin_hood::unordered_map<std::string, size_t> nodeIndexMap;
-    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    for (const RenderingScope& scope : renderingScopes)
     {
-        nodeIndexMap[nodes[idx]->GetName().data()] = idx;
+        std::for_each(scope.ColorAttachments.cbegin(), scope.ColorAttachments.cend(), prepare);
+        if (scope.DepthStencilAttachment)
+        {
+            prepare(*scope.DepthStencilAttachment);
+        }
     }
+}
 
-    std::vector<size_t> sorted;
-    sorted.reserve(nodes.size());
-    std::vector<bool> visited(nodes.size());
-    std::vector<bool> onStack(nodes.size());
+void RenderGraph::BeginRenderingScope(vk::CommandBuffer& cmdBuffer, const RenderingScope& scope) const
+{
+    const auto makeAttachmentInfo = [this](const RenderingAttachment& attachment) {
+        const vk::Texture& texture = textureMap.at(attachment.Resource)->GetInstance();
+        return VkRenderingAttachmentInfo{
+            .sType              = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+            .pNext              = nullptr,
+            .imageView          = attachmentViews.at(texture.GetNative())->GetNative(),
+            .imageLayout        = vk::QueryAccessPattern(attachment.State).ImageLayout,
+            .resolveMode        = VK_RESOLVE_MODE_NONE,
+            .resolveImageView   = VK_NULL_HANDLE,
+            .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .loadOp             = attachment.LoadOp,
+            .storeOp            = attachment.StoreOp,
+            .clearValue         = attachment.ClearValue};
+    };
 
-    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    std::vector<VkRenderingAttachmentInfo> colorAttachmentInfos;
+    colorAttachmentInfos.reserve(scope.ColorAttachments.size());
+    std::transform(scope.ColorAttachments.cbegin(), scope.ColorAttachments.cend(), std::back_inserter(colorAttachmentInfos), makeAttachmentInfo);
+
+    std::optional<VkRenderingAttachmentInfo> depthStencilAttachmentInfo = std::nullopt;
+    bool                                     bHasStencil                = false;
+    if (scope.DepthStencilAttachment)
     {
-        if (!nodes[idx]->HasAnyReadDependency() && nodes[idx]->HasAnyWriteDependency())
-        {
-            DFS(0, idx, nodeIndexMap, sorted, visited, onStack);
-        }
+        depthStencilAttachmentInfo = makeAttachmentInfo(*scope.DepthStencilAttachment);
+        bHasStencil                = (textureMap.at(scope.DepthStencilAttachment->Resource)->GetInstance().GetImageAspect() & VK_IMAGE_ASPECT_STENCIL_BIT) != 0;
     }
 
-    std::reverse(sorted.begin(), sorted.end());
-    nodes = Permute(std::move(nodes), sorted);
+    const std::string&       areaResource = scope.ColorAttachments.empty() ? scope.DepthStencilAttachment->Resource : scope.ColorAttachments.front().Resource;
+    const Extent3D<uint32_t> extent       = textureMap.at(areaResource)->GetInstance().GetExtent();
+
+    const VkRenderingInfo renderingInfo{
+        .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .renderArea = VkRect2D{
+            .offset = VkOffset2D{0, 0},
+            .extent = VkExtent2D{extent.width, extent.height},
+        },
+        .layerCount = 1,
+        .viewMask = 0,
+        .colorAttachmentCount = static_cast<uint32_t>(colorAttachmentInfos.size()),
+        .pColorAttachments = colorAttachmentInfos.data(),
+        .pDepthAttachment = depthStencilAttachmentInfo ? &(*depthStencilAttachmentInfo) : nullptr,
+        .pStencilAttachment = bHasStencil ? &(*depthStencilAttachmentInfo) : nullptr};
+
+    cmdBuffer.BeginRendering(renderingInfo);
 }
 
-void RenderGraph::DFS(const size_t depth, const size_t nodeIdx, const robin_hood::unordered_map<std::string, size_t> nodeIndexMap, std::vector<size_t>& sorted, std::vector<bool>& visited, std::vector<bool>& onStack)
+std::pair<std::vector<vk::TextureStateTransition>, std::vector<vk::BufferStateTransition>> RenderGraph::BuildStateTransitions(
+    const std::span<const ScheduledTextureStateTransition> textureTransitions, const std::span<const ScheduledBufferStateTransition> bufferTransitions,
+    const bool bIsRelease, const std::span<const size_t> splitBarrierIndices) const
 {
-    SY_ASSERT(!onStack[nodeIdx], "Found circular dependency in graph.");
-    if (!visited[nodeIdx])
+    /** Same queue family does not need to release ownership, and acquire works as plain transition. */
+    const auto isRequired = [this, bIsRelease, splitBarrierIndices](const auto& scheduled) {
+        const bool bIsSplit = std::any_of(splitBarrierIndices.begin(), splitBarrierIndices.end(),
+                                          [this, &scheduled](const size_t splitBarrierIdx) {
+                                              const SplitBarrier& splitBarrier = splitBarriers[splitBarrierIdx];
+                                              if constexpr (std::is_same_v<std::decay_t<decltype(scheduled)>, ScheduledTextureStateTransition>)
+                                              {
+                                                  return std::find(splitBarrier.Textures.cbegin(), splitBarrier.Textures.cend(), scheduled) != splitBarrier.Textures.cend();
+                                              }
+                                              else
+                                              {
+                                                  return std::find(splitBarrier.Buffers.cbegin(), splitBarrier.Buffers.cend(), scheduled) != splitBarrier.Buffers.cend();
+                                              }
+                                          });
+
+        const bool bRequiresQueueFamilyTransfer = RequiresQueueFamilyTransfer(scheduled.SourceQueue, scheduled.DestinationQueue);
+        return !bIsSplit && (bIsRelease ? bRequiresQueueFamilyTransfer : (scheduled.Source != scheduled.Destination || bRequiresQueueFamilyTransfer));
+    };
+
+    /**
+     * History which has never been written is discarded instead, and so is current instance which previous frame did not read as history yet.
+     * First use of aliased memory waits on its previous resources.
+     */
+    const auto setup = [this](auto& transition, const auto& scheduled, const bool bHasHistory) {
+        transition.SetSourceState((scheduled.bIsHistory || scheduled.bIsAfterHistory) && !bHasHistory ? decltype(scheduled.Source)::None : scheduled.Source);
+        transition.SetDestinationState(scheduled.Destination);
+        if (const auto aliasingBarrier = QueryAliasingBarrier(scheduled.Resource); aliasingBarrier && !scheduled.bIsHistory && scheduled.Source == decltype(scheduled.Source)::None)
+        {
+            transition.SetAliasingSource(aliasingBarrier->get().SourceStage, aliasingBarrier->get().SourceAccess);
+        }
+        if (RequiresQueueFamilyTransfer(scheduled.SourceQueue, scheduled.DestinationQueue))
+        {
+            transition.SetSourceQueueType(scheduled.SourceQueue);
+            transition.SetDestinationQueueType(scheduled.DestinationQueue);
+        }
+    };
+
+    std::vector<vk::TextureStateTransition> textureStateTransitions;
+    for (const auto& scheduled : textureTransitions)
     {
-        robin_hood::unordered_set<size_t> readByDependencies;
-        for (const auto& writeResourceName : nodes[nodeIdx]->GetWriteDependencies())
+        if (isRequired(scheduled))
         {
-            robin_hood::unordered_set<std::string> readersOfResource;
-            if (textureMap.contains(writeResourceName))
-            {
-                readersOfResource = textureMap[writeResourceName]->GetReaders();
-            }
-            else if (bufferMap.contains(writeResourceName))
-            {
-                readersOfResource = bufferMap[writeResourceName]->GetReaders();
-            }
-            for (const auto& dependentNodeName : textureMap[writeResourceName]->GetReaders())
-            {
-                const auto idx = GetNodeIndex(dependentNodeName);
-                SY_ASSERT(idx.has_value(), "Dependent Node name is not valid.");
-                readByDependencies.insert(*idx);
-            }
+            const RenderGraphTexture&   texture    = *textureMap.at(scheduled.Resource);
+            vk::TextureStateTransition& transition = textureStateTransitions.emplace_back(vulkanContext);
+            transition.SetTexture(scheduled.bIsHistory ? texture.GetPreviousInstance() : texture.GetInstance());
+            setup(transition, scheduled, texture.HasHistory());
         }
+    }
 
-        visited[nodeIdx] = true;
-        onStack[nodeIdx] = true;
-        for (const size_t readNode : readByDependencies)
+    std::vector<vk::BufferStateTransition> bufferStateTransitions;
+    for (const auto& scheduled : bufferTransitions)
+    {
+        if (isRequired(scheduled))
         {
-            DFS(depth + 1, readNode, nodeIndexMap, sorted, visited, onStack);
+            const RenderGraphBuffer&   buffer     = *bufferMap.at(scheduled.Resource);
+            vk::BufferStateTransition& transition = bufferStateTransitions.emplace_back(vulkanContext);
+            transition.SetBuffer(scheduled.bIsHistory ? buffer.GetPreviousInstance() : buffer.GetInstance());
+            setup(transition, scheduled, buffer.HasHistory());
         }
-        onStack[nodeIdx] = false;
-        nodes[nodeIdx]->SetDependencyLevel(depth);
-        sorted.emplace_back(nodeIdx);
     }
+
+    return {std::move(textureStateTransitions), std::move(bufferStateTransitions)};
 }
 
-void RenderGraph::Compile()
+void RenderGraph::FlushStateTransitions(vk::CommandBuffer& cmdBuffer, const std::span<const ScheduledTextureStateTransition> textureTransitions, const std::span<const ScheduledBufferStateTransition> bufferTransitions, const bool bIsRelease, const std::span<const size_t> splitBarrierIndices) const
 {
-    TopologicalSort();
-    InitSSIS();
-    BuildMinDependencyLevelSyncPoints();
-    // #todo Schedule synchronization / resource state transitions
-    // if 2 or more read dependencies exist at same dependency level.
-    // Should i force promote state to AnyXXX state?
-	for (size_t dl = 0; dl <= nodes.back()->GetDependencyLevel(); ++dl)
-	{
-		if (!minDependencyLevelSyncPoints[dl].empty())
-		{
-            spdlog::info("Dependency Level {}, required to sync with below queues.", dl);
-            for (const size_t queueIdx : minDependencyLevelSyncPoints[dl])
-            {
-                spdlog::info("Q{}", queueIdx);
-            }
-		}
-	}
+    const auto [textureStateTransitions, bufferStateTransitions] = BuildStateTransitions(textureTransitions, bufferTransitions, bIsRelease, splitBarrierIndices);
+    cmdBuffer.BatchStateTransitions(textureStateTransitions);
+    cmdBuffer.BatchStateTransitions(bufferStateTransitions);
+    cmdBuffer.FlushBatchedStateTransitions();
+}
+
+bool RenderGraph::RequiresQueueFamilyTransfer(const vk::EQueueType srcQueue, const vk::EQueueType dstQueue) const
+{
+    const vk::VulkanRHI& rhi = vulkanContext.GetRHI();
+    return srcQueue != dstQueue && rhi.GetQueueFamilyIndex(srcQueue) != rhi.GetQueueFamilyIndex(dstQueue);
 }
 
 void RenderGraph::InitSSIS()
@@ -164,6 +2173,11 @@ void RenderGraph::BuildNodeSyncrhonizationIndexMap()
 
 void RenderGraph::GroupNodesByQueue()
 {
+    for (auto& groupedNodes : groupedNodesByQueue)
+    {
+        groupedNodes.clear();
+    }
+
     for (size_t idx = 0; idx < nodes.size(); ++idx)
     {
         const auto& node = nodes[idx];
@@ -179,38 +2193,55 @@ void RenderGraph::ResetSSIS()
 
 void RenderGraph::BuildSSIS()
 {
-    for (const auto& nodePtr : nodes)
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
     {
-        const auto& node = *nodePtr;
+        const auto& node = *nodes[idx];
         const size_t syncIdx = node.GetSynchronizationIndex();
         auto& ssis = GetSSIS(syncIdx);
-        if (node.HasAnyReadDependency())
+        /** Queue already synchronized with what previous node of same queue synchronized with. */
+        if (!IsFirstNodeOfQueue(node))
         {
-            SY_ASSERT(syncIdx != 0, "Synchronization Index == 0 only for read-independent node.");
             ssis.CopyOtherNextToNow(GetSSIS(syncIdx - 1));
+        }
 
-            const auto& resourceReadDependencies = node.GetReadDependencies();
-            for (const std::string_view resourceName : resourceReadDependencies)
+        if (node.HasAnyReadDependency())
+        {
+            SY_ASSERT(syncIdx != 0, "Synchronization Index == 0 only for read-independent node.");
+            for (const size_t resourceId : compiled.Nodes[node.GetId()].Reads)
             {
-                const auto writerNodeNameOpt = QueryWriterFromResource(resourceName);
-                SY_ASSERT(writerNodeNameOpt.has_value(), "Resource Name does not has any valid writer.");
-                auto writerNodeIdxOpt = GetNodeIndex(*writerNodeNameOpt);
-                SY_ASSERT(writerNodeIdxOpt.has_value(), "Invalid writer node name.");
+                const auto writerNodeIdxOpt = QueryWriterIndex(resourceId);
+                if (!writerNodeIdxOpt)
+                {
+                    SY_ASSERT(compiled.Resources[resourceId].bIsImported, "Resource does not has any valid writer.");
+                    continue;
+                }
                 auto& writerNode = *nodes[*writerNodeIdxOpt];
 
                 const size_t writerNodeQueueIdx = QueryQueueIndex(writerNode);
-                if (writerNode.IsExecuteOnAsyncCompute() != node.IsExecuteOnAsyncCompute())
+                if (writerNodeQueueIdx != QueryQueueIndex(node))
                 {
-                    auto& writerNodeSSIS = GetSSIS(*writerNodeIdxOpt);
                     ssis.UpdateNow(writerNodeQueueIdx, GetSSIS(writerNode.GetSynchronizationIndex()));
                 }
             }
+
+            /** Acquire of queue ownership transfer must wait for its release. */
+            for (const size_t releaseNodeIdx : nodeStateTransitions[idx].ReleasedBy)
+            {
+                const auto& releaseNode = *nodes[releaseNodeIdx];
+                ssis.UpdateNow(QueryQueueIndex(releaseNode), GetSSIS(releaseNode.GetSynchronizationIndex()));
+            }
         }
 
         ssis.UpdateNext(QueryQueueIndex(node), syncIdx);
     }
 }
 
+bool RenderGraph::IsFirstNodeOfQueue(const RenderNode& node) const
+{
+    const auto& groupedNodes = groupedNodesByQueue[QueryQueueIndex(node)];
+    return !groupedNodes.empty() && nodes[groupedNodes.front()].get() == &node;
+}
+
 RefOptional<RenderNode> RenderGraph::GetNode(const std::string_view name)
 {
     auto idxOpt = GetNodeIndex(name);
@@ -222,18 +2253,15 @@ RefOptional<RenderNode> RenderGraph::GetNode(const std::string_view name)
     return std::nullopt;
 }
 
-std::optional<std::string_view> RenderGraph::QueryWriterFromResource(const std::string_view resourceName) const
+std::optional<size_t> RenderGraph::QueryWriterIndex(const size_t resourceId) const
 {
-    if (textureMap.contains(resourceName.data()))
-    {
-        return textureMap.at(resourceName.data())->GetWriter();
-    }
-    else if (bufferMap.contains(resourceName.data()))
+    const auto writerId = compiled.Resources[resourceId].Writer;
+    if (!writerId || compiled.ExecutionIndices[*writerId] == InvalidExecutionIndex)
     {
-        return bufferMap.at(resourceName.data())->GetWriter();
+        return std::nullopt;
     }
 
-    return std::nullopt;
+    return compiled.ExecutionIndices[*writerId];
 }
 
 RenderGraph::SSIS& RenderGraph::GetSSIS(const size_t synchronizationIdx)
@@ -243,21 +2271,35 @@ RenderGraph::SSIS& RenderGraph::GetSSIS(const size_t synchronizationIdx)
 
 std::optional<size_t> RenderGraph::GetNodeIndex(const std::string_view name) const
 {
-    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    const auto itr = nodeIdMap.find(name.data());
+    if (itr == nodeIdMap.end())
     {
-        const auto& node = *nodes[idx];
-        if (node.GetName() == name)
-        {
-            return idx;
-        }
+        return std::nullopt;
     }
 
-    return std::nullopt;
+    /** Before compile, nodes are in declaration order. Nodes appended after last compile are not executed yet. */
+    if (!compiled.bIsValid)
+    {
+        return itr->second;
+    }
+
+    if (itr->second >= compiled.ExecutionIndices.size() || compiled.ExecutionIndices[itr->second] == InvalidExecutionIndex)
+    {
+        return std::nullopt;
+    }
+
+    return compiled.ExecutionIndices[itr->second];
+}
+
+bool RenderGraph::IsCulled(const std::string_view nodeName) const
+{
+    return std::find(cullingReport.CulledNodes.cbegin(), cullingReport.CulledNodes.cend(), nodeName) != cullingReport.CulledNodes.cend();
 }
 
 void RenderGraph::BuildMinDependencyLevelSyncPoints()
 {
-    const size_t maxDependencyLevel = nodes.back()->GetDependencyLevel();
+    const size_t maxDependencyLevel = QueryMaxDependencyLevel();
+    minDependencyLevelSyncPoints.clear();
     minDependencyLevelSyncPoints.resize(maxDependencyLevel + 1);
 	for (size_t dl = 0; dl <= maxDependencyLevel; ++dl)
 	{
@@ -279,7 +2321,7 @@ void RenderGraph::BuildMinDependencyLevelSyncPoints()
                         {
                             const size_t syncIdx = nodes[nodeIdx]->GetSynchronizationIndex();
                             const auto& ssis = GetSSIS(syncIdx);
-                            const auto& prevSSIS = GetSSIS(syncIdx - 1);
+                            const SSIS prevSSIS = IsFirstNodeOfQueue(*nodes[nodeIdx]) ? SSIS{} : GetSSIS(syncIdx - 1);
 
 							if (ssis.Now[otherQueueIdx] != prevSSIS.Next[otherQueueIdx])
 							{
@@ -294,4 +2336,275 @@ void RenderGraph::BuildMinDependencyLevelSyncPoints()
 		}
 	}
 }
+
+void RenderGraph::BuildSubmitBatches()
+{
+    submitBatches.clear();
+    if (nodes.empty())
+    {
+        return;
+    }
+
+    std::vector<size_t> syncIdxToExecutionIdx(nodes.size() + 1);
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        syncIdxToExecutionIdx[nodes[idx]->GetSynchronizationIndex()] = idx;
+    }
+
+    /** Node waits on other queue only if the queue does not already synchronized with it. (SSIS.Now > previous SSIS.Next) */
+    std::vector<std::vector<size_t>> waitNodes(nodes.size());
+    std::vector<bool>                bIsWaited(nodes.size());
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        const RenderNode& node     = *nodes[idx];
+        const size_t      queueIdx = QueryQueueIndex(node);
+        const SSIS&       ssis     = GetSSIS(node.GetSynchronizationIndex());
+        const SSIS        prevSSIS = IsFirstNodeOfQueue(node) ? SSIS{} : GetSSIS(node.GetSynchronizationIndex() - 1);
+        for (size_t otherQueueIdx = 0; otherQueueIdx < NumOfSupportedQueues; ++otherQueueIdx)
+        {
+            if (otherQueueIdx != queueIdx && ssis.Now[otherQueueIdx] > prevSSIS.Next[otherQueueIdx])
+            {
+                const size_t waitNodeIdx = syncIdxToExecutionIdx[ssis.Now[otherQueueIdx]];
+                waitNodes[idx].emplace_back(waitNodeIdx);
+                bIsWaited[waitNodeIdx] = true;
+            }
+        }
+    }
+
+    /** Split queue's node sequence before node which waits, and after node which is waited. */
+    batchOfNode.assign(nodes.size(), 0);
+    for (size_t queueIdx = 0; queueIdx < NumOfSupportedQueues; ++queueIdx)
+    {
+        std::optional<size_t> currentBatchIdx = std::nullopt;
+        for (const size_t nodeIdx : groupedNodesByQueue[queueIdx])
+        {
+            if (!currentBatchIdx || !waitNodes[nodeIdx].empty())
+            {
+                currentBatchIdx = submitBatches.size();
+                submitBatches.emplace_back(SubmitBatch{.Queue = QueryQueueType(*nodes[nodeIdx])});
+            }
+
+            submitBatches[*currentBatchIdx].Nodes.emplace_back(nodeIdx);
+            batchOfNode[nodeIdx] = *currentBatchIdx;
+            if (bIsWaited[nodeIdx])
+            {
+                currentBatchIdx = std::nullopt;
+            }
+        }
+    }
+
+    for (size_t idx = 0; idx < nodes.size(); ++idx)
+    {
+        for (const size_t waitNodeIdx : waitNodes[idx])
+        {
+            auto& waitBatches = submitBatches[batchOfNode[idx]].WaitBatches;
+            waitBatches.emplace_back(batchOfNode[waitNodeIdx]);
+            submitBatches[batchOfNode[waitNodeIdx]].bIsWaitedByOtherQueue = true;
+        }
+    }
+
+    /** Submission order; every batch only waits on batches submitted before it. */
+    std::vector<size_t> submissionOrder(submitBatches.size());
+    std::iota(submissionOrder.begin(), submissionOrder.end(), 0);
+    std::sort(submissionOrder.begin(), submissionOrder.end(),
+              [this](const size_t lhs, const size_t rhs) {
+                  return submitBatches[lhs].Nodes.front() < submitBatches[rhs].Nodes.front();
+              });
+
+    std::vector<size_t> remap(submitBatches.size());
+    for (size_t order = 0; order < submissionOrder.size(); ++order)
+    {
+        remap[submissionOrder[order]] = order;
+    }
+
+    submitBatches = Permute(std::move(submitBatches), submissionOrder);
+    for (size_t& batchIdx : batchOfNode)
+    {
+        batchIdx = remap[batchIdx];
+    }
+
+    for (auto& batch : submitBatches)
+    {
+        for (size_t& waitBatch : batch.WaitBatches)
+        {
+            waitBatch = remap[waitBatch];
+        }
+        std::sort(batch.WaitBatches.begin(), batch.WaitBatches.end());
+        batch.WaitBatches.erase(std::unique(batch.WaitBatches.begin(), batch.WaitBatches.end()), batch.WaitBatches.end());
+    }
+}
+
+void RenderGraph::Execute(const CRefSpan<vk::Semaphore> waitSemaphores, const VkPipelineStageFlags2 waitAt, const RefSpan<vk::Semaphore> signalSemaphores, const VkPipelineStageFlags2 signalAt)
+{
+    SY_ASSERT(!submitBatches.empty(), "Render graph does not compiled or empty.");
+    for (size_t queueIdx = 0; queueIdx < NumOfSupportedQueues; ++queueIdx)
+    {
+        if (queueTimelines[queueIdx] == nullptr)
+        {
+            queueTimelines[queueIdx] = std::make_unique<vk::Semaphore>(std::format("RenderGraph Queue{} Timeline", queueIdx), vulkanContext);
+        }
+    }
+
+    /** Every batch signals timeline of its queue once, so signal values are known before submission. */
+    std::vector<uint64_t>                                   signalValues(submitBatches.size());
+    std::array<uint64_t, NumOfSupportedQueues>              nextValues;
+    std::array<std::optional<size_t>, NumOfSupportedQueues> lastBatchOfQueue;
+    std::optional<size_t>                                   firstBatchOfMostCompetentQueue;
+    for (size_t queueIdx = 0; queueIdx < NumOfSupportedQueues; ++queueIdx)
+    {
+        nextValues[queueIdx] = queueTimelines[queueIdx]->GetCurrentValue();
+    }
+
+    for (size_t batchIdx = 0; batchIdx < submitBatches.size(); ++batchIdx)
+    {
+        const size_t queueIdx      = QueryQueueIndex(submitBatches[batchIdx].Queue);
+        signalValues[batchIdx]     = ++nextValues[queueIdx];
+        lastBatchOfQueue[queueIdx] = batchIdx;
+        if (submitBatches[batchIdx].Queue == MostCompetentQueue && !firstBatchOfMostCompetentQueue)
+        {
+            firstBatchOfMostCompetentQueue = batchIdx;
+        }
+    }
+
+    const auto makeSubmitInfo = [](const vk::Semaphore& semaphore, const uint64_t value, const VkPipelineStageFlags2 stageMask) {
+        return VkSemaphoreSubmitInfo{
+            .sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext       = nullptr,
+            .semaphore   = semaphore.GetNative(),
+            .value       = value,
+            .stageMask   = stageMask,
+            .deviceIndex = 0};
+    };
+
+    SY_ASSERT(firstBatchOfMostCompetentQueue.has_value(), "Render graph must have at least one node on the most competent queue.");
+
+    /**
+     * State transitions are already scheduled per node at compile time, so any contiguous range of nodes in a batch can be recorded independently.
+     * Each chunk is recorded into command buffer from command pool of the recording thread, and chunks of a batch are submitted in order.
+     */
+    const std::vector<RecordingChunk>     chunks = SplitRecordingChunks(GetNumRecordingThreads());
+    std::vector<vk::ManagedCommandBuffer> chunkCmdBuffers(chunks.size());
+    std::vector<size_t>                   firstChunkOfBatch(submitBatches.size() + 1, chunks.size());
+    for (size_t chunkIdx = chunks.size(); chunkIdx > 0; --chunkIdx)
+    {
+        firstChunkOfBatch[chunks[chunkIdx - 1].Batch] = chunkIdx - 1;
+    }
+    PrepareResourceInstances();
+    PrepareAttachmentViews();
+    PrepareSplitBarrierEvents();
+    BeginProfilingFrame();
+
+    auto&      cmdPoolAllocator = vulkanContext.GetCommandPoolAllocator();
+    const auto recordChunk      = [this, &chunks, &chunkCmdBuffers, &cmdPoolAllocator](const size_t chunkIdx) {
+        const RecordingChunk&     chunk     = chunks[chunkIdx];
+        const SubmitBatch&        batch     = submitBatches[chunk.Batch];
+        vk::ManagedCommandBuffer& cmdBuffer = chunkCmdBuffers[chunkIdx];
+        cmdBuffer                           = cmdPoolAllocator.RequestCommandPool(batch.Queue).RequestCommandBuffer(std::format("RenderGraph Batch{} Chunk{}", chunk.Batch, chunkIdx));
+        cmdBuffer->Begin();
+        for (size_t idx = chunk.Begin; idx < chunk.End; ++idx)
+        {
+            RecordNode(batch.Nodes[idx], *cmdBuffer);
+        }
+        cmdBuffer->End();
+    };
+
+    if (recordingThreadPool != nullptr)
+    {
+        recordingThreadPool->ParallelFor(chunks.size(), recordChunk);
+    }
+    else
+    {
+        for (size_t chunkIdx = 0; chunkIdx < chunks.size(); ++chunkIdx)
+        {
+            recordChunk(chunkIdx);
+        }
+    }
+
+    const size_t         mostCompetentQueueIdx = QueryQueueIndex(MostCompetentQueue);
+    const vk::VulkanRHI& rhi                   = vulkanContext.GetRHI();
+    for (size_t batchIdx = 0; batchIdx < submitBatches.size(); ++batchIdx)
+    {
+        const SubmitBatch& batch    = submitBatches[batchIdx];
+        const size_t       queueIdx = QueryQueueIndex(batch.Queue);
+
+        std::vector<VkSemaphoreSubmitInfo> waitInfos;
+        for (const size_t waitBatchIdx : batch.WaitBatches)
+        {
+            const size_t waitQueueIdx = QueryQueueIndex(submitBatches[waitBatchIdx].Queue);
+            waitInfos.emplace_back(makeSubmitInfo(*queueTimelines[waitQueueIdx], signalValues[waitBatchIdx], VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+        }
+
+        std::vector<VkSemaphoreSubmitInfo> signalInfos;
+        queueTimelines[queueIdx]->IncrementValue();
+        SY_ASSERT(queueTimelines[queueIdx]->GetCurrentValue() == signalValues[batchIdx], "Timeline value mismatch.");
+        signalInfos.emplace_back(makeSubmitInfo(*queueTimelines[queueIdx], signalValues[batchIdx], VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+
+        if (batchIdx == firstBatchOfMostCompetentQueue)
+        {
+            for (const vk::Semaphore& semaphore : waitSemaphores)
+            {
+                waitInfos.emplace_back(makeSubmitInfo(semaphore, semaphore.GetCurrentValue(), waitAt));
+            }
+        }
+
+        CRefVec<vk::CommandBuffer> cmdBuffers;
+        for (size_t chunkIdx = firstChunkOfBatch[batchIdx]; chunkIdx < firstChunkOfBatch[batchIdx + 1]; ++chunkIdx)
+        {
+            cmdBuffers.emplace_back(*chunkCmdBuffers[chunkIdx]);
+        }
+        rhi.Submit(batch.Queue, cmdBuffers, waitInfos, signalInfos);
+    }
+
+    /**
+     * Join: frame is completed only after every queues completed.
+     * Last batch of other queue may wait on last batch of the most competent queue, so join can not be done by that batch without circular wait.
+     * Trailing submit has no command buffers, it is ordered after every batches of the most competent queue by submission order.
+     */
+    std::vector<VkSemaphoreSubmitInfo> joinWaitInfos;
+    for (size_t queueIdx = 0; queueIdx < NumOfSupportedQueues; ++queueIdx)
+    {
+        if (queueIdx != mostCompetentQueueIdx && lastBatchOfQueue[queueIdx])
+        {
+            joinWaitInfos.emplace_back(makeSubmitInfo(*queueTimelines[queueIdx], signalValues[*lastBatchOfQueue[queueIdx]], VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+        }
+    }
+
+    std::vector<VkSemaphoreSubmitInfo> joinSignalInfos;
+    for (vk::Semaphore& semaphore : signalSemaphores)
+    {
+        semaphore.IncrementValue();
+        joinSignalInfos.emplace_back(makeSubmitInfo(semaphore, semaphore.GetCurrentValue(), signalAt));
+    }
+    rhi.Submit(MostCompetentQueue, {}, joinWaitInfos, joinSignalInfos);
+}
+
+size_t RenderGraph::GetNumRecordingThreads() const
+{
+    return recordingThreadPool != nullptr ? recordingThreadPool->GetNumThreads() : 1;
+}
+
+std::vector<RenderGraph::RecordingChunk> RenderGraph::SplitRecordingChunks(const size_t numRecordingThreads) const
+{
+    SY_ASSERT(numRecordingThreads > 0, "At least one thread records command buffers.");
+    std::vector<RecordingChunk> chunks;
+    for (size_t batchIdx = 0; batchIdx < submitBatches.size(); ++batchIdx)
+    {
+        const std::vector<size_t>& batchNodes = submitBatches[batchIdx].Nodes;
+        const size_t               numNodes   = batchNodes.size();
+        const size_t               chunkSize  = (numNodes + numRecordingThreads - 1) / numRecordingThreads;
+        for (size_t begin = 0; begin < numNodes;)
+        {
+            size_t end = std::min(begin + chunkSize, numNodes);
+            while (end < numNodes && scopeOfNode[batchNodes[end]] && renderingScopes[*scopeOfNode[batchNodes[end]]].FirstNode != batchNodes[end])
+            {
+                ++end;
+            }
+
+            chunks.emplace_back(RecordingChunk{.Batch = batchIdx, .Begin = begin, .End = end});
+            begin = end;
+        }
+    }
+
+    return chunks;
+}
 } // namespace sy::render
\ No newline at end of file
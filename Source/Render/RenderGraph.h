@@ -1,17 +1,35 @@
 #pragma once
 #include <PCH.h>
 #include <Render/RenderGraphResource.h>
+#include <Render/TransientResourceAliasing.h>
+#include <Render/RenderGraphProfiler.h>
+#include <Render/AsyncComputePlacement.h>
+
+namespace sy
+{
+class ThreadPool;
+}
+
+namespace sy::vk
+{
+class CommandBuffer;
+class Semaphore;
+class TextureView;
+class Event;
+class TextureStateTransition;
+class BufferStateTransition;
+class QueryPool;
+}
 
 namespace sy::render
 {
 class RenderNode;
-// #todo How about simultaneous of frame? multiple instance?
-// ex.. reesource.Instantiate(frameIndex)...
-// resource::array<Resource, 2> instances;
 class RenderGraph : public NonCopyable
 {
 public:
-    constexpr static size_t NumOfSupportedQueues = 2; // Graphics, Async Compute
+    /** Queues which node can be executed on, in order of queue index. */
+    constexpr static std::array SupportedQueues = {vk::EQueueType::Graphics, vk::EQueueType::Compute, vk::EQueueType::Transfer};
+    constexpr static size_t NumOfSupportedQueues = SupportedQueues.size();
     constexpr static vk::EQueueType MostCompetentQueue = vk::EQueueType::Graphics;
 
 private:
@@ -41,10 +59,204 @@ private:
         std::array<size_t, NumOfSupportedQueues> Next;
     };
 
+    /** Resource IDs which node accesses, sorted. */
+    struct NodeEdges
+    {
+        std::vector<size_t> Reads;
+        std::vector<size_t> Writes;
+        /** Resources whose instance of previous frame is read by node. */
+        std::vector<size_t> HistoryReads;
+    };
+
+    /** Node IDs which access resource, sorted. */
+    struct ResourceEdges
+    {
+        std::optional<size_t> Writer;
+        std::vector<size_t>   Readers;
+        std::vector<size_t>   HistoryReaders;
+        bool                  bIsImported = false;
+        bool                  bIsExported = false;
+        /** None of executed nodes access the resource. */
+        bool                  bIsCulled   = false;
+    };
+
+    /** Graph structure resolved to dense IDs, reused until structural hash changes. */
+    struct CompiledGraph
+    {
+        size_t                     StructuralHash = 0;
+        size_t                     ParameterHash  = 0;
+        std::vector<NodeEdges>     Nodes;
+        std::vector<ResourceEdges> Resources;
+        /** Indexed by node ID. Culled node has InvalidExecutionIndex. */
+        std::vector<size_t>        ExecutionIndices;
+        bool                       bIsValid = false;
+    };
+
+public:
+    constexpr static size_t InvalidExecutionIndex = std::numeric_limits<size_t>::max();
+
+    /** Nodes whose writes never reach imported or exported resources. */
+    struct CullingReport
+    {
+        std::vector<std::string> CulledNodes;
+        size_t                   NumCulledResources   = 0;
+        /** Transient memory which is not allocated for culled resources. Valid after PlanTransientResources. */
+        VkDeviceSize             CulledTransientBytes = 0;
+    };
+
+    template <typename StateType>
+    struct ScheduledStateTransition
+    {
+        std::string    Resource;
+        StateType      Source           = StateType::None;
+        StateType      Destination      = StateType::None;
+        vk::EQueueType SourceQueue      = MostCompetentQueue;
+        vk::EQueueType DestinationQueue = MostCompetentQueue;
+        /**
+         * Transition of instance of previous frame, which starts from final state of the resource in previous frame.
+         * Previous frame may still be in flight, so it waits on last access of previous frame on the same queue.
+         */
+        bool           bIsHistory       = false;
+        /** Transition of current instance, which starts from final state of history readers of previous frame and waits on them. */
+        bool           bIsAfterHistory  = false;
+
+        [[nodiscard]] bool IsQueueOwnershipTransfer() const { return SourceQueue != DestinationQueue; }
+        bool operator==(const ScheduledStateTransition&) const = default;
+    };
+
+    using ScheduledTextureStateTransition = ScheduledStateTransition<vk::ETextureState>;
+    using ScheduledBufferStateTransition  = ScheduledStateTransition<vk::EBufferState>;
+
+    struct NodeStateTransitions
+    {
+        /** Flushed before node records its commands. */
+        std::vector<ScheduledTextureStateTransition> Textures;
+        std::vector<ScheduledBufferStateTransition>  Buffers;
+        /** Flushed after node records its commands; release half of queue ownership transfers. */
+        std::vector<ScheduledTextureStateTransition> ReleaseTextures;
+        std::vector<ScheduledBufferStateTransition>  ReleaseBuffers;
+        /** Execution indices of nodes on other queue which release ownership of resources to this node. */
+        std::vector<size_t> ReleasedBy;
+    };
+
+    struct RenderingAttachment
+    {
+        std::string         Resource;
+        /** Layout of attachment during the scope. */
+        vk::ETextureState   State   = vk::ETextureState::None;
+        VkAttachmentLoadOp  LoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        VkAttachmentStoreOp StoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        VkClearValue        ClearValue{};
+    };
+
+    /**
+     * Consecutive graphics nodes which are recorded in single vkCmdBeginRendering scope. Execution indices are inclusive.
+     * Every nodes in a scope must use pipelines which are compatible with all attachments of the scope.
+     */
+    struct RenderingScope
+    {
+        size_t                                       FirstNode = 0;
+        size_t                                       LastNode  = 0;
+        std::vector<RenderingAttachment>             ColorAttachments;
+        std::optional<RenderingAttachment>           DepthStencilAttachment;
+        /** Transitions of all nodes in scope which are flushed before begin rendering. Local reads of attachments do not need any. */
+        std::vector<ScheduledTextureStateTransition> Textures;
+        std::vector<ScheduledBufferStateTransition>  Buffers;
+        /** Transitions of local reads, deferred until end rendering since attachment stays in layout of its writer during the scope. */
+        std::vector<ScheduledTextureStateTransition> RestoreTextures;
+        /** Release transitions of all nodes in scope which are flushed after end rendering. */
+        std::vector<ScheduledTextureStateTransition> ReleaseTextures;
+        std::vector<ScheduledBufferStateTransition>  ReleaseBuffers;
+    };
+
+    /** Compared to beginning one rendering scope per node. */
+    struct RenderPassMergeReport
+    {
+        size_t NumRenderingNodes   = 0;
+        size_t NumScopes           = 0;
+        size_t NumLocalReads       = 0;
+        size_t NumEliminatedScopes = 0;
+        size_t NumEliminatedLoads  = 0;
+        size_t NumEliminatedStores = 0;
+    };
+
+    /** Transitions whose previous access is at least MinNodesInBetween nodes earlier on the same batch are split with events. */
+    struct SplitBarrierPolicy
+    {
+        bool   bIsEnabled        = true;
+        size_t MinNodesInBetween = 1;
+    };
+
+    /** Event is set after SignalNode(or rendering scope which contains it) and waited before WaitNode(or rendering scope which begins with it). */
+    struct SplitBarrier
+    {
+        size_t                                       SignalNode = 0;
+        size_t                                       WaitNode   = 0;
+        std::vector<ScheduledTextureStateTransition> Textures;
+        std::vector<ScheduledBufferStateTransition>  Buffers;
+    };
+
+    struct SplitBarrierReport
+    {
+        /** Transitions which wait on previous access of resource on the same queue. */
+        size_t NumTransitions      = 0;
+        size_t NumSplitTransitions = 0;
+        size_t NumEvents           = 0;
+    };
+
+    /**
+     * First use of transient resource whose memory was occupied by previous resources of the frame.
+     * Its first transition waits on last accesses of them, and discards contents since old layout is undefined.
+     */
+    struct AliasingBarrier
+    {
+        std::string              Resource;
+        /** Queue of first use. */
+        vk::EQueueType           Queue = MostCompetentQueue;
+        std::vector<std::string> PreviousResources;
+        /** Last accesses of previous resources on the same queue. Others are already waited by semaphores. */
+        VkPipelineStageFlags2    SourceStage  = VK_PIPELINE_STAGE_2_NONE;
+        VkAccessFlags2           SourceAccess = VK_ACCESS_2_NONE;
+    };
+
+    /** Contiguous nodes of single queue which are submitted at once. Batches split at cross-queue sync points. */
+    struct SubmitBatch
+    {
+        vk::EQueueType      Queue = MostCompetentQueue;
+        /** Execution indices in execution order. */
+        std::vector<size_t> Nodes;
+        /** Batches of other queues which must be completed before this batch begins. */
+        std::vector<size_t> WaitBatches;
+        bool                bIsWaitedByOtherQueue = false;
+    };
+
+    /** Contiguous range [Begin, End) of nodes of a submit batch, which is recorded into single command buffer. */
+    struct RecordingChunk
+    {
+        size_t Batch = 0;
+        size_t Begin = 0;
+        size_t End   = 0;
+    };
+
+    enum class ECompileResult
+    {
+        /** Structure changed; graph is rebuilt from scratch. */
+        Full,
+        /** Only access states changed; state transitions are rescheduled. */
+        Incremental,
+        /** Nothing changed; previous compiled graph is reused. */
+        Cached
+    };
+
 public:
     RenderGraph(vk::VulkanContext& vulkanContext);
     ~RenderGraph();
 
+    [[nodiscard]] constexpr static bool IsSupportedQueue(const vk::EQueueType queueType)
+    {
+        return std::find(SupportedQueues.cbegin(), SupportedQueues.cend(), queueType) != SupportedQueues.cend();
+    }
+
     RenderGraphTexture& GetOrCreateTexture(std::string_view name);
     RenderGraphBuffer& GetOrCreateBuffer(std::string_view name);
 
@@ -53,7 +265,7 @@ public:
     template <typename T>
     void AppendNode(std::unique_ptr<T> node)
     {
-        nodes.emplace_back(std::unique_ptr<RenderNode>(static_cast<RenderNode*>(node.release())));
+        RegisterNode(std::unique_ptr<RenderNode>(static_cast<RenderNode*>(node.release())));
     }
 
     template <typename T, typename... Args>
@@ -63,19 +275,150 @@ public:
         return *nodes.back();
     }
 
-    void Compile();
+    /** Compiled graph is cached by structural hash of nodes and resource edges, so it is cheap to call every frame. */
+    ECompileResult Compile();
+
+    /** Memory requirements of transient resource of given name. */
+    using MemoryRequirementsQuery = std::function<VkMemoryRequirements(std::string_view)>;
+
+    /**
+     * Place transient resources onto shared memory heaps based on lifetimes from Compile, and build aliasing barriers between them.
+     * Resources on different queues only share memory if one of them is synchronized after the other. It does not allocate any memory.
+     */
+    void PlanTransientResources(const MemoryRequirementsQuery& queryMemoryRequirements);
+    /** Plan with memory requirements of device, then allocate heaps and instantiate resources on them. */
+    void AllocateTransientResources();
+    void ReleaseTransientResources();
+    [[nodiscard]] const TransientResourceAliasing::Result& GetTransientMemoryReport() const { return transientMemoryReport; }
+    [[nodiscard]] CRefOptional<AliasingBarrier> QueryAliasingBarrier(std::string_view resourceName) const;
+    [[nodiscard]] const CullingReport& GetCullingReport() const { return cullingReport; }
+    [[nodiscard]] bool IsCulled(std::string_view nodeName) const;
+
+    /** Records every nodes in execution order. All nodes must be executed on queue of the command buffer. */
+    void Execute(vk::CommandBuffer& cmdBuffer);
+    /**
+     * Records and submits every batches to its own queue, wired with per-queue timeline semaphores.
+     * First batch of the most competent queue waits on given semaphores.
+     * After every batches, a submit without command buffers on the most competent queue joins other queues and signals given semaphores.
+     * Batches are split into recording chunks which are recorded in parallel, then stitched in execution order at submit.
+     */
+    void Execute(CRefSpan<vk::Semaphore> waitSemaphores, VkPipelineStageFlags2 waitAt, RefSpan<vk::Semaphore> signalSemaphores, VkPipelineStageFlags2 signalAt);
+    void RecordNode(size_t executionIdx, vk::CommandBuffer& cmdBuffer);
+
+    /**
+     * Pool which records command buffers during Execute. Pool is owned outside and may be shared with other recorders. Null records serially.
+     * Each recording thread owns its command pools, so RenderNode::Record must not touch state shared with other nodes.
+     */
+    void SetRecordingThreadPool(ThreadPool* threadPool) { recordingThreadPool = threadPool; }
+    /** Number of threads(including caller) which record command buffers during Execute. */
+    [[nodiscard]] size_t GetNumRecordingThreads() const;
+    /**
+     * Splits every batches into chunks of about same number of nodes per recording thread, in submission order.
+     * Rendering scope can not span multiple command buffers, so chunk is extended to the end of scope.
+     */
+    [[nodiscard]] std::vector<RecordingChunk> SplitRecordingChunks(size_t numRecordingThreads) const;
+
+    [[nodiscard]] const NodeStateTransitions& GetNodeStateTransitions(size_t executionIdx) const { return nodeStateTransitions[executionIdx]; }
+    [[nodiscard]] const NodeStateTransitions& GetNodeStateTransitions(std::string_view nodeName) const;
+    [[nodiscard]] const std::vector<SubmitBatch>& GetSubmitBatches() const { return submitBatches; }
+
+    /** Merge consecutive graphics nodes which share attachments into single rendering scope. Enabled by default. */
+    void SetRenderPassMergingEnabled(bool bEnabled);
+    [[nodiscard]] const std::vector<RenderingScope>& GetRenderingScopes() const { return renderingScopes; }
+    /** Pipelines of node must be compatible with attachment formats of its rendering scope. */
+    [[nodiscard]] CRefOptional<RenderingScope> QueryRenderingScope(size_t executionIdx) const;
+    [[nodiscard]] const RenderPassMergeReport& GetRenderPassMergeReport() const { return renderPassMergeReport; }
+
+    void SetSplitBarrierPolicy(const SplitBarrierPolicy& policy);
+    [[nodiscard]] const SplitBarrierPolicy& GetSplitBarrierPolicy() const { return splitBarrierPolicy; }
+    [[nodiscard]] const std::vector<SplitBarrier>& GetSplitBarriers() const { return splitBarriers; }
+    [[nodiscard]] const SplitBarrierReport& GetSplitBarrierReport() const { return splitBarrierReport; }
+
+    /**
+     * Measure CPU recording time and GPU execution time of every node. Enabled by default.
+     * Timestamps of a frame are resolved when its in-flight frame slot is reused, so results lag behind by NumMaxInFlightFrames.
+     * Graph must be executed at most once per frame of FrameTracker while profiling.
+     */
+    void SetProfilingEnabled(bool bEnabled);
+    [[nodiscard]] bool IsProfilingEnabled() const { return bIsProfilingEnabled; }
+    [[nodiscard]] RenderGraphProfiler& GetProfiler() { return profiler; }
+    [[nodiscard]] const RenderGraphProfiler& GetProfiler() const { return profiler; }
+
+    /**
+     * Moves nodes which allow async compute between graphics and async compute queue, to minimize critical path estimated from node costs. (see AsyncComputePlacement)
+     * Node costs are usually estimates of profiler(RenderGraphProfiler::BuildCostEstimates), and nodes which touch history resources are never moved.
+     * Graph must be compiled. Returns true if any node is moved, then next Compile rebuilds the graph.
+     */
+    bool PlaceAsyncCompute(const robin_hood::unordered_map<std::string, double>& nodeCosts);
+    bool PlaceAsyncCompute(const robin_hood::unordered_map<std::string, double>& nodeCosts, const AsyncComputePlacement::Config& config);
+    [[nodiscard]] const AsyncComputePlacement::Result& GetAsyncComputePlacement() const { return asyncComputePlacement; }
+
+    /**
+     * Compiled schedule for offline analysis: nodes with queue, dependency level, synchronization index and SSIS, resource edges with states,
+     * submit batches, rendering scopes, barriers and aliasing heaps. Aliasing heaps are valid after PlanTransientResources.
+     */
+    [[nodiscard]] json BuildScheduleDump() const;
+    /** Writes JSON to given path and Graphviz of it next to the path. (see RenderGraphSchedule) */
+    bool DumpSchedule(const fs::path& path) const;
 
 private:
+    struct ProfilingFrame
+    {
+        size_t                                             Frame = 0;
+        std::chrono::steady_clock::time_point              Begin;
+        std::vector<std::string>                           Nodes;
+        std::vector<vk::EQueueType>                        Queues;
+        std::vector<uint64_t>                              ThreadIds;
+        std::vector<std::chrono::steady_clock::time_point> CpuBegin;
+        std::vector<std::chrono::steady_clock::time_point> CpuEnd;
+        /** Begin and end timestamp of node are written at query 2n and 2n+1, if query pool is large enough. */
+        bool                                               bHasTimestamps = false;
+        bool                                               bIsPending     = false;
+    };
+
+    /** Accesses of a resource on each queue. */
+    struct QueueLifetime
+    {
+        /** Execution index of first use. Every other accesses wait on it. */
+        size_t                                                  FirstUse = 0;
+        /** Synchronization index of last use on each queue. */
+        std::array<std::optional<size_t>, NumOfSupportedQueues> LastUses;
+        bool                                                    bIsExported = false;
+    };
+
+    struct FinalAccess
+    {
+        vk::EQueueType    Queue = MostCompetentQueue;
+        vk::AccessPattern Pattern{};
+    };
+
     static size_t QueryQueueIndex(vk::EQueueType queueType);
     static size_t QueryQueueIndex(const RenderNode& node);
+    static vk::EQueueType QueryQueueType(const RenderNode& node);
+
+    void RegisterNode(std::unique_ptr<RenderNode> node);
 
-    std::optional<std::string_view> QueryWriterFromResource(std::string_view resourceName) const;
     SSIS& GetSSIS(const size_t synchronizationIdx);
+    [[nodiscard]] bool IsFirstNodeOfQueue(const RenderNode& node) const;
     std::optional<size_t> GetNodeIndex(std::string_view name) const;
     RefOptional<RenderNode> GetNode(std::string_view name);
+    /** Execution index of writer of resource which is read by node. */
+    [[nodiscard]] std::optional<size_t> QueryWriterIndex(size_t resourceId) const;
+
+    /** Structural hash covers nodes, queues and resource edges. Parameter hash covers access states of edges. */
+    [[nodiscard]] std::pair<size_t, size_t> ComputeGraphHashes() const;
+    void BuildCompiledEdges();
+    [[nodiscard]] size_t GetNumNodes() const { return nodes.size() + culledNodes.size(); }
 
+    /**
+     * Cull nodes whose writes never reach imported or exported resources. Culling is disabled until graph writes any of them.
+     * Culled nodes are kept aside, so they come back once any output depends on them again.
+     */
+    void CullNodes();
     void TopologicalSort();
-    void DFS(size_t depth, size_t nodeIdx, const robin_hood::unordered_map<std::string, size_t> nodeIndexMap, std::vector<size_t>& sorted, std::vector<bool>& visited, std::vector<bool>& onStack);
+    void ComputeDependencyLevels();
+    [[nodiscard]] size_t QueryMaxDependencyLevel() const;
+    void DFS(size_t nodeId, std::vector<size_t>& sorted, std::vector<bool>& visited, std::vector<bool>& onStack) const;
 
     // SSIS: Sufficient Synchronization Index Set
     void InitSSIS();
@@ -85,14 +428,96 @@ private:
     void BuildSSIS();
 
 	void BuildMinDependencyLevelSyncPoints();
+    void BuildSubmitBatches();
+
+    void ComputeResourceLifetimes();
+    /** First and last uses of every resources, indexed by resource id. Resources without lifetime are nullopt. */
+    [[nodiscard]] std::vector<std::optional<std::pair<size_t, size_t>>> QueryResourceLifetimes() const;
+    template <typename ResourceType>
+    [[nodiscard]] QueueLifetime QueryQueueLifetime(const ResourceType& resource) const;
+    /** Every accesses of lhs are completed before first use of rhs, by queue order or by cross-queue sync points. */
+    [[nodiscard]] bool IsCompletedBefore(const QueueLifetime& lhs, const QueueLifetime& rhs) const;
+    /** Source accesses are taken from final states, which are rescheduled by incremental compile. */
+    void ResolveAliasingBarriers();
+
+    void BuildRenderingScopes();
+    /** Append attachments of node which are not in scope yet. Color attachments are ordered by first use, then by name. */
+    void CollectAttachments(RenderingScope& scope, size_t executionIdx) const;
+    void ResolveAttachmentOperations(RenderingScope& scope) const;
+    /** Widen lifetimes of resources in scope to whole scope, since their transitions are hoisted to beginning of it. */
+    void ExtendLifetimesToScope(const RenderingScope& scope);
+    void PrepareAttachmentViews();
+    /** Select instances of multi-buffered resources for current in-flight frame. */
+    void PrepareResourceInstances();
+    void BeginRenderingScope(vk::CommandBuffer& cmdBuffer, const RenderingScope& scope) const;
+
+    /** Runs after rendering scopes are built, since transitions of a scope are waited at beginning of it. */
+    void BuildSplitBarriers();
+    void PrepareSplitBarrierEvents();
+    void SignalSplitBarriers(vk::CommandBuffer& cmdBuffer, size_t executionIdx) const;
+    void WaitSplitBarriers(vk::CommandBuffer& cmdBuffer, size_t executionIdx) const;
+
+    /** Resolve previous frame of current in-flight frame slot without waiting for device, then begin new one. */
+    void BeginProfilingFrame();
+    void ResolveProfilingFrame(ProfilingFrame& frame, const vk::QueryPool& queryPool);
+    void RecordNodeCommands(size_t executionIdx, vk::CommandBuffer& cmdBuffer);
+
+    void ScheduleStateTransitions();
+    template <typename ResourceType>
+    void ScheduleStateTransitions(const ResourceType& resource);
+    /** Transitions which are included in given split barriers are skipped. */
+    [[nodiscard]] std::pair<std::vector<vk::TextureStateTransition>, std::vector<vk::BufferStateTransition>> BuildStateTransitions(
+        std::span<const ScheduledTextureStateTransition> textureTransitions, std::span<const ScheduledBufferStateTransition> bufferTransitions,
+        bool bIsRelease, std::span<const size_t> splitBarrierIndices = {}) const;
+    void FlushStateTransitions(vk::CommandBuffer& cmdBuffer, std::span<const ScheduledTextureStateTransition> textureTransitions, std::span<const ScheduledBufferStateTransition> bufferTransitions, bool bIsRelease, std::span<const size_t> splitBarrierIndices = {}) const;
+    [[nodiscard]] bool RequiresQueueFamilyTransfer(vk::EQueueType srcQueue, vk::EQueueType dstQueue) const;
 
 private:
     vk::VulkanContext& vulkanContext;
     std::vector<std::unique_ptr<RenderNode>> nodes;
+    std::vector<std::unique_ptr<RenderNode>> culledNodes;
+    robin_hood::unordered_map<std::string, size_t> nodeIdMap;
     robin_hood::unordered_map<std::string, std::unique_ptr<RenderGraphTexture>> textureMap = {};
     robin_hood::unordered_map<std::string, std::unique_ptr<RenderGraphBuffer>> bufferMap = {};
+    size_t numResources = 0;
+    CompiledGraph compiled;
     std::array<std::vector<size_t>, RenderGraph::NumOfSupportedQueues> groupedNodesByQueue;
     std::vector<SSIS> ssises;
     std::vector<robin_hood::unordered_set<size_t>> minDependencyLevelSyncPoints;
+    std::vector<NodeStateTransitions> nodeStateTransitions;
+    std::vector<SubmitBatch> submitBatches;
+    /** Indexed by execution index. */
+    std::vector<size_t> batchOfNode;
+    std::array<std::unique_ptr<vk::Semaphore>, NumOfSupportedQueues> queueTimelines;
+    ThreadPool* recordingThreadPool = nullptr;
+    std::vector<VmaAllocation> transientHeaps;
+    TransientResourceAliasing::Result transientMemoryReport;
+    /** Same order as placements of transient memory report. */
+    std::vector<std::string> transientResourceNames;
+    /** Query of last plan, so incremental compile can place resources again when lifetimes change. */
+    MemoryRequirementsQuery transientMemoryRequirementsQuery;
+    robin_hood::unordered_map<std::string, AliasingBarrier> aliasingBarriers;
+    /** Indexed by resource ID. Access of the last user of current frame. */
+    std::vector<FinalAccess> finalAccesses;
+    CullingReport cullingReport;
+    bool bIsRenderPassMergingEnabled = true;
+    std::vector<RenderingScope> renderingScopes;
+    std::vector<std::optional<size_t>> scopeOfNode;
+    RenderPassMergeReport renderPassMergeReport;
+    robin_hood::unordered_map<VkImage, std::unique_ptr<vk::TextureView>> attachmentViews;
+    SplitBarrierPolicy splitBarrierPolicy;
+    std::vector<SplitBarrier> splitBarriers;
+    std::vector<std::vector<size_t>> splitBarriersSignaledAfter;
+    std::vector<std::vector<size_t>> splitBarriersWaitedBefore;
+    SplitBarrierReport splitBarrierReport;
+    /** Events are reset right after wait, but previous frame of other in-flight frame slot may still use its events. */
+    std::array<std::vector<std::unique_ptr<vk::Event>>, vk::NumMaxInFlightFrames> splitBarrierEvents;
+    bool bIsProfilingEnabled = true;
+    RenderGraphProfiler profiler;
+    AsyncComputePlacement::Result asyncComputePlacement;
+    std::array<ProfilingFrame, vk::NumMaxInFlightFrames> profilingFrames;
+    /** Frame which is being recorded. Null if profiling is disabled. */
+    ProfilingFrame* activeProfilingFrame = nullptr;
+    vk::QueryPool* activeTimestampQueryPool = nullptr;
 };
 } // namespace sy::render
\ No newline at end of file
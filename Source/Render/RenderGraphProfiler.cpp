@@ -0,0 +1,172 @@
+#include <PCH.h>
+#include <Render/RenderGraphProfiler.h>
+
+namespace sy::render
+{
+RenderGraphProfiler::RenderGraphProfiler(const size_t numRollingFrames) :
+    numRollingFrames(numRollingFrames)
+{
+    SY_ASSERT(numRollingFrames > 0, "Profiler requires at least one frame of rolling window.");
+}
+
+void RenderGraphProfiler::AddFrame(FrameTimings frame)
+{
+    frames.emplace_back(std::move(frame));
+    if (frames.size() > numRollingFrames)
+    {
+        frames.erase(frames.begin(), frames.begin() + (frames.size() - numRollingFrames));
+    }
+}
+
+std::optional<RenderGraphProfiler::NodeStatistics> RenderGraphProfiler::QueryStatistics(const std::string_view node) const
+{
+    NodeStatistics statistics;
+    for (const FrameTimings& frame : frames)
+    {
+        for (const NodeTiming& timing : frame.Nodes)
+        {
+            if (timing.Node != node)
+            {
+                continue;
+            }
+
+            const double cpuMs = timing.CpuDuration * 1e-03;
+            statistics.AverageCpuMs += cpuMs;
+            statistics.MaxCpuMs = std::max(statistics.MaxCpuMs, cpuMs);
+            ++statistics.NumSamples;
+            if (timing.GpuDuration)
+            {
+                const double gpuMs = *timing.GpuDuration * 1e-03;
+                statistics.AverageGpuMs += gpuMs;
+                statistics.MaxGpuMs = std::max(statistics.MaxGpuMs, gpuMs);
+                ++statistics.NumGpuSamples;
+            }
+        }
+    }
+
+    if (statistics.NumSamples == 0)
+    {
+        return std::nullopt;
+    }
+
+    statistics.AverageCpuMs /= static_cast<double>(statistics.NumSamples);
+    statistics.AverageGpuMs = statistics.NumGpuSamples > 0 ? statistics.AverageGpuMs / static_cast<double>(statistics.NumGpuSamples) : 0.0;
+    return statistics;
+}
+
+std::vector<std::pair<std::string, RenderGraphProfiler::NodeStatistics>> RenderGraphProfiler::BuildTable() const
+{
+    robin_hood::unordered_set<std::string> nodes;
+    for (const FrameTimings& frame : frames)
+    {
+        for (const NodeTiming& timing : frame.Nodes)
+        {
+            nodes.insert(timing.Node);
+        }
+    }
+
+    using Row = std::pair<std::string, NodeStatistics>;
+    std::vector<Row> table;
+    table.reserve(nodes.size());
+    for (const std::string& node : nodes)
+    {
+        table.emplace_back(node, *QueryStatistics(node));
+    }
+
+    std::sort(table.begin(), table.end(),
+              [](const Row& lhs, const Row& rhs) {
+                  if (lhs.second.AverageGpuMs != rhs.second.AverageGpuMs)
+                  {
+                      return lhs.second.AverageGpuMs > rhs.second.AverageGpuMs;
+                  }
+
+                  return lhs.second.AverageCpuMs != rhs.second.AverageCpuMs ? lhs.second.AverageCpuMs > rhs.second.AverageCpuMs : lhs.first < rhs.first;
+              });
+    return table;
+}
+
+void RenderGraphProfiler::LogTable() const
+{
+    spdlog::info("[RenderGraph Profiler] {} frames, (avg/max ms)", frames.size());
+    for (const auto& [node, statistics] : BuildTable())
+    {
+        spdlog::info("[RenderGraph Profiler] {:<32} CPU {:8.3f} / {:8.3f}  GPU {:8.3f} / {:8.3f}",
+                     node,
+                     statistics.AverageCpuMs, statistics.MaxCpuMs,
+                     statistics.AverageGpuMs, statistics.MaxGpuMs);
+    }
+}
+
+json RenderGraphProfiler::BuildCostEstimates() const
+{
+    json costs = json::object();
+    for (const auto& [node, statistics] : BuildTable())
+    {
+        costs[node] = statistics.NumGpuSamples > 0 ? statistics.AverageGpuMs : statistics.AverageCpuMs;
+    }
+
+    return costs;
+}
+
+json RenderGraphProfiler::BuildChromeTrace() const
+{
+    constexpr uint64_t CpuProcessId = 0;
+    constexpr uint64_t GpuProcessId = 1;
+
+    json events = json::array();
+    const auto makeMetadata = [](const std::string_view name, const uint64_t pid, const std::optional<uint64_t> tid, const std::string_view value) {
+        json event;
+        event["name"] = name;
+        event["ph"]   = "M";
+        event["pid"]  = pid;
+        if (tid)
+        {
+            event["tid"] = *tid;
+        }
+        event["args"]["name"] = value;
+        return event;
+    };
+
+    events.emplace_back(makeMetadata("process_name", CpuProcessId, std::nullopt, "RenderGraph CPU"));
+    events.emplace_back(makeMetadata("process_name", GpuProcessId, std::nullopt, "RenderGraph GPU"));
+    for (const auto queueType : magic_enum::enum_values<vk::EQueueType>())
+    {
+        events.emplace_back(makeMetadata("thread_name", GpuProcessId, ToUnderlying(queueType), magic_enum::enum_name(queueType)));
+    }
+
+    const auto makeScope = [](const std::string_view name, const std::string_view category, const uint64_t pid, const uint64_t tid, const double ts, const double dur, const size_t frame) {
+        json event;
+        event["name"]          = name;
+        event["cat"]           = category;
+        event["ph"]            = "X";
+        event["pid"]           = pid;
+        event["tid"]           = tid;
+        event["ts"]            = ts;
+        event["dur"]           = dur;
+        event["args"]["frame"] = frame;
+        return event;
+    };
+
+    for (const FrameTimings& frame : frames)
+    {
+        for (const NodeTiming& timing : frame.Nodes)
+        {
+            events.emplace_back(makeScope(timing.Node, "cpu", CpuProcessId, timing.ThreadId, frame.Begin + timing.CpuBegin, timing.CpuDuration, frame.Frame));
+            if (timing.GpuBegin && timing.GpuDuration)
+            {
+                events.emplace_back(makeScope(timing.Node, "gpu", GpuProcessId, ToUnderlying(timing.Queue), frame.Begin + *timing.GpuBegin, *timing.GpuDuration, frame.Frame));
+            }
+        }
+    }
+
+    json trace;
+    trace["traceEvents"]     = std::move(events);
+    trace["displayTimeUnit"] = "ms";
+    return trace;
+}
+
+bool RenderGraphProfiler::DumpChromeTrace(const fs::path& path) const
+{
+    return SaveJsonToFile(path, BuildChromeTrace(), false);
+}
+} // namespace sy::render
@@ -0,0 +1,75 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::render
+{
+/**
+ * Collects per-node CPU recording time and GPU execution time of resolved frames.
+ * It does not touch any vulkan object; RenderGraph feeds timings once timestamp queries of a frame are available.
+ */
+class RenderGraphProfiler
+{
+public:
+    struct NodeTiming
+    {
+        std::string           Node;
+        vk::EQueueType        Queue    = vk::EQueueType::Graphics;
+        /** Recording thread of the node. */
+        uint64_t              ThreadId = 0;
+        /** Microseconds from beginning of the frame. */
+        double                CpuBegin    = 0.0;
+        double                CpuDuration = 0.0;
+        /** Microseconds from the first timestamp of the frame. Empty if timestamps are not available. */
+        std::optional<double> GpuBegin    = std::nullopt;
+        std::optional<double> GpuDuration = std::nullopt;
+    };
+
+    struct FrameTimings
+    {
+        size_t                  Frame = 0;
+        /** Microseconds of steady clock, when graph began to record the frame. */
+        double                  Begin = 0.0;
+        std::vector<NodeTiming> Nodes;
+    };
+
+    struct NodeStatistics
+    {
+        double AverageCpuMs  = 0.0;
+        double MaxCpuMs      = 0.0;
+        double AverageGpuMs  = 0.0;
+        double MaxGpuMs      = 0.0;
+        size_t NumSamples    = 0;
+        size_t NumGpuSamples = 0;
+    };
+
+public:
+    explicit RenderGraphProfiler(size_t numRollingFrames = 120);
+
+    /** Oldest frame is dropped once number of frames exceeds rolling window. */
+    void AddFrame(FrameTimings frame);
+    void Clear() { frames.clear(); }
+
+    [[nodiscard]] size_t GetNumRollingFrames() const { return numRollingFrames; }
+    [[nodiscard]] size_t GetNumFrames() const { return frames.size(); }
+    [[nodiscard]] const std::vector<FrameTimings>& GetFrames() const { return frames; }
+
+    [[nodiscard]] std::optional<NodeStatistics> QueryStatistics(std::string_view node) const;
+    /** Statistics of every node in rolling window, sorted by average GPU time then average CPU time, descending. */
+    [[nodiscard]] std::vector<std::pair<std::string, NodeStatistics>> BuildTable() const;
+    void LogTable() const;
+    /** Average GPU time(or CPU time if timestamps are not available) of every node, to feed RenderGraphSchedule::Simulate. */
+    [[nodiscard]] json BuildCostEstimates() const;
+
+    /**
+     * Chrome trace event format, which can be loaded on chrome://tracing or Perfetto.
+     * CPU scopes are placed on process 0 per recording thread, GPU scopes on process 1 per queue.
+     * GPU timestamps are not calibrated with CPU clock, so GPU scopes of a frame are aligned to beginning of its CPU frame.
+     */
+    [[nodiscard]] json BuildChromeTrace() const;
+    bool DumpChromeTrace(const fs::path& path) const;
+
+private:
+    size_t                    numRollingFrames;
+    std::vector<FrameTimings> frames;
+};
+} // namespace sy::render
@@ -16,28 +16,117 @@ template <typename T, typename BuilderType, typename StateType>
 class RenderGraphResource : public NonCopyable
 {
 public:
-    RenderGraphResource(vk::VulkanContext& vulkanContext, const std::string_view name) :
+    using State = StateType;
+
+public:
+    RenderGraphResource(vk::VulkanContext& vulkanContext, const std::string_view name, const size_t id) :
         name(name),
+        id(id),
         builder(BuilderType(vulkanContext))
     {
     }
 
     ~RenderGraphResource() = default;
 
+    /** Multi-buffered resource builds dedicated instance for every in-flight frames. */
     T& Instantiate()
     {
-        if (instance == nullptr)
+        for (size_t idx = 0; idx < GetNumInstances(); ++idx)
+        {
+            if (instances[idx] == nullptr)
+            {
+                instances[idx] = builder.Build();
+            }
+        }
+
+        return GetInstance();
+    }
+
+    /** Instantiate on memory shared with other transient resources. */
+    T& Instantiate(const VmaAllocation memory, const VkDeviceSize offset)
+    {
+        SY_ASSERT(!bIsMultiBuffered, "Multi-buffered resource {} can not be aliased.", name);
+        SY_ASSERT(instances[0] == nullptr, "Resource {} already instantiated.", name);
+        builder.SetAliasingMemory(memory, offset);
+        instances[0] = builder.Build();
+        return *instances[0];
+    }
+
+    void ReleaseInstance()
+    {
+        for (auto& instance : instances)
         {
-            instance = builder.Build();
+            instance.reset();
         }
+        bIsInstanceWritten.fill(false);
+    }
 
-        return *instance;
+    /**
+     * Multi-buffered resource owns an instance per in-flight frame, so frame does not wait for previous frame to release it.
+     * (ex. resources which are written by CPU every frame)
+     */
+    void MarkAsMultiBuffered()
+    {
+        SY_ASSERT(!bIsImported, "Imported resource {} can not be multi-buffered.", name);
+        bIsMultiBuffered = true;
+    }
+
+    /** History resource is multi-buffered, and its instance of previous frame can be read by nodes of current frame. (ex. TAA) */
+    void MarkAsHistory()
+    {
+        static_assert(vk::NumMaxInFlightFrames > 1, "History resource requires at least two in-flight frames.");
+        MarkAsMultiBuffered();
+        bIsHistory = true;
+    }
+
+    [[nodiscard]] bool   IsMultiBuffered() const { return bIsMultiBuffered; }
+    [[nodiscard]] bool   IsHistory() const { return bIsHistory; }
+    [[nodiscard]] size_t GetNumInstances() const { return bIsMultiBuffered ? vk::NumMaxInFlightFrames : 1; }
+
+    /** Select instance of in-flight frame. Single-buffered resource always uses its only instance. */
+    void SetInFlightFrameIndex(const size_t inFlightFrameIdx)
+    {
+        currentInstanceIdx = bIsMultiBuffered ? inFlightFrameIdx % vk::NumMaxInFlightFrames : 0;
+    }
+
+    void MarkCurrentInstanceAsWritten() { bIsInstanceWritten[currentInstanceIdx] = true; }
+    /** Previous instance of history is not valid until it has been written at least once. */
+    [[nodiscard]] bool HasHistory() const { return bIsHistory && bIsInstanceWritten[GetPreviousInstanceIndex()]; }
+
+    /** Imported resource is owned outside of graph(ex. swapchain image), so it never placed on transient heaps. Writes to it are outputs of graph. */
+    void MarkAsImported() { bIsImported = true; }
+    void Import(T& external)
+    {
+        MarkAsImported();
+        importedInstance = &external;
     }
 
-	void WriteBy(const std::string writerName)
+    /** Exported resource is consumed after graph executed(ex. readback target). It keeps its writers from being culled. */
+    void MarkAsExported() { bIsExported = true; }
+
+    [[nodiscard]] bool IsImported() const { return bIsImported; }
+    [[nodiscard]] bool IsExported() const { return bIsExported; }
+
+    [[nodiscard]] VkMemoryRequirements QueryMemoryRequirements() const { return T::QueryMemoryRequirements(builder); }
+
+    /** Inclusive range of execution order which resource must be alive. Valid after RenderGraph::Compile. */
+    void SetLifetime(const size_t firstUse, const size_t lastUse)
+    {
+        SY_ASSERT(firstUse <= lastUse, "Invalid lifetime of resource {}.", name);
+        this->firstUse = firstUse;
+        this->lastUse  = lastUse;
+        bHasLifetime   = true;
+    }
+
+    /** Resource which is not used by any of executed nodes does not have lifetime. */
+    void ClearLifetime() { bHasLifetime = false; }
+    [[nodiscard]] bool HasLifetime() const { return bHasLifetime; }
+
+	void WriteBy(const std::string_view writerName, const StateType state)
 	{
         SY_ASSERT(!HasWriter(), "Resource {} already created by node:{}", name, writer);
         writer = writerName;
+        writerState = state;
 	}
 
     void ReadBy(const std::string_view readerName, const StateType state)
@@ -48,21 +137,81 @@ public:
         readerStateMap[readerName.data()] = state;
     }
 
+    /** Access states are parameters of graph. Changing them only reschedules state transitions at next compile. */
+    void UpdateWriterState(const StateType state)
+    {
+        SY_ASSERT(HasWriter(), "Resource {} does not have writer.", name);
+        writerState = state;
+    }
+
+    void UpdateReaderState(const std::string_view readerName, const StateType state)
+    {
+        SY_ASSERT(IsReadBy(readerName), "Resource {} does not read by {}.", name, readerName);
+        readerStateMap[readerName.data()] = state;
+    }
+
+    /** Reader accesses instance of previous frame. It does not depend on writer of current frame, so writer itself may read history too. */
+    void ReadHistoryBy(const std::string_view readerName, const StateType state)
+    {
+        SY_ASSERT(!IsHistoryReadBy(readerName), "History of resource {} already read by {}.", name, readerName);
+        MarkAsHistory();
+        historyReaders.insert(readerName.data());
+        historyReaderStateMap[readerName.data()] = state;
+    }
+
 	[[nodiscard]] std::string_view GetWriter() const { return writer; }
+    [[nodiscard]] StateType GetWriterState() const { return writerState; }
+    [[nodiscard]] StateType GetReaderState(const std::string_view readerName) const { return readerStateMap.at(readerName.data()); }
     [[nodiscard]] bool HasWriter() const { return !writer.empty(); }
     [[nodiscard]] bool IsWriteBy(const std::string_view writerName) const { return writerName == writer; }
     [[nodiscard]] bool IsReadBy(const std::string_view readerName) const { return readers.contains(readerName.data()); }
     [[nodiscard]] std::string_view GetName() const { return name; }
+    /** Dense ID shared by every resources of graph, in creation order. */
+    [[nodiscard]] size_t GetId() const { return id; }
     [[nodiscard]] BuilderType& GetBuilder() { return builder; }
+    [[nodiscard]] const BuilderType& GetBuilder() const { return builder; }
     [[nodiscard]] const auto& GetReaders() const { return readers; }
+    [[nodiscard]] StateType GetHistoryReaderState(const std::string_view readerName) const { return historyReaderStateMap.at(readerName.data()); }
+    [[nodiscard]] bool IsHistoryReadBy(const std::string_view readerName) const { return historyReaders.contains(readerName.data()); }
+    [[nodiscard]] const auto& GetHistoryReaders() const { return historyReaders; }
+    [[nodiscard]] bool IsInstantiated() const { return instances[currentInstanceIdx] != nullptr || importedInstance != nullptr; }
+    [[nodiscard]] T& GetInstance() const
+    {
+        SY_ASSERT(IsInstantiated(), "Resource {} does not instantiated.", name);
+        return importedInstance != nullptr ? *importedInstance : *instances[currentInstanceIdx];
+    }
+    [[nodiscard]] T& GetPreviousInstance() const
+    {
+        SY_ASSERT(bIsHistory && instances[GetPreviousInstanceIndex()] != nullptr, "Resource {} does not have history instance.", name);
+        return *instances[GetPreviousInstanceIndex()];
+    }
+    [[nodiscard]] size_t GetFirstUse() const { return firstUse; }
+    [[nodiscard]] size_t GetLastUse() const { return lastUse; }
+
+private:
+    [[nodiscard]] size_t GetPreviousInstanceIndex() const { return (currentInstanceIdx + vk::NumMaxInFlightFrames - 1) % vk::NumMaxInFlightFrames; }
 
 private:
     const std::string name;
-    std::unique_ptr<T> instance = nullptr;
+    const size_t id;
+    std::array<std::unique_ptr<T>, vk::NumMaxInFlightFrames> instances;
+    size_t currentInstanceIdx = 0;
+    std::array<bool, vk::NumMaxInFlightFrames> bIsInstanceWritten = {};
+    T* importedInstance = nullptr;
     BuilderType builder;
     std::string writer;
+    StateType writerState = StateType::None;
     robin_hood::unordered_set<std::string> readers;
     robin_hood::unordered_map<std::string, StateType> readerStateMap;
+    robin_hood::unordered_set<std::string> historyReaders;
+    robin_hood::unordered_map<std::string, StateType> historyReaderStateMap;
+    size_t firstUse = 0;
+    size_t lastUse = 0;
+    bool bHasLifetime = false;
+    bool bIsImported = false;
+    bool bIsExported = false;
+    bool bIsMultiBuffered = false;
+    bool bIsHistory = false;
 };
 
 
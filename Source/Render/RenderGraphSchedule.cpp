@@ -0,0 +1,422 @@
+#include <PCH.h>
+#include <Render/RenderGraphSchedule.h>
+
+namespace sy::render
+{
+static std::string EscapeGraphvizLabel(const std::string_view label)
+{
+    std::string escaped;
+    escaped.reserve(label.size());
+    for (const char character : label)
+    {
+        if (character == '"' || character == '\\')
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(character);
+    }
+
+    return escaped;
+}
+
+static std::string_view QueryQueueColor(const std::string_view queue)
+{
+    if (queue == "Graphics")
+    {
+        return "lightblue";
+    }
+
+    if (queue == "Compute")
+    {
+        return "palegreen";
+    }
+
+    if (queue == "Transfer")
+    {
+        return "khaki";
+    }
+
+    return "white";
+}
+
+static std::string FormatIndices(const json& indices)
+{
+    std::string formatted = "[";
+    for (size_t idx = 0; idx < indices.size(); ++idx)
+    {
+        formatted += std::format("{}{}", idx > 0 ? ", " : "", indices[idx].get<size_t>());
+    }
+    formatted += "]";
+    return formatted;
+}
+
+std::string RenderGraphSchedule::ToGraphviz(const json& schedule)
+{
+    namespace key = schedule_key;
+    std::ostringstream dot;
+    dot << "digraph RenderGraph\n{\n";
+    dot << "    rankdir=LR;\n";
+    dot << "    node [shape=box, style=\"rounded,filled\", fontname=\"Consolas\"];\n";
+    dot << "    edge [fontname=\"Consolas\", fontsize=10];\n";
+
+    const json  empty     = json::array();
+    const json& nodes     = schedule.contains(key::Nodes) ? schedule[key::Nodes] : empty;
+    const json& scopes    = schedule.contains(key::RenderingScopes) ? schedule[key::RenderingScopes] : empty;
+    const json& batches   = schedule.contains(key::Batches) ? schedule[key::Batches] : empty;
+    const json& culled    = schedule.contains(key::CulledNodes) ? schedule[key::CulledNodes] : empty;
+    const json& splits    = schedule.contains(key::SplitBarriers) ? schedule[key::SplitBarriers] : empty;
+    const json& resources = schedule.contains(key::Resources) ? schedule[key::Resources] : empty;
+
+    robin_hood::unordered_map<std::string, size_t> executionIndexOfNode;
+    std::map<std::string, std::vector<size_t>>     nodesOfQueue;
+    for (const json& node : nodes)
+    {
+        const size_t executionIdx = node[key::ExecutionIndex];
+        executionIndexOfNode[node[key::Name].get<std::string>()] = executionIdx;
+        nodesOfQueue[node[key::Queue].get<std::string>()].emplace_back(executionIdx);
+    }
+
+    /** Rendering scopes are nested clusters in cluster of their queue. */
+    std::vector<std::optional<size_t>> scopeOfNode(nodes.size());
+    for (size_t scopeIdx = 0; scopeIdx < scopes.size(); ++scopeIdx)
+    {
+        const size_t firstNode = scopes[scopeIdx][key::FirstNode];
+        const size_t lastNode  = scopes[scopeIdx][key::LastNode];
+        for (size_t executionIdx = firstNode; executionIdx <= lastNode && executionIdx < scopeOfNode.size(); ++executionIdx)
+        {
+            scopeOfNode[executionIdx] = scopeIdx;
+        }
+    }
+
+    for (const auto& [queue, executionIndices] : nodesOfQueue)
+    {
+        dot << std::format("    subgraph cluster_{}\n    {{\n", queue);
+        dot << std::format("        label=\"{}\";\n", EscapeGraphvizLabel(queue));
+        std::optional<size_t> openedScope;
+        for (const size_t executionIdx : executionIndices)
+        {
+            if (openedScope != scopeOfNode[executionIdx])
+            {
+                if (openedScope)
+                {
+                    dot << "        }\n";
+                }
+
+                openedScope = scopeOfNode[executionIdx];
+                if (openedScope)
+                {
+                    dot << std::format("        subgraph cluster_scope{}\n        {{\n", *openedScope);
+                    dot << std::format("            label=\"Rendering Scope {}\";\n            style=dashed;\n", *openedScope);
+                }
+            }
+
+            const json& node = nodes[executionIdx];
+            dot << std::format("        {}n{} [label=\"{}\\nLevel {} | Sync {} | Batch {}\\nSSIS {} -> {}\", fillcolor={}];\n",
+                               openedScope ? "    " : "",
+                               executionIdx,
+                               EscapeGraphvizLabel(node[key::Name].get<std::string>()),
+                               node[key::DependencyLevel].get<size_t>(),
+                               node[key::SynchronizationIndex].get<size_t>(),
+                               node[key::Batch].dump(),
+                               FormatIndices(node[key::SSISNow]),
+                               FormatIndices(node[key::SSISNext]),
+                               QueryQueueColor(queue));
+        }
+
+        if (openedScope)
+        {
+            dot << "        }\n";
+        }
+        dot << "    }\n";
+    }
+
+    for (size_t idx = 0; idx < culled.size(); ++idx)
+    {
+        dot << std::format("    culled{} [label=\"{}\\n(culled)\", fillcolor=lightgray, style=\"rounded,filled,dashed\"];\n",
+                           idx, EscapeGraphvizLabel(culled[idx].get<std::string>()));
+    }
+
+    /** Resource edges from writer to every readers; imported resources without writer are drawn as its own node. */
+    for (size_t resourceIdx = 0; resourceIdx < resources.size(); ++resourceIdx)
+    {
+        const json&       resourceJson = resources[resourceIdx];
+        const std::string name         = EscapeGraphvizLabel(resourceJson[key::Name].get<std::string>());
+        std::string       source;
+        std::string       sourceState;
+        if (resourceJson.contains(key::Writer))
+        {
+            const auto writerItr = executionIndexOfNode.find(resourceJson[key::Writer].get<std::string>());
+            if (writerItr == executionIndexOfNode.end())
+            {
+                continue;
+            }
+
+            source      = std::format("n{}", writerItr->second);
+            sourceState = resourceJson[key::WriterState].get<std::string>();
+        }
+        else if (resourceJson[key::IsImported].get<bool>())
+        {
+            source      = std::format("resource{}", resourceIdx);
+            sourceState = "Imported";
+            dot << std::format("    {} [label=\"{}\", shape=note, fillcolor=white];\n", source, name);
+        }
+        else
+        {
+            continue;
+        }
+
+        for (const json& reader : resourceJson[key::Readers])
+        {
+            const auto readerItr = executionIndexOfNode.find(reader[key::Node].get<std::string>());
+            if (readerItr != executionIndexOfNode.end())
+            {
+                dot << std::format("    {} -> n{} [label=\"{}\\n{} -> {}\"];\n",
+                                   source, readerItr->second, name, sourceState, reader[key::State].get<std::string>());
+            }
+        }
+    }
+
+    /** Semaphore waits between batches of different queues. */
+    for (const json& batch : batches)
+    {
+        const json& batchNodes = batch[key::Nodes];
+        if (batchNodes.empty())
+        {
+            continue;
+        }
+
+        for (const json& waitBatchIdx : batch[key::WaitBatches])
+        {
+            const json& waitBatchNodes = batches[waitBatchIdx.get<size_t>()][key::Nodes];
+            if (!waitBatchNodes.empty())
+            {
+                dot << std::format("    n{} -> n{} [color=red, penwidth=2, style=bold, label=\"semaphore\"];\n",
+                                   waitBatchNodes.back().get<size_t>(), batchNodes.front().get<size_t>());
+            }
+        }
+    }
+
+    for (const json& split : splits)
+    {
+        const size_t numTransitions = split[key::Textures].size() + split[key::Buffers].size();
+        dot << std::format("    n{} -> n{} [color=blue, style=dashed, constraint=false, label=\"event ({} transitions)\"];\n",
+                           split[key::SignalNode].get<size_t>(), split[key::WaitNode].get<size_t>(), numTransitions);
+    }
+
+    dot << "}\n";
+    return dot.str();
+}
+
+robin_hood::unordered_map<std::string, double> RenderGraphSchedule::LoadNodeCosts(const json& costs)
+{
+    robin_hood::unordered_map<std::string, double> nodeCosts;
+    if (!costs.is_object())
+    {
+        return nodeCosts;
+    }
+
+    for (const auto& [node, cost] : costs.items())
+    {
+        if (cost.is_number())
+        {
+            nodeCosts[node] = cost.get<double>();
+        }
+        else
+        {
+            spdlog::warn("[RenderGraphSchedule] Cost of node {} is not a number.", node);
+        }
+    }
+
+    return nodeCosts;
+}
+
+std::optional<RenderGraphSchedule::SimulationResult> RenderGraphSchedule::Simulate(const json& schedule, const robin_hood::unordered_map<std::string, double>& nodeCosts)
+{
+    return Simulate(schedule, nodeCosts, SimulationConfig{});
+}
+
+std::optional<RenderGraphSchedule::SimulationResult> RenderGraphSchedule::Simulate(const json& schedule, const robin_hood::unordered_map<std::string, double>& nodeCosts, const SimulationConfig& config)
+{
+    namespace key = schedule_key;
+    if (!schedule.contains(key::Nodes) || !schedule.contains(key::Batches))
+    {
+        spdlog::error("[RenderGraphSchedule] Schedule does not contain nodes or batches.");
+        return std::nullopt;
+    }
+
+    const json& nodes   = schedule[key::Nodes];
+    const json& batches = schedule[key::Batches];
+
+    SimulationResult result;
+    result.Nodes.resize(nodes.size());
+    std::vector<double> costs(nodes.size(), config.DefaultNodeCostMs);
+    for (const json& node : nodes)
+    {
+        const size_t executionIdx = node[key::ExecutionIndex];
+        if (executionIdx >= nodes.size())
+        {
+            spdlog::error("[RenderGraphSchedule] Execution index {} is out of range.", executionIdx);
+            return std::nullopt;
+        }
+
+        SimulatedNode& simulated = result.Nodes[executionIdx];
+        simulated.Name           = node[key::Name];
+        simulated.Queue          = node[key::Queue];
+        if (const auto costItr = nodeCosts.find(simulated.Name); costItr != nodeCosts.end())
+        {
+            costs[executionIdx] = costItr->second;
+        }
+        result.SerialMs += costs[executionIdx];
+        result.QueueBusyMs[simulated.Queue] += costs[executionIdx];
+    }
+
+    /** Batch depends on previous batch of its queue and every batches it waits. */
+    std::vector<std::vector<size_t>>             dependencies(batches.size());
+    std::map<std::string, std::optional<size_t>> lastBatchOfQueue;
+    for (size_t batchIdx = 0; batchIdx < batches.size(); ++batchIdx)
+    {
+        const std::string queue = batches[batchIdx][key::Queue];
+        if (const auto prevBatch = lastBatchOfQueue[queue]; prevBatch)
+        {
+            dependencies[batchIdx].emplace_back(*prevBatch);
+        }
+        lastBatchOfQueue[queue] = batchIdx;
+
+        for (const json& waitBatchIdx : batches[batchIdx][key::WaitBatches])
+        {
+            if (waitBatchIdx.get<size_t>() >= batches.size())
+            {
+                spdlog::error("[RenderGraphSchedule] Batch {} waits invalid batch {}.", batchIdx, waitBatchIdx.get<size_t>());
+                return std::nullopt;
+            }
+            dependencies[batchIdx].emplace_back(waitBatchIdx.get<size_t>());
+        }
+    }
+
+    /** Node which determines start time of each node, for backtracking critical path. */
+    std::vector<std::optional<size_t>> predecessors(nodes.size());
+    std::vector<std::optional<double>> batchFinishes(batches.size());
+    std::vector<std::optional<size_t>> lastNodeOfBatch(batches.size());
+    size_t                             numSimulatedBatches = 0;
+    while (numSimulatedBatches < batches.size())
+    {
+        bool bIsProgressed = false;
+        for (size_t batchIdx = 0; batchIdx < batches.size(); ++batchIdx)
+        {
+            const bool bIsReady = std::all_of(dependencies[batchIdx].cbegin(), dependencies[batchIdx].cend(),
+                                              [&batchFinishes](const size_t dependency) { return batchFinishes[dependency].has_value(); });
+            if (batchFinishes[batchIdx] || !bIsReady)
+            {
+                continue;
+            }
+
+            const json&           batch = batches[batchIdx];
+            double                start = 0.0;
+            std::optional<size_t> predecessor;
+            for (const size_t dependency : dependencies[batchIdx])
+            {
+                const bool   bIsCrossQueue = batches[dependency][key::Queue] != batch[key::Queue];
+                const double ready         = *batchFinishes[dependency] + (bIsCrossQueue ? config.QueueSyncLatencyMs : 0.0);
+                if (ready > start || !predecessor)
+                {
+                    start       = std::max(start, ready);
+                    predecessor = lastNodeOfBatch[dependency];
+                }
+            }
+
+            for (const json& nodeJson : batch[key::Nodes])
+            {
+                const size_t executionIdx = nodeJson;
+                if (executionIdx >= nodes.size())
+                {
+                    spdlog::error("[RenderGraphSchedule] Batch {} contains invalid node {}.", batchIdx, executionIdx);
+                    return std::nullopt;
+                }
+
+                SimulatedNode& node        = result.Nodes[executionIdx];
+                node.StartMs               = start;
+                node.FinishMs              = start + costs[executionIdx];
+                predecessors[executionIdx] = predecessor;
+                start                      = node.FinishMs;
+                predecessor                = executionIdx;
+            }
+
+            batchFinishes[batchIdx]   = start;
+            lastNodeOfBatch[batchIdx] = predecessor;
+            result.TotalMs            = std::max(result.TotalMs, start);
+            ++numSimulatedBatches;
+            bIsProgressed = true;
+        }
+
+        if (!bIsProgressed)
+        {
+            spdlog::error("[RenderGraphSchedule] Batches of schedule have circular wait.");
+            return std::nullopt;
+        }
+    }
+
+    std::optional<size_t> lastNode;
+    for (size_t executionIdx = 0; executionIdx < result.Nodes.size(); ++executionIdx)
+    {
+        if (!lastNode || result.Nodes[executionIdx].FinishMs > result.Nodes[*lastNode].FinishMs)
+        {
+            lastNode = executionIdx;
+        }
+    }
+
+    for (std::optional<size_t> current = lastNode; current; current = predecessors[*current])
+    {
+        result.CriticalPath.emplace_back(result.Nodes[*current].Name);
+    }
+    std::reverse(result.CriticalPath.begin(), result.CriticalPath.end());
+
+    return result;
+}
+
+bool RenderGraphSchedule::RunSimulationTool(const fs::path& schedulePath, const fs::path& nodeCostsPath)
+{
+    if (!fs::exists(schedulePath))
+    {
+        spdlog::error("[RenderGraphSchedule] Schedule dump {} does not exist.", schedulePath.string());
+        return false;
+    }
+
+    const json schedule = LoadJsonFromFile(schedulePath);
+    const auto costs    = nodeCostsPath.empty() ? robin_hood::unordered_map<std::string, double>{} : LoadNodeCosts(LoadJsonFromFile(nodeCostsPath));
+    const auto result   = Simulate(schedule, costs);
+    if (!result)
+    {
+        return false;
+    }
+
+    spdlog::info("[RenderGraphSchedule] {} nodes, {} cost estimates.", result->Nodes.size(), costs.size());
+    for (const SimulatedNode& node : result->Nodes)
+    {
+        spdlog::info("{:<32} {:<10} {:>9.3f} ms ~ {:>9.3f} ms", node.Name, node.Queue, node.StartMs, node.FinishMs);
+    }
+
+    for (const auto& [queue, busyMs] : result->QueueBusyMs)
+    {
+        spdlog::info("[RenderGraphSchedule] Queue {} busy {:.3f} ms ({:.1f}%)", queue, busyMs, result->TotalMs > 0.0 ? busyMs / result->TotalMs * 100.0 : 0.0);
+    }
+
+    std::string criticalPath;
+    for (const std::string& node : result->CriticalPath)
+    {
+        criticalPath += criticalPath.empty() ? node : std::format(" -> {}", node);
+    }
+    spdlog::info("[RenderGraphSchedule] Critical path: {}", criticalPath);
+    spdlog::info("[RenderGraphSchedule] Frame {:.3f} ms, serial {:.3f} ms. (x{:.2f})",
+                 result->TotalMs, result->SerialMs, result->TotalMs > 0.0 ? result->SerialMs / result->TotalMs : 1.0);
+
+    fs::path      dotPath = fs::path{schedulePath}.replace_extension(".dot");
+    std::ofstream dotFile{dotPath, std::ios::out | std::ios::trunc};
+    if (dotFile.is_open())
+    {
+        dotFile << ToGraphviz(schedule);
+        spdlog::info("[RenderGraphSchedule] Graphviz written to {}.", dotPath.string());
+    }
+
+    return true;
+}
+} // namespace sy::render
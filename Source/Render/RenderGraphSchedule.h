@@ -0,0 +1,112 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::render
+{
+/** Keys of schedule dump, which is written by RenderGraph::BuildScheduleDump. */
+namespace schedule_key
+{
+constexpr std::string_view Version                = "Version";
+constexpr std::string_view Nodes                  = "Nodes";
+constexpr std::string_view CulledNodes            = "CulledNodes";
+constexpr std::string_view Resources              = "Resources";
+constexpr std::string_view Batches                = "Batches";
+constexpr std::string_view RenderingScopes        = "RenderingScopes";
+constexpr std::string_view SplitBarriers          = "SplitBarriers";
+constexpr std::string_view AliasingHeaps          = "AliasingHeaps";
+constexpr std::string_view Name                   = "Name";
+constexpr std::string_view Type                   = "Type";
+constexpr std::string_view Queue                  = "Queue";
+constexpr std::string_view ExecutionIndex         = "ExecutionIndex";
+constexpr std::string_view DependencyLevel        = "DependencyLevel";
+constexpr std::string_view SynchronizationIndex   = "SynchronizationIndex";
+constexpr std::string_view SSISNow                = "SSISNow";
+constexpr std::string_view SSISNext               = "SSISNext";
+constexpr std::string_view Batch                  = "Batch";
+constexpr std::string_view RenderingScope         = "RenderingScope";
+constexpr std::string_view ReleasedBy             = "ReleasedBy";
+constexpr std::string_view Textures               = "Textures";
+constexpr std::string_view Buffers                = "Buffers";
+constexpr std::string_view ReleaseTextures        = "ReleaseTextures";
+constexpr std::string_view ReleaseBuffers         = "ReleaseBuffers";
+constexpr std::string_view RestoreTextures        = "RestoreTextures";
+constexpr std::string_view Resource               = "Resource";
+constexpr std::string_view Source                 = "Source";
+constexpr std::string_view Destination            = "Destination";
+constexpr std::string_view SourceQueue            = "SourceQueue";
+constexpr std::string_view DestinationQueue       = "DestinationQueue";
+constexpr std::string_view IsImported             = "IsImported";
+constexpr std::string_view IsExported             = "IsExported";
+constexpr std::string_view FirstUse               = "FirstUse";
+constexpr std::string_view LastUse                = "LastUse";
+constexpr std::string_view Writer                 = "Writer";
+constexpr std::string_view WriterState            = "WriterState";
+constexpr std::string_view Readers                = "Readers";
+constexpr std::string_view HistoryReaders         = "HistoryReaders";
+constexpr std::string_view IsHistory              = "IsHistory";
+constexpr std::string_view IsAfterHistory         = "IsAfterHistory";
+constexpr std::string_view NumInstances           = "NumInstances";
+constexpr std::string_view Node                   = "Node";
+constexpr std::string_view State                  = "State";
+constexpr std::string_view WaitBatches            = "WaitBatches";
+constexpr std::string_view FirstNode              = "FirstNode";
+constexpr std::string_view LastNode               = "LastNode";
+constexpr std::string_view ColorAttachments       = "ColorAttachments";
+constexpr std::string_view DepthStencilAttachment = "DepthStencilAttachment";
+constexpr std::string_view LoadOp                 = "LoadOp";
+constexpr std::string_view StoreOp                = "StoreOp";
+constexpr std::string_view SignalNode             = "SignalNode";
+constexpr std::string_view WaitNode               = "WaitNode";
+constexpr std::string_view Size                   = "Size";
+constexpr std::string_view Offset                 = "Offset";
+} // namespace schedule_key
+
+/**
+ * CPU-only tools for schedule dump of RenderGraph, so schedules can be inspected and evaluated without GPU.
+ * Simulation replays batches of dump on ideal queues: nodes of a queue run back to back, and batch begins once its queue and every waited batches are done.
+ */
+class RenderGraphSchedule
+{
+public:
+    constexpr static uint32_t Version = 1;
+
+    struct SimulationConfig
+    {
+        /** Cost of node which does not have estimate. */
+        double DefaultNodeCostMs  = 0.1;
+        /** Latency of semaphore wait between queues. */
+        double QueueSyncLatencyMs = 0.0;
+    };
+
+    struct SimulatedNode
+    {
+        std::string Name;
+        std::string Queue;
+        double      StartMs  = 0.0;
+        double      FinishMs = 0.0;
+    };
+
+    struct SimulationResult
+    {
+        /** Indexed by execution index. */
+        std::vector<SimulatedNode>    Nodes;
+        /** Node names from beginning of frame to the last finished node. */
+        std::vector<std::string>      CriticalPath;
+        std::map<std::string, double> QueueBusyMs;
+        double                        TotalMs  = 0.0;
+        /** Every nodes executed on single queue. */
+        double                        SerialMs = 0.0;
+    };
+
+public:
+    [[nodiscard]] static std::string ToGraphviz(const json& schedule);
+    /** Node costs are json object of node name to milliseconds. (ex. RenderGraphProfiler::BuildCostEstimates) */
+    [[nodiscard]] static robin_hood::unordered_map<std::string, double> LoadNodeCosts(const json& costs);
+    /** Returns empty if schedule is malformed. */
+    [[nodiscard]] static std::optional<SimulationResult> Simulate(const json& schedule, const robin_hood::unordered_map<std::string, double>& nodeCosts);
+    [[nodiscard]] static std::optional<SimulationResult> Simulate(const json& schedule, const robin_hood::unordered_map<std::string, double>& nodeCosts, const SimulationConfig& config);
+
+    /** Command line tool; loads schedule dump and node costs(optional), then logs simulated result and writes Graphviz next to the dump. */
+    static bool RunSimulationTool(const fs::path& schedulePath, const fs::path& nodeCostsPath);
+};
+} // namespace sy::render
@@ -10,20 +10,23 @@ RenderNode::RenderNode(RenderGraph& renderGraph, const std::string_view name) :
 {
 }
 
-RenderGraphTexture& RenderNode::CreateTexture(const std::string_view textureName)
+RenderGraphTexture& RenderNode::CreateTexture(const std::string_view textureName, const vk::ETextureState state, const VkImageUsageFlags usage)
 {
     SY_ASSERT(!textureName.empty(), "Texture name is empty.");
     AsWriteDependency(textureName);
     RenderGraphTexture& texture = renderGraph.GetOrCreateTexture(textureName);
-    texture.WriteBy(this->name);
+    texture.WriteBy(this->name, state);
+    texture.GetBuilder().AddUsage(usage);
     return texture;
 }
-RenderGraphBuffer& RenderNode::CreateBuffer(const std::string_view bufferName)
+
+RenderGraphBuffer& RenderNode::CreateBuffer(const std::string_view bufferName, const vk::EBufferState state, const VkBufferUsageFlags usage)
 {
     SY_ASSERT(!bufferName.empty(), "Buffer name is empty.");
     AsWriteDependency(bufferName);
     RenderGraphBuffer& buffer = renderGraph.GetOrCreateBuffer(bufferName);
-    buffer.WriteBy(this->name);
+    buffer.WriteBy(this->name, state);
+    buffer.GetBuilder().AddUsage(usage);
     return buffer;
 }
 
@@ -42,7 +45,7 @@ void RenderNode::AsReadDependency(const std::string_view resourceName, const VkI
     texture.GetBuilder().AddUsage(usage);
 }
 
-void RenderNode::AsReadDependency(const std::string_view resourceName, const VkImageUsageFlags usage, const vk::EBufferState state)
+void RenderNode::AsReadDependency(const std::string_view resourceName, const VkBufferUsageFlags usage, const vk::EBufferState state)
 {
     SY_ASSERT(!resourceName.empty(), "Resource Name is empty.");
     auto& buffer = renderGraph.GetOrCreateBuffer(resourceName);
@@ -51,6 +54,42 @@ void RenderNode::AsReadDependency(const std::string_view resourceName, const VkI
     buffer.GetBuilder().AddUsage(usage);
 }
 
+void RenderNode::AsHistoryReadDependency(const std::string_view resourceName, const VkImageUsageFlags usage, const vk::ETextureState state)
+{
+    SY_ASSERT(!resourceName.empty(), "Resource Name is empty.");
+    auto& texture = renderGraph.GetOrCreateTexture(resourceName);
+    historyReadDependencies.insert(resourceName.data());
+    texture.ReadHistoryBy(this->name, state);
+    texture.GetBuilder().AddUsage(usage);
+}
+
+void RenderNode::AsHistoryReadDependency(const std::string_view resourceName, const VkBufferUsageFlags usage, const vk::EBufferState state)
+{
+    SY_ASSERT(!resourceName.empty(), "Resource Name is empty.");
+    auto& buffer = renderGraph.GetOrCreateBuffer(resourceName);
+    historyReadDependencies.insert(resourceName.data());
+    buffer.ReadHistoryBy(this->name, state);
+    buffer.GetBuilder().AddUsage(usage);
+}
+
+void RenderNode::SetClearValue(const std::string_view textureName, const VkClearValue& clearValue)
+{
+    SY_ASSERT(writeDependencies.contains(textureName.data()), "Node {} does not write texture {}.", name, textureName);
+    clearValues[textureName.data()] = clearValue;
+}
+
+std::optional<VkClearValue> RenderNode::QueryClearValue(const std::string_view textureName) const
+{
+    const auto itr = clearValues.find(textureName.data());
+    return itr != clearValues.end() ? std::optional<VkClearValue>{itr->second} : std::nullopt;
+}
+
+void RenderNode::ExecuteOn(const vk::EQueueType queueType)
+{
+    SY_ASSERT(RenderGraph::IsSupportedQueue(queueType), "Render graph does not support queue {}.", magic_enum::enum_name(queueType));
+    this->queueType = queueType;
+}
+
 void RenderNode::AsWriteDependency(const std::string_view resourceName)
 {
     SY_ASSERT(!writeDependencies.contains(resourceName.data()), "Self write dependency occurs.");
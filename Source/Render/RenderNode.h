@@ -2,6 +2,11 @@
 #include <PCH.h>
 #include <Render/RenderGraphResource.h>
 
+namespace sy::vk
+{
+class CommandBuffer;
+}
+
 namespace sy::render
 {
 class RenderGraph;
@@ -11,23 +16,51 @@ public:
     RenderNode(RenderGraph& renderGraph, std::string_view name);
     ~RenderNode() override = default;
 
-    RenderGraphTexture& CreateTexture(std::string_view textureName);
-    RenderGraphBuffer& CreateBuffer(std::string_view bufferName);
+    RenderGraphTexture& CreateTexture(std::string_view textureName, vk::ETextureState state = vk::ETextureState::ColorAttachmentWrite, VkImageUsageFlags usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+    RenderGraphBuffer& CreateBuffer(std::string_view bufferName, vk::EBufferState state = vk::EBufferState::ComputeShaderWrite, VkBufferUsageFlags usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
 
     void AsGenaralSampledImage(std::string_view resourceName, std::span<const vk::TextureSubResource> subresources = {});
+    void AsReadDependency(std::string_view resourceName, VkImageUsageFlags usage, vk::ETextureState state);
+    void AsReadDependency(std::string_view resourceName, VkBufferUsageFlags usage, vk::EBufferState state);
+    /** Read instance of previous frame. Resource becomes history resource, and its writer is kept alive as long as this node is alive. */
+    void AsHistoryReadDependency(std::string_view resourceName, VkImageUsageFlags usage, vk::ETextureState state);
+    void AsHistoryReadDependency(std::string_view resourceName, VkBufferUsageFlags usage, vk::EBufferState state);
+
+    /** Attachment written by this node is cleared at the beginning of its rendering scope instead of discarded. */
+    void SetClearValue(std::string_view textureName, const VkClearValue& clearValue);
+    [[nodiscard]] std::optional<VkClearValue> QueryClearValue(std::string_view textureName) const;
+
+    /**
+     * Record commands of node. Required state transitions are already applied by RenderGraph.
+     * If node accesses any attachments, it is recorded inside of rendering scope which is began by RenderGraph.
+     */
+    virtual void Record(vk::CommandBuffer& cmdBuffer) {}
 
     RenderGraph& GetRenderGraph() { return renderGraph; }
     const RenderGraph& GetRenderGraph() const { return renderGraph; }
     std::string_view GetName() const { return name; }
 
+    /** Dense ID in order of append to render graph. */
+    [[nodiscard]] size_t GetId() const { return id; }
+    void SetId(const size_t id) { this->id = id; }
+
     [[nodiscard]] bool HasAnyWriteDependency() const { return !writeDependencies.empty(); }
     [[nodiscard]] bool HasAnyReadDependency() const { return !readDependencies.empty(); }
 
 	[[nodiscard]] const auto& GetWriteDependencies() const { return writeDependencies; }
     [[nodiscard]] const auto& GetReadDependencies() const { return readDependencies; }
+    [[nodiscard]] const auto& GetHistoryReadDependencies() const { return historyReadDependencies; }
 
-	[[nodiscard]] bool IsExecuteOnAsyncCompute() const { return bIsExecuteOnAsyncCompute; }
-    void ExecuteOnAsyncCompute() { bIsExecuteOnAsyncCompute = true; }
+	[[nodiscard]] vk::EQueueType GetQueueType() const { return queueType; }
+	[[nodiscard]] bool IsExecuteOnAsyncCompute() const { return queueType == vk::EQueueType::Compute; }
+    void ExecuteOnAsyncCompute() { ExecuteOn(vk::EQueueType::Compute); }
+    /** Copy only node, such as streaming upload or readback, which overlaps with rendering on dedicated transfer queue. */
+    void ExecuteOnTransfer() { ExecuteOn(vk::EQueueType::Transfer); }
+    void ExecuteOn(vk::EQueueType queueType);
+
+    /** Node only records commands which async compute queue supports, so RenderGraph::PlaceAsyncCompute may move it between graphics and async compute. */
+    [[nodiscard]] bool IsAsyncComputeAllowed() const { return bIsAsyncComputeAllowed; }
+    void AllowAsyncCompute() { bIsAsyncComputeAllowed = true; }
 
 	[[nodiscard]] auto GetSynchronizationIndex() const { return synchronizationIdx; }
     void SetSynchronizationIndex(const size_t idx) { synchronizationIdx = idx; }
@@ -37,15 +70,17 @@ public:
 
 private:
     void AsWriteDependency(std::string_view resourceName);
-    void AsReadDependency(std::string_view resourceName, VkImageUsageFlags usage, vk::ETextureState state);
-    void AsReadDependency(std::string_view resourceName, VkImageUsageFlags usage, vk::EBufferState state);
 
 private:
     RenderGraph& renderGraph;
     const std::string name;
-    bool bIsExecuteOnAsyncCompute = false;
+    size_t id = 0;
+    vk::EQueueType queueType = vk::EQueueType::Graphics;
+    bool bIsAsyncComputeAllowed = false;
     robin_hood::unordered_set<std::string> writeDependencies;
     robin_hood::unordered_set<std::string> readDependencies;
+    robin_hood::unordered_set<std::string> historyReadDependencies;
+    robin_hood::unordered_map<std::string, VkClearValue> clearValues;
     size_t synchronizationIdx = 0;
     size_t dependencyLevel = 0;
 };
@@ -1,5 +1,6 @@
 #include <PCH.h>
 #include <Render/RenderPass.h>
+#include <Core/ThreadPool.h>
 #include <VK/VulkanContext.h>
 #include <VK/CommandPoolAllocator.h>
 #include <VK/CommandPool.h>
@@ -8,12 +9,24 @@
 namespace sy::render
 {
 RenderPass::RenderPass(std::string_view name, vk::VulkanContext& vulkanContext, const vk::Pipeline& pipeline) :
-    NamedType(name), vulkanContext(vulkanContext), pipeline(pipeline)
+    NamedType(name), vulkanContext(vulkanContext), pipeline(&pipeline)
+{
+}
+
+RenderPass::RenderPass(const std::string_view name, vk::VulkanContext& vulkanContext) :
+    NamedType(name), vulkanContext(vulkanContext)
+{
+}
+
+RenderPass::~RenderPass() noexcept
 {
 }
 
 void RenderPass::Begin(const vk::EQueueType queueType)
 {
+    this->queueType = queueType;
+    drawRanges      = SplitDraws(GetNumDraws(), GetNumRecordingThreads());
+
     auto& cmdPoolAllocator = vulkanContext.GetCommandPoolAllocator();
     auto& graphicsCmdPool = cmdPoolAllocator.RequestCommandPool(queueType);
     currentCmdBuffer = graphicsCmdPool.RequestCommandBuffer(std::format("{}_CommandBuffer", GetName()));
@@ -21,9 +34,87 @@ void RenderPass::Begin(const vk::EQueueType queueType)
     OnBegin();
 }
 
+void RenderPass::RenderDraws()
+{
+    if (drawRanges.size() <= 1)
+    {
+        RecordDrawRange(*currentCmdBuffer, Range<size_t>{.Offset = 0, .Size = GetNumDraws()});
+        return;
+    }
+
+    const VkCommandBufferInheritanceRenderingInfo renderingInheritance{
+        .sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+        .pNext                   = nullptr,
+        .flags                   = 0,
+        .viewMask                = 0,
+        .colorAttachmentCount    = static_cast<uint32_t>(colorFormats.size()),
+        .pColorAttachmentFormats = colorFormats.data(),
+        .depthAttachmentFormat   = depthFormat,
+        .stencilAttachmentFormat = stencilFormat,
+        .rasterizationSamples    = VK_SAMPLE_COUNT_1_BIT};
+
+    auto& cmdPoolAllocator = vulkanContext.GetCommandPoolAllocator();
+    secondaryCmdBuffers.resize(drawRanges.size());
+    recordingThreadPool->ParallelFor(drawRanges.size(), [this, &cmdPoolAllocator, &renderingInheritance](const size_t rangeIdx) {
+        const Range<size_t>&      range     = drawRanges[rangeIdx];
+        vk::ManagedCommandBuffer& cmdBuffer = secondaryCmdBuffers[rangeIdx];
+        cmdBuffer = cmdPoolAllocator.RequestCommandPool(queueType).RequestSecondaryCommandBuffer(std::format("{}_Secondary{}", GetName(), rangeIdx));
+        cmdBuffer->Begin(renderingInheritance);
+        RecordDrawRange(*cmdBuffer, range);
+        cmdBuffer->End();
+    });
+
+    CRefVec<vk::CommandBuffer> cmdBuffers;
+    cmdBuffers.reserve(secondaryCmdBuffers.size());
+    for (const vk::ManagedCommandBuffer& cmdBuffer : secondaryCmdBuffers)
+    {
+        cmdBuffers.emplace_back(*cmdBuffer);
+    }
+    currentCmdBuffer->ExecuteCommands(cmdBuffers);
+    secondaryCmdBuffers.clear();
+}
+
 void RenderPass::End()
 {
     OnEnd();
     currentCmdBuffer->End();
 }
+
+void RenderPass::RecordDrawRange(const vk::CommandBuffer& cmdBuffer, const Range<size_t>& range) const
+{
+    OnBeginDraws(cmdBuffer);
+    RecordDraws(cmdBuffer, range.Offset, range.Offset + range.Size);
+}
+
+size_t RenderPass::GetNumRecordingThreads() const
+{
+    return recordingThreadPool != nullptr ? recordingThreadPool->GetNumThreads() : 1;
+}
+
+std::vector<Range<size_t>> RenderPass::SplitDraws(const size_t numDraws, const size_t numThreads)
+{
+    const size_t numRanges = std::clamp<size_t>(numDraws / MinDrawsPerSecondaryCommandBuffer, 1, std::max<size_t>(numThreads, 1));
+    const size_t rangeSize = (numDraws + numRanges - 1) / numRanges;
+
+    std::vector<Range<size_t>> ranges;
+    ranges.reserve(numRanges);
+    for (size_t begin = 0; begin < numDraws; begin += rangeSize)
+    {
+        ranges.emplace_back(Range<size_t>{.Offset = begin, .Size = std::min(rangeSize, numDraws - begin)});
+    }
+
+    return ranges;
+}
+
+void RenderPass::SetRenderingFormats(const std::span<const VkFormat> colorFormats, const VkFormat depthFormat, const VkFormat stencilFormat)
+{
+    this->colorFormats.assign(colorFormats.begin(), colorFormats.end());
+    this->depthFormat   = depthFormat;
+    this->stencilFormat = stencilFormat;
+}
+
+VkRenderingFlags RenderPass::GetRenderingFlags() const
+{
+    return drawRanges.size() > 1 ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0;
+}
 } // namespace sy::render
@@ -1,6 +1,11 @@
 #pragma once
 #include <PCH.h>
 
+namespace sy
+{
+class ThreadPool;
+}
+
 namespace sy::vk
 {
 class VulkanRHI;
@@ -18,7 +23,7 @@ class RenderPass : public NamedType, public NonCopyable
 {
 public:
     RenderPass(std::string_view name, vk::VulkanContext& vulkanContext, const vk::Pipeline& pipeline);
-    virtual ~RenderPass() noexcept override = default;
+    virtual ~RenderPass() noexcept override;
 
     RenderPass(const RenderPass&) = delete;
     RenderPass(RenderPass&&)      = delete;
@@ -36,8 +41,9 @@ public:
     {
     }
 
-    virtual void Render() = 0;
-    void         End();
+    /** Records every draws of the pass, between Begin and End. Number of draws must not be changed since Begin. */
+    void RenderDraws();
+    void End();
 
     virtual void OnEnd()
     {
@@ -50,7 +56,8 @@ public:
 
     [[nodiscard]] const auto& GetPipeline() const
     {
-        return pipeline;
+        SY_ASSERT(pipeline != nullptr, "Render pass {} does not own a pipeline.", GetName());
+        return *pipeline;
     }
 
     [[nodiscard]] auto& GetCommandBuffer() const
@@ -58,10 +65,58 @@ public:
         return *currentCmdBuffer;
     }
 
+    /**
+     * Draws are split into contiguous ranges which are recorded in parallel into secondary command buffers,
+     * then executed from the primary command buffer in order. Each recording thread owns its command pools.
+     * Pool is owned outside and may be shared with other recorders. Null records serially.
+     */
+    void                 SetRecordingThreadPool(ThreadPool* threadPool) { recordingThreadPool = threadPool; }
+    [[nodiscard]] size_t GetNumRecordingThreads() const;
+
+    /** Ranges of draws recorded into each command buffer. Too few draws per range are not worth a secondary command buffer. */
+    [[nodiscard]] static std::vector<Range<size_t>> SplitDraws(size_t numDraws, size_t numThreads);
+
+protected:
+    /** Pass which binds pipelines of its own in OnBeginDraws or RecordDraws. */
+    RenderPass(std::string_view name, vk::VulkanContext& vulkanContext);
+
+    [[nodiscard]] virtual size_t GetNumDraws() const
+    {
+        return 0;
+    }
+
+    /** Called for every command buffer which draws are recorded into. Secondary command buffer inherits nothing but rendering, so pipeline and descriptors must be bound here. */
+    virtual void OnBeginDraws(const vk::CommandBuffer& cmdBuffer) const
+    {
+    }
+
+    /** Records draws in [begin, end). It can be called from multiple threads at once with disjoint ranges. */
+    virtual void RecordDraws(const vk::CommandBuffer& cmdBuffer, size_t begin, size_t end) const
+    {
+    }
+
+    /** Records a range of draws into command buffer of the range; it is what each recording thread runs during RenderDraws. */
+    void RecordDrawRange(const vk::CommandBuffer& cmdBuffer, const Range<size_t>& range) const;
+
+    /** Attachment formats of rendering begun at OnBegin; secondary command buffers must inherit exactly the same formats. */
+    void SetRenderingFormats(std::span<const VkFormat> colorFormats, VkFormat depthFormat, VkFormat stencilFormat);
+    /** Rendering of OnBegin must be begun with these flags. */
+    [[nodiscard]] VkRenderingFlags GetRenderingFlags() const;
+
 private:
+    constexpr static size_t MinDrawsPerSecondaryCommandBuffer = 256;
+
     vk::VulkanContext&  vulkanContext;
-    const vk::Pipeline& pipeline;
+    const vk::Pipeline* pipeline = nullptr;
 
+    vk::EQueueType           queueType = vk::EQueueType::Graphics;
     vk::ManagedCommandBuffer currentCmdBuffer;
+
+    ThreadPool*                           recordingThreadPool = nullptr;
+    std::vector<Range<size_t>>            drawRanges;
+    std::vector<vk::ManagedCommandBuffer> secondaryCmdBuffers;
+    std::vector<VkFormat>                 colorFormats;
+    VkFormat                              depthFormat   = VK_FORMAT_UNDEFINED;
+    VkFormat                              stencilFormat = VK_FORMAT_UNDEFINED;
 };
 } // namespace sy::render
@@ -14,6 +14,7 @@
 #include <VK/Semaphore.h>
 #include <VK/Sampler.h>
 #include <VK/Fence.h>
+#include <VK/UploadRingBuffer.h>
 #include <Render/Mesh.h>
 
 namespace sy::render
@@ -23,32 +24,6 @@ SimpleRenderPass::SimpleRenderPass(const std::string_view name,
                                    const vk::Pipeline& pipeline) :
     RenderPass(name, vulkanContext, pipeline)
 {
-    auto& cmdPoolAllocator = vulkanContext.GetCommandPoolAllocator();
-    const auto& frameTracker = vulkanContext.GetFrameTracker();
-    auto& descriptorAllocator = vulkanContext.GetDescriptorAllocator();
-
-    vk::BufferBuilder transformBufferBuilder{vulkanContext};
-    transformBufferBuilder.SetUsage(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT)
-        .SetMemoryUsage(VMA_MEMORY_USAGE_CPU_TO_GPU)
-        .SetSize<TransformUniformBuffer>();
-
-    for (size_t idx = 0; idx < vk::NumMaxInFlightFrames; ++idx)
-    {
-        transformBufferBuilder.SetName(std::format("SimpleRenderPass_Transform_Buffer_{}", idx));
-        transformBuffers[idx] = transformBufferBuilder.Build();
-
-        auto& graphicsCmdPool = cmdPoolAllocator.RequestCommandPool(vk::EQueueType::Graphics);
-        auto graphicsCmdBuffer = graphicsCmdPool.RequestCommandBuffer("Simple Render Pass Initial Sync");
-        graphicsCmdBuffer->Begin();
-
-		vk::BufferStateTransition transition{GetVulkanContext()};
-        transition.SetBuffer(*transformBuffers[idx]);
-        transition.SetSourceState(vk::EBufferState::None);
-        transition.SetDestinationState(vk::EBufferState::VertexShaderReadUniformBuffer);
-        graphicsCmdBuffer->End();
-        vulkanContext.GetRHI().SubmitImmediateTo(*graphicsCmdBuffer);
-        transformBufferIndices[idx] = descriptorAllocator.RequestDescriptor(*transformBuffers[idx]);
-    }
 }
 
 void SimpleRenderPass::OnBegin()
@@ -67,6 +42,7 @@ void SimpleRenderPass::OnBegin()
     const VkRenderingInfo renderingInfo{
         .sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR,
         .pNext = nullptr,
+        .flags = GetRenderingFlags(),
         .renderArea = VkRect2D{
             .offset = VkOffset2D{0, 0},
             .extent = VkExtent2D{windowExtent.width, windowExtent.height},
@@ -77,34 +53,44 @@ void SimpleRenderPass::OnBegin()
         .pDepthAttachment = depthAttachmentInfos.data(),
         .pStencilAttachment = depthAttachmentInfos.data()};
 
-    auto& vulkanContext = GetVulkanContext();
-    const auto& descriptorAllocator = vulkanContext.GetDescriptorAllocator();
-    const auto& pipeline = GetPipeline();
+    std::array colorFormats = {swapchainFormat};
+    SetRenderingFormats(colorFormats, depthFormat, depthFormat);
     graphicsCmdBuffer.BeginRendering(renderingInfo);
-    graphicsCmdBuffer.BindPipeline(pipeline);
-    graphicsCmdBuffer.BindDescriptorSet(descriptorAllocator.GetDescriptorSet(), pipeline);
 }
 
-void SimpleRenderPass::Render()
+size_t SimpleRenderPass::GetNumDraws() const
 {
-    const auto& vulkanContext = GetVulkanContext();
-    const auto& frameTracker = vulkanContext.GetFrameTracker();
-    const auto& graphicsCmdBuffer = GetCommandBuffer();
+    return meshes.size();
+}
+
+void SimpleRenderPass::OnBeginDraws(const vk::CommandBuffer& cmdBuffer) const
+{
+    const auto& descriptorAllocator = GetVulkanContext().GetDescriptorAllocator();
     const auto& pipeline = GetPipeline();
+    cmdBuffer.BindPipeline(pipeline);
+    descriptorAllocator.BindDescriptors(cmdBuffer, pipeline);
+}
 
-    const PushConstants pushConstants{
-        .textureIndex = static_cast<int>((*descriptor)->Offset),
-        .transformDataIndex = static_cast<int>(transformBufferIndices[frameTracker.GetFrameIndex()]
-                                                   ->Offset)};
+void SimpleRenderPass::RecordDraws(const vk::CommandBuffer& cmdBuffer, const size_t begin, const size_t end) const
+{
+    const auto& pipeline = GetPipeline();
+    for (size_t idx = begin; idx < end; ++idx)
+    {
+        const auto& mesh = meshes[idx];
+        const PushConstants pushConstants{
+            .textureIndex = static_cast<int>((*mesh->GetMaterial()->BaseTexture)->Offset),
+            .transformBufferIndex = transformBufferIndex,
+            .transformDataIndex = transformDataIndex};
 
-    std::array vertexBuffers = {CRef<vk::Buffer>(mesh->GetVertexBuffer())};
-    std::array offsets = {uint64_t()};
+        std::array vertexBuffers = {CRef<vk::Buffer>(mesh->GetVertexBuffer())};
+        std::array offsets = {uint64_t()};
 
-    graphicsCmdBuffer.BindVertexBuffers(0, vertexBuffers, offsets);
-    graphicsCmdBuffer.BindIndexBuffer(mesh->GetIndexBuffer());
-    graphicsCmdBuffer.PushConstants(pipeline, VK_SHADER_STAGE_ALL_GRAPHICS, pushConstants);
+        cmdBuffer.BindVertexBuffers(0, vertexBuffers, offsets);
+        cmdBuffer.BindIndexBuffer(mesh->GetIndexBuffer());
+        cmdBuffer.PushConstants(pipeline, VK_SHADER_STAGE_ALL_GRAPHICS, pushConstants);
 
-    graphicsCmdBuffer.DrawIndexed(static_cast<uint32_t>(mesh->GetNumIndices()), 1, 0, 0, 0);
+        cmdBuffer.DrawIndexed(static_cast<uint32_t>(mesh->GetNumIndices()), 1, 0, 0, 0);
+    }
 }
 
 void SimpleRenderPass::OnEnd()
@@ -122,23 +108,16 @@ void SimpleRenderPass::OnEnd()
 
 void SimpleRenderPass::UpdateBuffers()
 {
-    const auto& vulkanContext = GetVulkanContext();
-    const auto& vulkanRHI = vulkanContext.GetRHI();
-    const auto& frameTracker = vulkanContext.GetFrameTracker();
-    const auto& transformBuffer = *transformBuffers[frameTracker.GetFrameIndex()];
-    void* transformBufferMappedPtr = vulkanRHI.Map(transformBuffer);
-    memcpy(transformBufferMappedPtr, &transformData, sizeof(TransformUniformBuffer));
-    vulkanRHI.Unmap(transformBuffer);
-}
-
-void SimpleRenderPass::SetMesh(Handle<Mesh> mesh)
-{
-    this->mesh = mesh;
+    auto& uploadRingBuffer = GetVulkanContext().GetUploadRingBuffer();
+    const auto allocation = uploadRingBuffer.Upload(transformData);
+    SY_ASSERT(allocation.IsValid(), "Failed to upload transform data.");
+    transformBufferIndex = static_cast<int>(allocation.DescriptorIndex);
+    transformDataIndex = static_cast<int>(allocation.Offset / sizeof(TransformUniformBuffer));
 }
 
-void SimpleRenderPass::SetTextureDescriptor(const Handle<vk::Descriptor> descriptor)
+void SimpleRenderPass::SetMeshes(const std::span<const Handle<Mesh>> meshes)
 {
-    this->descriptor = descriptor;
+    this->meshes = meshes;
 }
 
 void SimpleRenderPass::SetWindowExtent(Extent2D<uint32_t> extent)
@@ -149,12 +128,14 @@ void SimpleRenderPass::SetWindowExtent(Extent2D<uint32_t> extent)
 void SimpleRenderPass::SetSwapchain(const vk::Swapchain& swapchain, VkClearColorValue clearColorValue)
 {
     swapchainImage = swapchain.GetCurrentImage();
+    swapchainFormat = swapchain.GetFormat();
     swapchainAttachmentInfo = swapchain.GetColorAttachmentInfo(clearColorValue);
 }
 
 void SimpleRenderPass::SetDepthStencilView(const vk::TextureView& depthStencilView)
 {
     depthAttachmentInfo = vk::DepthAttachmentInfo(depthStencilView);
+    depthFormat = depthStencilView.GetFormat();
 }
 
 void SimpleRenderPass::SetTransformData(const TransformUniformBuffer buffer)
@@ -18,6 +18,8 @@ struct TransformUniformBuffer
 struct PushConstants
 {
     int textureIndex;
+    /** Descriptor of upload ring buffer partition, and index of the transform data in it. */
+    int transformBufferIndex;
     int transformDataIndex;
 };
 
@@ -29,29 +31,33 @@ public:
     SimpleRenderPass(std::string_view name, vk::VulkanContext& vulkanContext, const vk::Pipeline& pipeline);
 
     virtual void OnBegin() override;
-    virtual void Render() override;
     virtual void OnEnd() override;
     virtual void UpdateBuffers() override;
 
-    void SetMesh(Handle<Mesh> mesh);
-    void SetTextureDescriptor(Handle<vk::Descriptor> descriptor);
+    /** Every meshes are drawn with base texture of its material. Meshes must outlive recording of the frame. */
+    void SetMeshes(std::span<const Handle<Mesh>> meshes);
     void SetWindowExtent(Extent2D<uint32_t> extent);
     void SetSwapchain(const vk::Swapchain& swapchain, VkClearColorValue clearColorValue);
     void SetDepthStencilView(const vk::TextureView& depthStencilView);
     void SetTransformData(TransformUniformBuffer buffer);
 
-private:
-    Handle<Mesh>           mesh;
-    Handle<vk::Descriptor> descriptor;
+protected:
+    [[nodiscard]] virtual size_t GetNumDraws() const override;
+    virtual void OnBeginDraws(const vk::CommandBuffer& cmdBuffer) const override;
+    virtual void RecordDraws(const vk::CommandBuffer& cmdBuffer, size_t begin, size_t end) const override;
 
-    std::array<std::unique_ptr<vk::Buffer>, vk::NumMaxInFlightFrames> transformBuffers;
-    std::array<vk::Descriptor, vk::NumMaxInFlightFrames>              transformBufferIndices;
+private:
+    std::span<const Handle<Mesh>> meshes;
 
     Extent2D<uint32_t>        windowExtent;
     VkImage                   swapchainImage;
+    VkFormat                  swapchainFormat = VK_FORMAT_UNDEFINED;
+    VkFormat                  depthFormat     = VK_FORMAT_UNDEFINED;
     VkRenderingAttachmentInfo swapchainAttachmentInfo;
     VkRenderingAttachmentInfo depthAttachmentInfo;
 
     TransformUniformBuffer transformData;
+    int                    transformBufferIndex = 0;
+    int                    transformDataIndex   = 0;
 };
 } // namespace sy::render
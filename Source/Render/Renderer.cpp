@@ -5,6 +5,9 @@
 #include <Render/RenderPasses/SimpleRenderPass.h>
 #include <Render/RenderGraph.h>
 #include <Render/RenderNode.h>
+#include <Render/TextureResidencyManager.h>
+#include <Core/Constants.h>
+#include <Core/ThreadPool.h>
 #include <VK/VulkanContext.h>
 #include <VK/VulkanRHI.h>
 #include <VK/Semaphore.h>
@@ -62,19 +65,27 @@ void Renderer::Render()
 
         CRefVec<vk::CommandBuffer> batchedCmdBuffers;
 
-        renderPass->Begin(vk::EQueueType::Graphics);
         for (const auto& mesh : staticMeshes)
         {
-            renderPass->SetMesh(mesh);
-            renderPass->SetTextureDescriptor(mesh->GetMaterial()->BaseTexture);
-            renderPass->Render();
+            textureResidencyManager->MarkUsed(mesh->GetMaterial()->BaseTexture);
         }
+
+        renderPass->SetMeshes(staticMeshes);
+        renderPass->Begin(vk::EQueueType::Graphics);
+        renderPass->RenderDraws();
         renderPass->End();
 
         batchedCmdBuffers.emplace_back(renderPass->GetCommandBuffer());
 
         CRefArray<vk::Semaphore, 1> waitSemaphores = {frameTracker.GetInflightSwapchainSemaphore()};
         RefArray<vk::Semaphore, 2> signalSemaphores = {frameTracker.GetInflightCommandExecutionSemaphore(), frameTracker.GetInflightPresentSemaphore()};
+        if (bIsRenderGraphExecutionEnabled)
+        {
+            /** Graph consumes acquire of swapchain image, then render pass waits on completion of every queues of the graph. */
+            RefArray<vk::Semaphore, 1> graphSignalSemaphores = {*renderGraphSemaphore};
+            renderGraph->Execute(waitSemaphores, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, graphSignalSemaphores, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+            waitSemaphores = {*renderGraphSemaphore};
+        }
 
         vulkanRHI.SubmitSync(vk::EQueueType::Graphics,
                              batchedCmdBuffers,
@@ -96,6 +107,8 @@ void Renderer::BeginFrame()
 
     const auto& cmdExecutionSemaphore = frameTracker.GetInflightCommandExecutionSemaphore();
     cmdExecutionSemaphore.Wait();
+
+    textureResidencyManager->Update();
 }
 
 void Renderer::EndFrame()
@@ -158,6 +171,9 @@ void Renderer::Startup()
 
     basicPipeline = std::make_unique<vk::Pipeline>("Basic Graphics Pipeline", vulkanContext, basicPipelineBuilder);
 
+    textureResidencyManager = handleManager.Add<TextureResidencyManager>(vulkanContext, TextureResidencyPolicy::Config{});
+    textureResidencyManager.SetAlias(core::constants::res::TextureResidencyManager);
+
     //auto model = handleManager.Add<asset::Model>("Assets/Models/rubber_duck/scene.gltf", handleManager, vulkanContext);
     auto model = handleManager.Add<asset::Model>("Assets/Models/homura/homura.fbx", handleManager, vulkanContext);
     SY_ASSERT(model->Initialize(), "Failed to init model.");
@@ -166,10 +182,14 @@ void Renderer::Startup()
     const auto proj = glm::perspective(glm::radians(90.f), 16.f / 9.f, 0.1f, 1000.f);
     viewProjMat = proj * glm::lookAt(glm::vec3{0, 100.f, -80.f}, {0.f, 80.0f, 0.f}, {0.f, 1.f, 0.f});
 
-    renderPass = std::make_unique<SimpleRenderPass>("Simple Render Pass", vulkanContext, *basicPipeline);
+    /** Recorders share single pool, so they do not oversubscribe CPU. Caller thread also records. */
+    recordingThreadPool = std::make_unique<ThreadPool>(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+    renderPass          = std::make_unique<SimpleRenderPass>("Simple Render Pass", vulkanContext, *basicPipeline);
+    renderPass->SetRecordingThreadPool(recordingThreadPool.get());
 
-    /** todo: remove test codes **/
-    auto renderGraph = std::make_unique<RenderGraph>(vulkanContext);
+    /** Test graph of graphics and async compute nodes. Only submitted if render graph execution is enabled. */
+    renderGraph = std::make_unique<RenderGraph>(vulkanContext);
+    renderGraph->SetRecordingThreadPool(recordingThreadPool.get());
     auto node0 = std::make_unique<RenderNode>(*renderGraph, "n0_graphics");
     node0->CreateTexture("g0");
 
@@ -210,13 +230,27 @@ void Renderer::Startup()
     renderGraph->AppendNode(std::move(node4));
     renderGraph->AppendNode(std::move(node5));
     renderGraph->AppendNode(std::move(node6));
+    for (const std::string_view textureName : {"g0", "g1", "g2", "g3", "c0", "c1", "c2"})
+    {
+        renderGraph->GetOrCreateTexture(textureName).GetBuilder().SetType(VK_IMAGE_TYPE_2D).SetFormat(VK_FORMAT_R8G8B8A8_UNORM).SetExtent(windowExtent);
+    }
     renderGraph->Compile();
+
+    if (bIsRenderGraphExecutionEnabled)
+    {
+        renderGraph->AllocateTransientResources();
+        renderGraphSemaphore = std::make_unique<vk::Semaphore>("Render Graph Semaphore", vulkanContext);
+    }
 }
 
 void Renderer::Shutdown()
 {
     spdlog::info("Shutdown Renderer.");
     renderPass.reset();
+    renderGraphSemaphore.reset();
+    renderGraph.reset();
+    recordingThreadPool.reset();
+    textureResidencyManager.DestroySelf();
     depthStencilView.reset();
     depthStencil.reset();
     basicPipeline.reset();
@@ -2,6 +2,11 @@
 #include <PCH.h>
 #include <Component/StaticMeshComponent.h>
 
+namespace sy
+{
+class ThreadPool;
+}
+
 namespace sy::vk
 {
 class VulkanContext;
@@ -28,6 +33,8 @@ namespace sy::render
 {
 class Mesh;
 class SimpleRenderPass;
+class RenderGraph;
+class TextureResidencyManager;
 /** @todo Renderer to RenderContext? */
 class Renderer final : public Subsystem
 {
@@ -43,6 +50,9 @@ public:
     void BeginFrame();
     void EndFrame();
 
+    /** Submits render graph every frame before the render pass, which waits on completion of the graph. Must be set before Startup. */
+    void SetRenderGraphExecutionEnabled(const bool bEnabled) { bIsRenderGraphExecutionEnabled = bEnabled; }
+
 private:
     const window::Window& window;
     vk::VulkanContext&    vulkanContext;
@@ -55,8 +65,15 @@ private:
     std::unique_ptr<vk::Texture>     depthStencil;
     std::unique_ptr<vk::TextureView> depthStencilView;
 
+    std::unique_ptr<ThreadPool>       recordingThreadPool;
     std::unique_ptr<SimpleRenderPass> renderPass;
 
+    std::unique_ptr<RenderGraph>   renderGraph;
+    std::unique_ptr<vk::Semaphore> renderGraphSemaphore;
+    bool                           bIsRenderGraphExecutionEnabled = false;
+
+    Handle<TextureResidencyManager> textureResidencyManager;
+
     glm::mat4 viewProjMat;
     float     elapsedTime;
 
@@ -0,0 +1,97 @@
+#include <PCH.h>
+#include <Render/TextureResidencyManager.h>
+#include <Asset/TextureAsset.h>
+#include <VK/VulkanContext.h>
+#include <VK/FrameTracker.h>
+
+namespace sy::render
+{
+TextureResidencyManager::TextureResidencyManager(vk::VulkanContext& vulkanContext, const TextureResidencyPolicy::Config& config) :
+    vulkanContext(vulkanContext),
+    policy(config)
+{
+}
+
+void TextureResidencyManager::Register(Handle<asset::Texture> texture)
+{
+    if (!texture || !texture->GetDescriptor())
+    {
+        SY_ASSERT(false, "Trying to register invalid texture to residency manager.");
+        return;
+    }
+
+    const auto key = QueryKey(texture->GetDescriptor());
+    policy.Register(key,
+                    texture->GetResidentSizes(),
+                    vulkanContext.GetFrameTracker().GetFrameCounter(),
+                    texture->GetResidentBaseMip());
+    policy.UpdateResidentBytes(key, texture->GetResidentBytes());
+    textures[key] = std::move(texture);
+}
+
+void TextureResidencyManager::MarkUsed(const Handle<vk::Descriptor>& descriptor)
+{
+    if (descriptor)
+    {
+        policy.MarkUsed(QueryKey(descriptor), vulkanContext.GetFrameTracker().GetFrameCounter());
+    }
+}
+
+void TextureResidencyManager::Update()
+{
+    const size_t currentFrame = vulkanContext.GetFrameTracker().GetFrameCounter();
+
+    std::vector<TextureResidencyPolicy::Key> expiredKeys;
+    for (auto& [key, texture] : textures)
+    {
+        if (!texture)
+        {
+            expiredKeys.emplace_back(key);
+            continue;
+        }
+
+        /** Source of decision is loaded off the frame thread, resources are recreated once it is ready. */
+        if (const auto bIsApplied = texture->ApplyResidentBaseMip(); bIsApplied && !*bIsApplied)
+        {
+            spdlog::warn("Failed to update resident base mip of texture {}.", texture->GetName());
+            /** Synchronize policy with actual resident state. */
+            policy.Register(key, texture->GetResidentSizes(), currentFrame, texture->GetResidentBaseMip());
+        }
+
+        /** Policy already accounts decision which is not applied yet, so actual size of previous base mip must not override it. */
+        if (!texture->IsResidentBaseMipPending())
+        {
+            policy.UpdateResidentBytes(key, texture->GetResidentBytes());
+        }
+    }
+
+    for (const auto key : expiredKeys)
+    {
+        textures.erase(key);
+        policy.Unregister(key);
+    }
+
+    const auto decisions = policy.Evaluate(currentFrame);
+    for (const auto& decision : decisions)
+    {
+        auto& texture = textures[decision.Target];
+        if (!texture->RequestResidentBaseMip(decision.BaseMip))
+        {
+            spdlog::warn("Failed to update resident base mip of texture {} to {}.", texture->GetName(), decision.BaseMip);
+            /** Synchronize policy with actual resident state. */
+            policy.Register(decision.Target, texture->GetResidentSizes(), currentFrame, texture->GetResidentBaseMip());
+        }
+    }
+
+    if (!decisions.empty())
+    {
+        const auto& statistics = policy.GetStatistics();
+        spdlog::trace("Texture Residency: {} bytes resident, {} evictions({} mips), {} restorations at frame {}.",
+                      statistics.ResidentBytes,
+                      statistics.EvictionsThisFrame,
+                      statistics.EvictedMipsThisFrame,
+                      statistics.RestorationsThisFrame,
+                      currentFrame);
+    }
+}
+} // namespace sy::render
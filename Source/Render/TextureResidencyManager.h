@@ -0,0 +1,48 @@
+#pragma once
+#include <PCH.h>
+#include <Render/TextureResidencyPolicy.h>
+
+namespace sy::vk
+{
+class VulkanContext;
+}
+
+namespace sy::asset
+{
+class Texture;
+}
+
+namespace sy::render
+{
+/**
+ * Keeps resident memory of texture assets under the budget.
+ * Usage is fed by descriptor which bound to render passes, resident bytes are fed by VMA allocation info.
+ */
+class TextureResidencyManager : public NonCopyable
+{
+public:
+    TextureResidencyManager(vk::VulkanContext& vulkanContext, const TextureResidencyPolicy::Config& config);
+    ~TextureResidencyManager() override = default;
+
+    void Register(Handle<asset::Texture> texture);
+    void MarkUsed(const Handle<vk::Descriptor>& descriptor);
+
+    /**
+     * Must be called after in-flight frame finished its execution.
+     * Decisions are applied by later Update once their sources are loaded, so frame does not wait on loading or transcoding.
+     */
+    void Update();
+
+    [[nodiscard]] const TextureResidencyPolicy::Statistics& GetStatistics() const { return policy.GetStatistics(); }
+    [[nodiscard]] TextureResidencyPolicy&                   GetPolicy() { return policy; }
+
+private:
+    /** Slot of descriptor changes whenever resident mips change, so placement of descriptor handle is used as stable key. */
+    [[nodiscard]] static TextureResidencyPolicy::Key QueryKey(const Handle<vk::Descriptor>& descriptor) { return descriptor.GetPlacement(); }
+
+private:
+    vk::VulkanContext&                                                             vulkanContext;
+    TextureResidencyPolicy                                                         policy;
+    robin_hood::unordered_map<TextureResidencyPolicy::Key, Handle<asset::Texture>> textures;
+};
+} // namespace sy::render
@@ -0,0 +1,199 @@
+#include <PCH.h>
+#include <Render/TextureResidencyPolicy.h>
+
+namespace sy::render
+{
+TextureResidencyPolicy::TextureResidencyPolicy() :
+    TextureResidencyPolicy(Config{})
+{
+}
+
+TextureResidencyPolicy::TextureResidencyPolicy(const Config& config) :
+    config(config)
+{
+}
+
+void TextureResidencyPolicy::Register(const Key key, std::vector<size_t> residentSizes, const size_t currentFrame, const uint32_t residentBaseMip)
+{
+    SY_ASSERT(!residentSizes.empty(), "Texture must have at least one mip.");
+    SY_ASSERT(residentBaseMip < residentSizes.size(), "Resident base mip out of range.");
+
+    Entry entry{
+        .ResidentSizes = std::move(residentSizes),
+        .BaseMip       = residentBaseMip,
+        .ResidentBytes = 0,
+        .LastUsedFrame = currentFrame};
+    entry.ResidentBytes = CalculateBytesFrom(entry, entry.BaseMip);
+
+    entries[key]                  = std::move(entry);
+    statistics.NumTrackedTextures = entries.size();
+}
+
+void TextureResidencyPolicy::Unregister(const Key key)
+{
+    entries.erase(key);
+    statistics.NumTrackedTextures = entries.size();
+}
+
+void TextureResidencyPolicy::MarkUsed(const Key key, const size_t frame)
+{
+    const auto itr = entries.find(key);
+    if (itr != entries.end())
+    {
+        itr->second.LastUsedFrame = std::max(itr->second.LastUsedFrame, frame);
+    }
+}
+
+void TextureResidencyPolicy::UpdateResidentBytes(const Key key, const size_t residentBytes)
+{
+    const auto itr = entries.find(key);
+    if (itr != entries.end())
+    {
+        Entry& entry                       = itr->second;
+        entry.ResidentBytes                = residentBytes;
+        entry.ResidentSizes[entry.BaseMip] = residentBytes;
+    }
+}
+
+std::vector<TextureResidencyPolicy::Decision> TextureResidencyPolicy::Evaluate(const size_t currentFrame)
+{
+    statistics.EvictionsThisFrame    = 0;
+    statistics.RestorationsThisFrame = 0;
+    statistics.EvictedMipsThisFrame  = 0;
+
+    std::vector<Decision> decisions;
+    size_t                residentBytes = CalculateTotalResidentBytes();
+
+    using Candidate = std::pair<Key, Ref<Entry>>;
+    std::vector<Candidate> candidates;
+    if (residentBytes > config.BudgetBytes)
+    {
+        for (auto& [key, entry] : entries)
+        {
+            if (IsCold(entry, currentFrame) && entry.BaseMip < CalculateMaxBaseMip(entry))
+            {
+                candidates.emplace_back(key, entry);
+            }
+        }
+
+        /** Least recently used first. Key is tie-breaker to keep decisions deterministic. */
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Candidate& lhs, const Candidate& rhs) {
+                      const size_t lhsFrame = lhs.second.get().LastUsedFrame;
+                      const size_t rhsFrame = rhs.second.get().LastUsedFrame;
+                      return lhsFrame != rhsFrame ? lhsFrame < rhsFrame : lhs.first < rhs.first;
+                  });
+
+        for (auto& [key, entryRef] : candidates)
+        {
+            if (residentBytes <= config.BudgetBytes || statistics.EvictionsThisFrame >= config.MaxEvictionsPerFrame)
+            {
+                break;
+            }
+
+            Entry&         entry      = entryRef.get();
+            const uint32_t maxBaseMip = CalculateMaxBaseMip(entry);
+            uint32_t       newBaseMip = entry.BaseMip;
+            size_t         newBytes   = entry.ResidentBytes;
+            while (residentBytes - entry.ResidentBytes + newBytes > config.BudgetBytes && newBaseMip < maxBaseMip)
+            {
+                ++newBaseMip;
+                newBytes = CalculateBytesFrom(entry, newBaseMip);
+            }
+
+            statistics.EvictedMipsThisFrame += newBaseMip - entry.BaseMip;
+            residentBytes       = residentBytes - entry.ResidentBytes + newBytes;
+            entry.BaseMip       = newBaseMip;
+            entry.ResidentBytes = newBytes;
+            decisions.emplace_back(key, newBaseMip);
+            ++statistics.EvictionsThisFrame;
+        }
+    }
+    else
+    {
+        for (auto& [key, entry] : entries)
+        {
+            if (!IsCold(entry, currentFrame) && entry.BaseMip > 0)
+            {
+                candidates.emplace_back(key, entry);
+            }
+        }
+
+        /** Most recently used first. */
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Candidate& lhs, const Candidate& rhs) {
+                      const size_t lhsFrame = lhs.second.get().LastUsedFrame;
+                      const size_t rhsFrame = rhs.second.get().LastUsedFrame;
+                      return lhsFrame != rhsFrame ? lhsFrame > rhsFrame : lhs.first < rhs.first;
+                  });
+
+        for (auto& [key, entryRef] : candidates)
+        {
+            if (statistics.RestorationsThisFrame >= config.MaxRestorationsPerFrame)
+            {
+                break;
+            }
+
+            /** Restore as many top mips as budget allows. */
+            Entry& entry = entryRef.get();
+            for (uint32_t newBaseMip = 0; newBaseMip < entry.BaseMip; ++newBaseMip)
+            {
+                const size_t newBytes = CalculateBytesFrom(entry, newBaseMip);
+                if (residentBytes - entry.ResidentBytes + newBytes <= config.BudgetBytes)
+                {
+                    residentBytes       = residentBytes - entry.ResidentBytes + newBytes;
+                    entry.BaseMip       = newBaseMip;
+                    entry.ResidentBytes = newBytes;
+                    decisions.emplace_back(key, newBaseMip);
+                    ++statistics.RestorationsThisFrame;
+                    break;
+                }
+            }
+        }
+    }
+
+    statistics.TotalEvictions += statistics.EvictionsThisFrame;
+    statistics.TotalRestorations += statistics.RestorationsThisFrame;
+    statistics.ResidentBytes = residentBytes;
+    return decisions;
+}
+
+uint32_t TextureResidencyPolicy::GetResidentBaseMip(const Key key) const
+{
+    const auto itr = entries.find(key);
+    return itr != entries.end() ? itr->second.BaseMip : 0;
+}
+
+size_t TextureResidencyPolicy::GetResidentBytes(const Key key) const
+{
+    const auto itr = entries.find(key);
+    return itr != entries.end() ? itr->second.ResidentBytes : 0;
+}
+
+size_t TextureResidencyPolicy::CalculateBytesFrom(const Entry& entry, const uint32_t baseMip) const
+{
+    return entry.ResidentSizes[std::min<size_t>(baseMip, entry.ResidentSizes.size() - 1)];
+}
+
+uint32_t TextureResidencyPolicy::CalculateMaxBaseMip(const Entry& entry) const
+{
+    const auto numMips = static_cast<uint32_t>(entry.ResidentSizes.size());
+    return numMips > config.MinResidentMips ? numMips - std::max(config.MinResidentMips, 1u) : 0;
+}
+
+bool TextureResidencyPolicy::IsCold(const Entry& entry, const size_t currentFrame) const
+{
+    return currentFrame >= entry.LastUsedFrame && (currentFrame - entry.LastUsedFrame) >= config.ColdFrameThreshold;
+}
+
+size_t TextureResidencyPolicy::CalculateTotalResidentBytes() const
+{
+    size_t total = 0;
+    for (const auto& [key, entry] : entries)
+    {
+        total += entry.ResidentBytes;
+    }
+
+    return total;
+}
+} // namespace sy::render
@@ -0,0 +1,87 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::render
+{
+/**
+ * CPU-only LRU residency policy for sampled textures.
+ * It does not touch any vulkan object; the owner feeds resident bytes/usage and applies the decisions.
+ * Every sizes must come from single source(ex. VMA allocation size), otherwise budget drifts as textures stream in and out.
+ * Eviction drops top(largest) mips of the least recently used textures until resident bytes fit into the budget.
+ */
+class TextureResidencyPolicy
+{
+public:
+    using Key = size_t;
+
+    struct Config
+    {
+        size_t   BudgetBytes             = 256 * 1024 * 1024;
+        /** Texture which is not used during this number of frames considered as 'cold'. */
+        size_t   ColdFrameThreshold      = 8;
+        /** Number of mips which always resident, counted from the tail of mip chain. */
+        uint32_t MinResidentMips         = 1;
+        size_t   MaxEvictionsPerFrame    = 4;
+        size_t   MaxRestorationsPerFrame = 1;
+    };
+
+    struct Decision
+    {
+        Key      Target;
+        uint32_t BaseMip;
+    };
+
+    struct Statistics
+    {
+        size_t ResidentBytes         = 0;
+        size_t EvictionsThisFrame    = 0;
+        size_t RestorationsThisFrame = 0;
+        size_t EvictedMipsThisFrame  = 0;
+        size_t TotalEvictions        = 0;
+        size_t TotalRestorations     = 0;
+        size_t NumTrackedTextures    = 0;
+    };
+
+public:
+    TextureResidencyPolicy();
+    explicit TextureResidencyPolicy(const Config& config);
+
+    /** residentSizes[baseMip] is size of the texture when mips from the base mip to tail are resident; one per mip. */
+    void Register(Key key, std::vector<size_t> residentSizes, size_t currentFrame, uint32_t residentBaseMip = 0);
+    void Unregister(Key key);
+    [[nodiscard]] bool Contains(const Key key) const { return entries.contains(key); }
+
+    void MarkUsed(Key key, size_t frame);
+    /** Override resident size of current base mip with actual allocation size, from the same source as registered sizes. */
+    void UpdateResidentBytes(Key key, size_t residentBytes);
+
+    /** Returns list of textures which have to change its resident base mip. Decisions are already applied to the policy. */
+    [[nodiscard]] std::vector<Decision> Evaluate(size_t currentFrame);
+
+    [[nodiscard]] uint32_t          GetResidentBaseMip(Key key) const;
+    [[nodiscard]] size_t            GetResidentBytes(Key key) const;
+    [[nodiscard]] const Config&     GetConfig() const { return config; }
+    [[nodiscard]] const Statistics& GetStatistics() const { return statistics; }
+
+    void SetBudget(const size_t budgetBytes) { config.BudgetBytes = budgetBytes; }
+
+private:
+    struct Entry
+    {
+        std::vector<size_t> ResidentSizes;
+        uint32_t            BaseMip       = 0;
+        size_t              ResidentBytes = 0;
+        size_t              LastUsedFrame = 0;
+    };
+
+    [[nodiscard]] size_t   CalculateBytesFrom(const Entry& entry, uint32_t baseMip) const;
+    [[nodiscard]] uint32_t CalculateMaxBaseMip(const Entry& entry) const;
+    [[nodiscard]] bool     IsCold(const Entry& entry, size_t currentFrame) const;
+    [[nodiscard]] size_t   CalculateTotalResidentBytes() const;
+
+private:
+    Config                                config;
+    Statistics                            statistics;
+    robin_hood::unordered_map<Key, Entry> entries;
+};
+} // namespace sy::render
@@ -0,0 +1,113 @@
+#include <PCH.h>
+#include <Render/TransientResourceAliasing.h>
+
+namespace sy::render
+{
+TransientResourceAliasing::Result TransientResourceAliasing::Pack(const std::span<const Request> requests, const OverlapQuery& isOverlapped)
+{
+    Result result;
+    result.Placements.resize(requests.size());
+
+    /** Largest first; first use and index are tie-breakers to keep placements deterministic. */
+    std::vector<size_t> order(requests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [requests](const size_t lhs, const size_t rhs) {
+                  if (requests[lhs].Size != requests[rhs].Size)
+                  {
+                      return requests[lhs].Size > requests[rhs].Size;
+                  }
+
+                  return requests[lhs].FirstUse != requests[rhs].FirstUse ? requests[lhs].FirstUse < requests[rhs].FirstUse : lhs < rhs;
+              });
+
+    std::vector<std::vector<size_t>> placedPerHeap;
+    for (const size_t requestIdx : order)
+    {
+        const Request& request = requests[requestIdx];
+        SY_ASSERT(request.FirstUse <= request.LastUse, "Invalid lifetime of transient resource.");
+        SY_ASSERT(request.Alignment > 0 && math::IsPowOfTwo(request.Alignment), "Alignment must be power of two.");
+        result.BytesWithoutAliasing += request.Size;
+
+        std::optional<size_t> targetHeapIdx = std::nullopt;
+        for (size_t heapIdx = 0; heapIdx < result.Heaps.size(); ++heapIdx)
+        {
+            if ((result.Heaps[heapIdx].MemoryTypeBits & request.MemoryTypeBits) != 0)
+            {
+                targetHeapIdx = heapIdx;
+                break;
+            }
+        }
+
+        if (!targetHeapIdx)
+        {
+            targetHeapIdx = result.Heaps.size();
+            result.Heaps.emplace_back(0, 1, request.MemoryTypeBits);
+            placedPerHeap.emplace_back();
+        }
+
+        Heap& heap = result.Heaps[*targetHeapIdx];
+        heap.MemoryTypeBits &= request.MemoryTypeBits;
+        heap.Alignment = std::max(heap.Alignment, request.Alignment);
+
+        /** Occupied byte ranges of resources which are alive at the same time, sorted by offset. */
+        std::vector<std::pair<size_t, size_t>> occupied;
+        for (const size_t placedIdx : placedPerHeap[*targetHeapIdx])
+        {
+            if (IsOverlapped(request, requests[placedIdx]) || (isOverlapped && isOverlapped(requestIdx, placedIdx)))
+            {
+                const size_t offset = result.Placements[placedIdx].Offset;
+                occupied.emplace_back(offset, offset + requests[placedIdx].Size);
+            }
+        }
+        std::sort(occupied.begin(), occupied.end());
+
+        /** First-fit into gaps between occupied ranges. */
+        size_t offset = 0;
+        for (const auto& [begin, end] : occupied)
+        {
+            if (PadSizeWithAlignment(offset, request.Alignment) + request.Size <= begin)
+            {
+                break;
+            }
+
+            offset = std::max(offset, end);
+        }
+        offset = PadSizeWithAlignment(offset, request.Alignment);
+
+        result.Placements[requestIdx] = Placement{.HeapIndex = *targetHeapIdx, .Offset = offset};
+        heap.Size                     = std::max(heap.Size, offset + request.Size);
+        placedPerHeap[*targetHeapIdx].emplace_back(requestIdx);
+    }
+
+    for (const Heap& heap : result.Heaps)
+    {
+        result.BytesWithAliasing += heap.Size;
+    }
+    result.PeakLiveBytes = CalculatePeakLiveBytes(requests);
+    return result;
+}
+
+size_t TransientResourceAliasing::CalculatePeakLiveBytes(const std::span<const Request> requests)
+{
+    /** (execution order, delta) events; releases are applied after the last use. */
+    std::vector<std::pair<size_t, int64_t>> events;
+    events.reserve(requests.size() * 2);
+    for (const Request& request : requests)
+    {
+        events.emplace_back(request.FirstUse, static_cast<int64_t>(request.Size));
+        events.emplace_back(request.LastUse + 1, -static_cast<int64_t>(request.Size));
+    }
+    std::sort(events.begin(), events.end());
+
+    int64_t liveBytes = 0;
+    int64_t peak      = 0;
+    for (const auto& [order, delta] : events)
+    {
+        liveBytes += delta;
+        peak = std::max(peak, liveBytes);
+    }
+
+    return static_cast<size_t>(peak);
+}
+} // namespace sy::render
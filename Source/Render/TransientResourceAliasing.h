@@ -0,0 +1,60 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::render
+{
+/**
+ * CPU-only interval packer for transient render graph resources.
+ * Resources which are not alive at the same time(disjoint [FirstUse, LastUse] range of execution order)
+ * may share same bytes of a memory heap. Caller may add overlaps which execution order can not tell. (ex. unsynchronized queues)
+ */
+class TransientResourceAliasing
+{
+public:
+    /** Whether requests of given indices may be alive at the same time. */
+    using OverlapQuery = std::function<bool(size_t, size_t)>;
+
+    struct Request
+    {
+        size_t   Size           = 0;
+        size_t   Alignment      = 1;
+        uint32_t MemoryTypeBits = std::numeric_limits<uint32_t>::max();
+        /** Inclusive range of execution order. */
+        size_t FirstUse = 0;
+        size_t LastUse  = 0;
+    };
+
+    struct Placement
+    {
+        size_t HeapIndex = 0;
+        size_t Offset    = 0;
+    };
+
+    struct Heap
+    {
+        size_t   Size           = 0;
+        size_t   Alignment      = 1;
+        uint32_t MemoryTypeBits = std::numeric_limits<uint32_t>::max();
+    };
+
+    struct Result
+    {
+        /** Same order as requests. */
+        std::vector<Placement> Placements;
+        std::vector<Heap>      Heaps;
+        /** Every resources own dedicated memory. */
+        size_t BytesWithoutAliasing = 0;
+        size_t BytesWithAliasing    = 0;
+        /** Lower bound of aliasing; maximum sum of sizes of resources alive at the same time. */
+        size_t PeakLiveBytes = 0;
+    };
+
+public:
+    /** Requests overlap if their ranges of execution order overlap, or if given query says so. */
+    [[nodiscard]] static Result Pack(std::span<const Request> requests, const OverlapQuery& isOverlapped = {});
+    [[nodiscard]] static bool   IsOverlapped(const Request& lhs, const Request& rhs) { return lhs.FirstUse <= rhs.LastUse && rhs.FirstUse <= lhs.LastUse; }
+
+private:
+    [[nodiscard]] static size_t CalculatePeakLiveBytes(std::span<const Request> requests);
+};
+} // namespace sy::render
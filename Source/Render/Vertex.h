@@ -29,6 +29,37 @@ struct VertexPT0N
     glm::vec3 Normal;
 };
 
+/**
+* Packed variant of VertexPT0N.
+* TexCoords0 => half2 (VK_FORMAT_R16G16_SFLOAT)
+* Normal => 10-10-10-2 unorm (VK_FORMAT_A2B10G10R10_UNORM_PACK32), decode: n = v.xyz * 2 - 1
+*/
+struct VertexPT0NPacked
+{
+    glm::vec3 Position;
+    uint32_t  TexCoords0;
+    uint32_t  Normal;
+};
+
+/**
+* Quantized/Packed variant of VertexPT0N.
+* Position => 16-bit unorm relative to mesh bounds (VK_FORMAT_R16G16B16A16_UNORM), decode: p = v.xyz * (max - min) + min
+*/
+struct VertexQPT0NPacked
+{
+    glm::u16vec4 Position;
+    uint32_t     TexCoords0;
+    uint32_t     Normal;
+};
+
+struct VertexBounds
+{
+    glm::vec3 Min = glm::vec3{0.f};
+    glm::vec3 Max = glm::vec3{0.f};
+
+    [[nodiscard]] glm::vec3 GetExtent() const { return Max - Min; }
+};
+
 /**
 * P => Position <vec3>
 * T(N) => TexCoords <vec2>
@@ -36,122 +67,266 @@ struct VertexPT0N
 * T => Tangent <vec3>,
 * B => Bi-tangent <vec3>
 * W(N) = Weights <float>
+* Q => Quantized Position <u16vec4>
+* Packed => TexCoords as <half2>, Normal as <10-10-10-2 unorm>
 */
 enum class EVertexType
 {
     PT0,
     PT0N,
+    PT0NPacked,
+    QPT0NPacked,
 };
 
-constexpr size_t SizeOfVertex(const EVertexType type)
+constexpr bool IsPackedVertexType(const EVertexType type)
 {
-    switch (type)
+    return type == EVertexType::PT0NPacked || type == EVertexType::QPT0NPacked;
+}
+
+/**
+* Compile-time description of single vertex attribute.
+* Format decides both of vertex input format and encoding of the attribute. (ex. R16G16_SFLOAT => half2)
+*/
+template <EVertexAttributeType AttributeType, auto MemberPtr, VkFormat AttributeFormat>
+struct VertexAttribute
+{
+private:
+    template <typename T>
+    struct MemberPointerTraits;
+
+    template <typename V, typename M>
+    struct MemberPointerTraits<M V::*>
     {
-        case EVertexType::PT0:
-            return sizeof(VertexPT0);
+        using VertexType = V;
+        using MemberType = M;
+    };
 
-        case EVertexType::PT0N:
-            return sizeof(VertexPT0N);
+public:
+    using VertexType = typename MemberPointerTraits<decltype(MemberPtr)>::VertexType;
+    using MemberType = typename MemberPointerTraits<decltype(MemberPtr)>::MemberType;
+
+    static constexpr EVertexAttributeType Type   = AttributeType;
+    static constexpr auto                 Member = MemberPtr;
+    static constexpr VkFormat             Format = AttributeFormat;
+    static constexpr size_t               Size   = sizeof(MemberType);
+
+    static size_t Offset()
+    {
+        static const VertexType vertex{};
+        return static_cast<size_t>(reinterpret_cast<const uint8_t*>(&(vertex.*Member)) - reinterpret_cast<const uint8_t*>(&vertex));
     }
 
-    return 0;
-}
+    /** Encode full precision attribute value. Bounds only used by quantized position. */
+    template <typename SourceType>
+    static MemberType Encode(const SourceType& value, [[maybe_unused]] const VertexBounds& bounds)
+    {
+        if constexpr (Format == VK_FORMAT_R16G16_SFLOAT)
+        {
+            return math::PackHalf2(value);
+        }
+        else if constexpr (Format == VK_FORMAT_A2B10G10R10_UNORM_PACK32)
+        {
+            return math::PackUnitVector1010102(value);
+        }
+        else if constexpr (Format == VK_FORMAT_R16G16B16A16_UNORM)
+        {
+            return math::QuantizePosition(value, bounds.Min, bounds.GetExtent());
+        }
+        else
+        {
+            return MemberType{value};
+        }
+    }
+};
 
+/** Specialize with 'using Attributes = std::tuple<VertexAttribute<...>...>'. Index of attribute in the tuple is shader input location. */
 template <typename VertexType>
-vk::VertexInputBuilder BuildVertexInputLayout();
+struct VertexLayout;
 
 template <>
-inline vk::VertexInputBuilder BuildVertexInputLayout<VertexPT0>()
+struct VertexLayout<VertexPT0>
 {
-    using Vertex       = VertexPT0;
-    const auto builder = vk::VertexInputBuilder{}
-                             .AddVertexInputBinding<Vertex>(0, VK_VERTEX_INPUT_RATE_VERTEX)
-                             .AddVertexInputAttribute(0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, Position))
-                             .AddVertexInputAttribute(1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(Vertex, TexCoords0));
-    return builder;
-}
+    using Attributes = std::tuple<
+        VertexAttribute<EVertexAttributeType::Position, &VertexPT0::Position, VK_FORMAT_R32G32B32_SFLOAT>,
+        VertexAttribute<EVertexAttributeType::TexCoords0, &VertexPT0::TexCoords0, VK_FORMAT_R32G32_SFLOAT>>;
+};
 
 template <>
-inline vk::VertexInputBuilder BuildVertexInputLayout<VertexPT0N>()
+struct VertexLayout<VertexPT0N>
 {
-    using Vertex = VertexPT0N;
-    vk::VertexInputBuilder builder;
-    builder.AddVertexInputBinding<Vertex>(0, VK_VERTEX_INPUT_RATE_VERTEX)
-        .AddVertexInputAttribute(0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, Position))
-        .AddVertexInputAttribute(1, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(Vertex, TexCoords0))
-        .AddVertexInputAttribute(2, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(Vertex, Normal));
-    return builder;
+    using Attributes = std::tuple<
+        VertexAttribute<EVertexAttributeType::Position, &VertexPT0N::Position, VK_FORMAT_R32G32B32_SFLOAT>,
+        VertexAttribute<EVertexAttributeType::TexCoords0, &VertexPT0N::TexCoords0, VK_FORMAT_R32G32_SFLOAT>,
+        VertexAttribute<EVertexAttributeType::Normal, &VertexPT0N::Normal, VK_FORMAT_R32G32B32_SFLOAT>>;
+};
+
+template <>
+struct VertexLayout<VertexPT0NPacked>
+{
+    using Attributes = std::tuple<
+        VertexAttribute<EVertexAttributeType::Position, &VertexPT0NPacked::Position, VK_FORMAT_R32G32B32_SFLOAT>,
+        VertexAttribute<EVertexAttributeType::TexCoords0, &VertexPT0NPacked::TexCoords0, VK_FORMAT_R16G16_SFLOAT>,
+        VertexAttribute<EVertexAttributeType::Normal, &VertexPT0NPacked::Normal, VK_FORMAT_A2B10G10R10_UNORM_PACK32>>;
+};
+
+template <>
+struct VertexLayout<VertexQPT0NPacked>
+{
+    using Attributes = std::tuple<
+        VertexAttribute<EVertexAttributeType::Position, &VertexQPT0NPacked::Position, VK_FORMAT_R16G16B16A16_UNORM>,
+        VertexAttribute<EVertexAttributeType::TexCoords0, &VertexQPT0NPacked::TexCoords0, VK_FORMAT_R16G16_SFLOAT>,
+        VertexAttribute<EVertexAttributeType::Normal, &VertexQPT0NPacked::Normal, VK_FORMAT_A2B10G10R10_UNORM_PACK32>>;
+};
+
+/** Invoke func(Attribute{}, location) for each attributes of vertex layout. Unrolled at compile-time. */
+template <typename VertexType, typename Func>
+void ForEachVertexAttribute(Func&& func)
+{
+    using Attributes = typename VertexLayout<VertexType>::Attributes;
+    [&]<size_t... Locations>(std::index_sequence<Locations...>) {
+        (func(std::tuple_element_t<Locations, Attributes>{}, static_cast<uint32_t>(Locations)), ...);
+    }(std::make_index_sequence<std::tuple_size_v<Attributes>>{});
 }
 
-inline std::optional<vk::VertexInputBuilder> BuildVertexInputLayout(const EVertexType type)
+template <typename VertexType>
+constexpr bool HasVertexAttribute(const EVertexAttributeType attribute)
+{
+    using Attributes = typename VertexLayout<VertexType>::Attributes;
+    return [&]<size_t... Indices>(std::index_sequence<Indices...>) {
+        return ((std::tuple_element_t<Indices, Attributes>::Type == attribute) || ...);
+    }(std::make_index_sequence<std::tuple_size_v<Attributes>>{});
+}
+
+/** Invoke func(std::type_identity<VertexType>{}) with concrete vertex type of runtime vertex type. */
+template <typename Func>
+decltype(auto) VisitVertexType(const EVertexType type, Func&& func)
 {
     switch (type)
     {
         case EVertexType::PT0:
-            return BuildVertexInputLayout<VertexPT0>();
+            return func(std::type_identity<VertexPT0>{});
 
         case EVertexType::PT0N:
-            return BuildVertexInputLayout<VertexPT0N>();
+            return func(std::type_identity<VertexPT0N>{});
+
+        case EVertexType::PT0NPacked:
+            return func(std::type_identity<VertexPT0NPacked>{});
+
+        case EVertexType::QPT0NPacked:
+            return func(std::type_identity<VertexQPT0NPacked>{});
     }
 
-    return std::nullopt;
+    SY_ASSERT(false, "Unknown vertex type.");
+    return func(std::type_identity<VertexPT0N>{});
 }
 
-template <typename VertexType>
-std::optional<Range<size_t>> QueryRangeOfVertexAttribute(const EVertexAttributeType type);
-
-template <>
-inline std::optional<Range<size_t>> QueryRangeOfVertexAttribute<VertexPT0>(const EVertexAttributeType attribute)
+constexpr size_t SizeOfVertex(const EVertexType type)
 {
-    switch (attribute)
+    switch (type)
     {
-        case EVertexAttributeType::Position:
-            return Range<size_t>{.Offset = offsetof(VertexPT0, Position), .Size = sizeof(VertexPT0::Position)};
+        case EVertexType::PT0:
+            return sizeof(VertexPT0);
+
+        case EVertexType::PT0N:
+            return sizeof(VertexPT0N);
 
-        case EVertexAttributeType::TexCoords0:
-            return Range<size_t>{.Offset = offsetof(VertexPT0, TexCoords0), .Size = sizeof(VertexPT0::TexCoords0)};
+        case EVertexType::PT0NPacked:
+            return sizeof(VertexPT0NPacked);
 
-        default:
-            return std::nullopt;
+        case EVertexType::QPT0NPacked:
+            return sizeof(VertexQPT0NPacked);
     }
 
-    return std::nullopt;
+    return 0;
 }
 
-template <>
-inline std::optional<Range<size_t>> QueryRangeOfVertexAttribute<VertexPT0N>(const EVertexAttributeType attribute)
+template <typename VertexType>
+vk::VertexInputBuilder BuildVertexInputLayout()
 {
-    switch (attribute)
-    {
-        case EVertexAttributeType::Position:
-            return Range<size_t>{.Offset = offsetof(VertexPT0N, Position), .Size = sizeof(VertexPT0::Position)};
+    vk::VertexInputBuilder builder;
+    builder.AddVertexInputBinding<VertexType>(0, VK_VERTEX_INPUT_RATE_VERTEX);
+    ForEachVertexAttribute<VertexType>([&builder]<typename Attribute>(Attribute, const uint32_t location) {
+        builder.AddVertexInputAttribute(location, 0, Attribute::Format, static_cast<uint32_t>(Attribute::Offset()));
+    });
+    return builder;
+}
+
+inline std::optional<vk::VertexInputBuilder> BuildVertexInputLayout(const EVertexType type)
+{
+    return VisitVertexType(type, []<typename VertexType>(std::type_identity<VertexType>) {
+        return std::optional{BuildVertexInputLayout<VertexType>()};
+    });
+}
 
-        case EVertexAttributeType::TexCoords0:
-            return Range<size_t>{.Offset = offsetof(VertexPT0N, TexCoords0), .Size = sizeof(VertexPT0::TexCoords0)};
+template <typename VertexType>
+std::optional<Range<size_t>> QueryRangeOfVertexAttribute(const EVertexAttributeType attribute)
+{
+    std::optional<Range<size_t>> range = std::nullopt;
+    ForEachVertexAttribute<VertexType>([attribute, &range]<typename Attribute>(Attribute, uint32_t) {
+        if (Attribute::Type == attribute)
+        {
+            range = Range<size_t>{.Offset = Attribute::Offset(), .Size = Attribute::Size};
+        }
+    });
+    return range;
+}
+
+inline std::optional<Range<size_t>> QueryRangeOfVertexAttribute(const EVertexType vertex, const EVertexAttributeType attribute)
+{
+    return VisitVertexType(vertex, [attribute]<typename VertexType>(std::type_identity<VertexType>) {
+        return QueryRangeOfVertexAttribute<VertexType>(attribute);
+    });
+}
 
-        case EVertexAttributeType::Normal:
-            return Range<size_t>{.Offset = offsetof(VertexPT0N, Normal), .Size = sizeof(VertexPT0N::Normal)};
+inline VertexBounds CalculateVertexBounds(const std::span<const VertexPT0N> vertices)
+{
+    if (vertices.empty())
+    {
+        return {};
+    }
 
-        default:
-            return std::nullopt;
+    VertexBounds bounds{.Min = vertices[0].Position, .Max = vertices[0].Position};
+    for (const VertexPT0N& vertex : vertices)
+    {
+        bounds.Min = glm::min(bounds.Min, vertex.Position);
+        bounds.Max = glm::max(bounds.Max, vertex.Position);
     }
 
-    return std::nullopt;
+    return bounds;
 }
 
-inline std::optional<Range<size_t>> QueryRangeOfVertexAttribute(const EVertexType vertex, const EVertexAttributeType attribute)
+/**
+* Convert full precision vertices to packed vertex type.
+* Bounds only used for quantized position. Returns false if target isn't packed vertex type or size of destination mismatch.
+*/
+inline bool PackVertices(const std::span<const VertexPT0N> vertices, const EVertexType target, const VertexBounds& bounds, const std::span<uint8_t> dst)
 {
-    switch (vertex)
+    if (!IsPackedVertexType(target) || dst.size() != SizeOfVertex(target) * vertices.size())
     {
-        case EVertexType::PT0:
-            return QueryRangeOfVertexAttribute<VertexPT0>(attribute);
-        case EVertexType::PT0N:
-            return QueryRangeOfVertexAttribute<VertexPT0N>(attribute);
-        default:
-            return std::nullopt;
+        return false;
     }
 
-    return std::nullopt;
-}
+    VisitVertexType(target, [&]<typename VertexType>(std::type_identity<VertexType>) {
+        auto* packedVertices = reinterpret_cast<VertexType*>(dst.data());
+        ForEachVertexAttribute<VertexType>([&]<typename Attribute>(Attribute, uint32_t) {
+            for (size_t idx = 0; idx < vertices.size(); ++idx)
+            {
+                if constexpr (Attribute::Type == EVertexAttributeType::Position)
+                {
+                    packedVertices[idx].*Attribute::Member = Attribute::Encode(vertices[idx].Position, bounds);
+                }
+                else if constexpr (Attribute::Type == EVertexAttributeType::TexCoords0)
+                {
+                    packedVertices[idx].*Attribute::Member = Attribute::Encode(vertices[idx].TexCoords0, bounds);
+                }
+                else if constexpr (Attribute::Type == EVertexAttributeType::Normal)
+                {
+                    packedVertices[idx].*Attribute::Member = Attribute::Encode(vertices[idx].Normal, bounds);
+                }
+            }
+        });
+    });
 
+    return true;
+}
 } // namespace sy::render
@@ -0,0 +1,221 @@
+#include <PCH.h>
+#include <catch.hpp>
+#include <Asset/TextureTranscodeTable.h>
+#include <Asset/VertexConversion.h>
+
+TEST_CASE("TextureTranscodeTable", "[texture_transcode_table]")
+{
+    using namespace sy::asset;
+
+    SECTION("Desktop class device")
+    {
+        const TextureTranscodeTable table{[](const VkFormat format) {
+            return format == VK_FORMAT_BC1_RGB_UNORM_BLOCK ||
+                   format == VK_FORMAT_BC3_UNORM_BLOCK ||
+                   format == VK_FORMAT_BC4_UNORM_BLOCK ||
+                   format == VK_FORMAT_BC5_UNORM_BLOCK ||
+                   format == VK_FORMAT_BC7_UNORM_BLOCK;
+        }};
+
+        REQUIRE(table.GetBestFormat(ETextureChannelLayout::RGBA) == KTX_TTF_BC7_RGBA);
+        REQUIRE(table.GetBestFormat(ETextureChannelLayout::RGB) == KTX_TTF_BC7_RGBA);
+        REQUIRE(table.GetBestFormat(ETextureChannelLayout::RG) == KTX_TTF_BC5_RG);
+        REQUIRE(table.GetBestFormat(ETextureChannelLayout::R) == KTX_TTF_BC4_R);
+        REQUIRE(table.Select(ETextureChannelLayout::RGBA, ETextureCompressionMode::BC1) == KTX_TTF_BC1_RGB);
+    }
+
+    SECTION("Mobile class device")
+    {
+        const TextureTranscodeTable table{[](const VkFormat format) {
+            return format == VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK ||
+                   format == VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK ||
+                   format == VK_FORMAT_EAC_R11_UNORM_BLOCK ||
+                   format == VK_FORMAT_EAC_R11G11_UNORM_BLOCK ||
+                   format == VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+        }};
+
+        REQUIRE(table.GetBestFormat(ETextureChannelLayout::RGBA) == KTX_TTF_ASTC_4x4_RGBA);
+        REQUIRE(table.GetBestFormat(ETextureChannelLayout::RG) == KTX_TTF_ETC2_EAC_RG11);
+        REQUIRE(table.GetBestFormat(ETextureChannelLayout::R) == KTX_TTF_ETC2_EAC_R11);
+        /** Unsupported preferred mode fallback to best format of layout. */
+        REQUIRE(table.Select(ETextureChannelLayout::RGBA, ETextureCompressionMode::BC7) == KTX_TTF_ASTC_4x4_RGBA);
+    }
+
+    SECTION("Fallback to RGBA32")
+    {
+        const TextureTranscodeTable table;
+        for (const auto layout : magic_enum::enum_values<ETextureChannelLayout>())
+        {
+            REQUIRE(table.GetBestFormat(layout) == KTX_TTF_RGBA32);
+        }
+
+        REQUIRE(TextureTranscodeTable::QueryChannelLayout(1) == ETextureChannelLayout::R);
+        REQUIRE(TextureTranscodeTable::QueryChannelLayout(4) == ETextureChannelLayout::RGBA);
+    }
+}
+
+TEST_CASE("TranscodedTextureCache", "[transcoded_texture_cache]")
+{
+    using namespace sy::asset;
+    const sy::fs::path cacheDirectory = sy::fs::temp_directory_path() / "KeiTranscodedTextureCacheTest";
+    sy::fs::remove_all(cacheDirectory);
+
+    const std::vector<uint8_t> payload(40, 0xAB);
+    const uint64_t             hashA = TranscodedTextureCache::HashContent(std::span<const uint8_t>{payload.data(), 1});
+    const uint64_t             hashB = TranscodedTextureCache::HashContent(std::span<const uint8_t>{payload.data(), 2});
+    const uint64_t             hashC = TranscodedTextureCache::HashContent(std::span<const uint8_t>{payload.data(), 3});
+    REQUIRE(hashA != hashB);
+
+    SECTION("Least recently used entry pruned first")
+    {
+        TranscodedTextureCache cache{cacheDirectory, 100};
+        cache.Store(hashA, VK_FORMAT_BC7_UNORM_BLOCK, payload);
+        cache.Store(hashB, VK_FORMAT_BC7_UNORM_BLOCK, payload);
+        REQUIRE(cache.Find(hashA, VK_FORMAT_BC7_UNORM_BLOCK).has_value());
+
+        cache.Store(hashC, VK_FORMAT_BC7_UNORM_BLOCK, payload);
+        REQUIRE(cache.GetStatistics().Evictions == 1);
+        REQUIRE(cache.GetStatistics().TotalBytes == 80);
+        REQUIRE(!cache.Find(hashB, VK_FORMAT_BC7_UNORM_BLOCK).has_value());
+        REQUIRE(cache.Find(hashA, VK_FORMAT_BC7_UNORM_BLOCK).has_value());
+        REQUIRE(cache.Find(hashC, VK_FORMAT_BC7_UNORM_BLOCK).has_value());
+
+        /** Same content with different target format is different entry. */
+        REQUIRE(!cache.Find(hashA, VK_FORMAT_R8G8B8A8_UNORM).has_value());
+    }
+
+    SECTION("Index persists across instances")
+    {
+        {
+            TranscodedTextureCache cache{cacheDirectory, 100};
+            cache.Store(hashA, VK_FORMAT_BC7_UNORM_BLOCK, payload);
+        }
+
+        TranscodedTextureCache cache{cacheDirectory, 100};
+        REQUIRE(cache.GetStatistics().NumOfEntries == 1);
+        const auto cachedPath = cache.Find(hashA, VK_FORMAT_BC7_UNORM_BLOCK);
+        REQUIRE(cachedPath.has_value());
+        REQUIRE(sy::LoadBlobFromFile(*cachedPath) == payload);
+
+        cache.Invalidate(hashA);
+        REQUIRE(!cache.Find(hashA, VK_FORMAT_BC7_UNORM_BLOCK).has_value());
+        REQUIRE(!sy::fs::exists(*cachedPath));
+    }
+
+    SECTION("Payloads which are not in the index are removed on load")
+    {
+        {
+            TranscodedTextureCache cache{cacheDirectory, 100};
+            cache.Store(hashA, VK_FORMAT_BC7_UNORM_BLOCK, payload);
+        }
+
+        /** Payload stored before crash, index was never flushed with it. */
+        const sy::fs::path orphan = cacheDirectory / std::format("{:016x}_{}.ktx2", hashB, sy::ToUnderlying(VK_FORMAT_BC7_UNORM_BLOCK));
+        const sy::fs::path other  = cacheDirectory / "Other.ktx2";
+        sy::SaveBlobToFile(orphan, payload);
+        sy::SaveBlobToFile(other, payload);
+
+        TranscodedTextureCache cache{cacheDirectory, 100};
+        REQUIRE(!sy::fs::exists(orphan));
+        REQUIRE(sy::fs::exists(other));
+        REQUIRE(cache.GetStatistics().NumOfEntries == 1);
+        REQUIRE(cache.Find(hashA, VK_FORMAT_BC7_UNORM_BLOCK).has_value());
+    }
+
+    SECTION("Content hash is reused while source stamp is unchanged")
+    {
+        const sy::fs::path source = cacheDirectory / "Source.ktx2";
+        sy::SaveBlobToFile(source, payload);
+        const auto stamp = TranscodedTextureCache::QuerySourceStamp(source);
+        REQUIRE(stamp.has_value());
+        REQUIRE(stamp->Size == payload.size());
+        REQUIRE(!TranscodedTextureCache::QuerySourceStamp(cacheDirectory / "Missing.ktx2").has_value());
+
+        {
+            TranscodedTextureCache cache{cacheDirectory, 100};
+            REQUIRE(!cache.FindContentHash(source, *stamp).has_value());
+            cache.RecordContentHash(source, *stamp, hashA);
+            REQUIRE(cache.FindContentHash(source, *stamp) == hashA);
+            REQUIRE(cache.GetStatistics().SourceHashes == 1);
+        }
+
+        TranscodedTextureCache cache{cacheDirectory, 100};
+        REQUIRE(cache.FindContentHash(source, *stamp) == hashA);
+
+        /** Modified source has to be hashed again. */
+        auto modifiedStamp = *stamp;
+        ++modifiedStamp.LastWriteTime;
+        REQUIRE(!cache.FindContentHash(source, modifiedStamp).has_value());
+        modifiedStamp = *stamp;
+        ++modifiedStamp.Size;
+        REQUIRE(!cache.FindContentHash(source, modifiedStamp).has_value());
+    }
+
+    sy::fs::remove_all(cacheDirectory);
+}
+
+TEST_CASE("Vertex conversion benchmark", "[.][benchmark][vertex_conversion]")
+{
+    using namespace sy;
+    constexpr size_t NumVertices = 10'000'000;
+
+    aiMesh mesh;
+    mesh.mNumVertices        = NumVertices;
+    mesh.mVertices           = new aiVector3D[NumVertices];
+    mesh.mNormals            = new aiVector3D[NumVertices];
+    mesh.mTextureCoords[0]   = new aiVector3D[NumVertices];
+    mesh.mNumUVComponents[0] = 2;
+    for (size_t idx = 0; idx < NumVertices; ++idx)
+    {
+        const float value           = static_cast<float>(idx % 1024) / 1024.f;
+        mesh.mVertices[idx]         = aiVector3D{value, 1.f - value, value * 2.f};
+        mesh.mNormals[idx]          = aiVector3D{0.f, 1.f, 0.f};
+        mesh.mTextureCoords[0][idx] = aiVector3D{value, value, 0.f};
+    }
+
+    const render::VertexBounds bounds = asset::CalculateVertexBounds(mesh);
+
+    /** Per-vertex runtime attribute lookup, as ModelImporter did before compile-time vertex layout. */
+    const auto convertWithRuntimeLookup = [&mesh](const render::EVertexType type, std::vector<uint8_t>& dst) {
+        uint8_t*     base         = dst.data();
+        const size_t sizeOfVertex = render::SizeOfVertex(type);
+        for (size_t idx = 0; idx < mesh.mNumVertices; ++idx)
+        {
+            if (const auto range = render::QueryRangeOfVertexAttribute(type, render::EVertexAttributeType::Position); range)
+            {
+                *reinterpret_cast<glm::vec3*>(base + range->Offset) = glm::vec3{mesh.mVertices[idx].x, mesh.mVertices[idx].y, mesh.mVertices[idx].z};
+            }
+            if (const auto range = render::QueryRangeOfVertexAttribute(type, render::EVertexAttributeType::TexCoords0); range)
+            {
+                *reinterpret_cast<glm::vec2*>(base + range->Offset) = glm::vec2{mesh.mTextureCoords[0][idx].x, mesh.mTextureCoords[0][idx].y};
+            }
+            if (const auto range = render::QueryRangeOfVertexAttribute(type, render::EVertexAttributeType::Normal); range)
+            {
+                *reinterpret_cast<glm::vec3*>(base + range->Offset) = glm::vec3{mesh.mNormals[idx].x, mesh.mNormals[idx].y, mesh.mNormals[idx].z};
+            }
+            base += sizeOfVertex;
+        }
+    };
+
+    const auto measure = [](const auto& func) {
+        const auto begin = std::chrono::high_resolution_clock::now();
+        func();
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+    };
+
+    std::vector<uint8_t> baseline(render::SizeOfVertex(render::EVertexType::PT0N) * NumVertices);
+    const double baselineMs = measure([&]() { convertWithRuntimeLookup(render::EVertexType::PT0N, baseline); });
+    spdlog::info("[Vertex Conversion] Runtime lookup(PT0N), {} vertices: {:.3f} ms", NumVertices, baselineMs);
+
+    for (const auto type : {render::EVertexType::PT0N, render::EVertexType::PT0NPacked, render::EVertexType::QPT0NPacked})
+    {
+        std::vector<uint8_t> converted(render::SizeOfVertex(type) * NumVertices);
+        const double elapsedMs = measure([&]() { asset::ConvertVertices(type, mesh, bounds, converted); });
+        spdlog::info("[Vertex Conversion] Compile-time layout({}), {} vertices: {:.3f} ms", magic_enum::enum_name(type), NumVertices, elapsedMs);
+
+        if (type == render::EVertexType::PT0N)
+        {
+            REQUIRE(converted == baseline);
+        }
+    }
+}
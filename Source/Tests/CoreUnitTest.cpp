@@ -2,6 +2,9 @@
 #include <catch.hpp>
 #include <Core/Utils.h>
 #include <Core/HandleManager.h>
+#include <Core/ThreadPool.h>
+#include <Core/LinearAllocator.h>
+#include <Core/LinearRecycler.h>
 
 TEST_CASE("Extent2D", "[extent_2d]")
 {
@@ -146,3 +149,147 @@ TEST_CASE("Utilities", "[utils]")
         REQUIRE(normalizeExtension == "gltf");
     }
 }
+
+TEST_CASE("ThreadPool", "[thread_pool]")
+{
+    for (const size_t numWorkers : {0, 1, 3, 7})
+    {
+        sy::ThreadPool pool{numWorkers};
+        REQUIRE(pool.GetNumThreads() == numWorkers + 1);
+
+        for (size_t iteration = 0; iteration < 100; ++iteration)
+        {
+            std::vector<std::atomic<size_t>> hits(97);
+            pool.ParallelFor(hits.size(), [&hits](const size_t idx) { hits[idx].fetch_add(1); });
+            REQUIRE(std::all_of(hits.cbegin(), hits.cend(), [](const std::atomic<size_t>& hit) { return hit.load() == 1; }));
+        }
+
+        size_t numInvoked = 0;
+        pool.ParallelFor(0, [&numInvoked](size_t) { ++numInvoked; });
+        REQUIRE(numInvoked == 0);
+
+        /** Nested loop on the same pool does not wait on workers which are running outer loop. */
+        std::vector<std::atomic<size_t>> nestedHits(8 * 8);
+        pool.ParallelFor(8, [&pool, &nestedHits](const size_t outerIdx) {
+            pool.ParallelFor(8, [&nestedHits, outerIdx](const size_t innerIdx) { nestedHits[outerIdx * 8 + innerIdx].fetch_add(1); });
+        });
+        REQUIRE(std::all_of(nestedHits.cbegin(), nestedHits.cend(), [](const std::atomic<size_t>& hit) { return hit.load() == 1; }));
+
+        /** Loops of outside threads which share the pool do not overwrite each other. */
+        std::vector<std::atomic<size_t>> sharedHits(4 * 97);
+        {
+            std::vector<std::jthread> callers;
+            for (size_t callerIdx = 0; callerIdx < 4; ++callerIdx)
+            {
+                callers.emplace_back([&pool, &sharedHits, callerIdx]() {
+                    for (size_t iteration = 0; iteration < 25; ++iteration)
+                    {
+                        pool.ParallelFor(97, [&sharedHits, callerIdx](const size_t idx) { sharedHits[callerIdx * 97 + idx].fetch_add(1); });
+                    }
+                });
+            }
+        }
+        REQUIRE(std::all_of(sharedHits.cbegin(), sharedHits.cend(), [](const std::atomic<size_t>& hit) { return hit.load() == 25; }));
+    }
+}
+
+TEST_CASE("LinearAllocator", "[linear_allocator]")
+{
+    SECTION("Alignment and Exhaustion")
+    {
+        sy::LinearAllocator allocator{256};
+        REQUIRE(allocator.Allocate(3, 1) == 0);
+        /** Non power of two alignment. */
+        REQUIRE(allocator.Allocate(48, 48) == 48);
+        REQUIRE(allocator.Allocate(64, 64) == 128);
+        REQUIRE(allocator.GetUsedBytes() == 192);
+        REQUIRE_FALSE(allocator.Allocate(65, 1).has_value());
+        REQUIRE(allocator.Allocate(64, 1) == 192);
+        REQUIRE_FALSE(allocator.Allocate(1, 1).has_value());
+        REQUIRE(allocator.GetNumAllocations() == 4);
+        REQUIRE(allocator.GetNumFailedAllocations() == 2);
+
+        allocator.Reset();
+        REQUIRE(allocator.GetUsedBytes() == 0);
+        REQUIRE(allocator.GetHighWaterMark() == 256);
+        REQUIRE(allocator.Allocate(16, 16) == 0);
+    }
+
+    SECTION("Concurrent Allocation")
+    {
+        constexpr size_t NumAllocations = 4096;
+        constexpr size_t AllocationSize = 64;
+        sy::ThreadPool      pool{7};
+        sy::LinearAllocator allocator{NumAllocations * AllocationSize};
+        std::vector<size_t> offsets(NumAllocations + 1);
+        pool.ParallelFor(offsets.size(), [&allocator, &offsets](const size_t idx) {
+            offsets[idx] = allocator.Allocate(AllocationSize, AllocationSize).value_or(std::numeric_limits<size_t>::max());
+        });
+
+        /** Exactly one allocation fails, and the others cover the whole capacity without overlap. */
+        std::sort(offsets.begin(), offsets.end());
+        REQUIRE(offsets.back() == std::numeric_limits<size_t>::max());
+        for (size_t idx = 0; idx < NumAllocations; ++idx)
+        {
+            REQUIRE(offsets[idx] == idx * AllocationSize);
+        }
+        REQUIRE(allocator.GetNumFailedAllocations() == 1);
+    }
+}
+
+TEST_CASE("LinearRecycler", "[linear_recycler]")
+{
+    sy::LinearRecycler<size_t> recycler{4};
+    size_t                     numCreated    = 0;
+    const auto                 allocateChunk = [&numCreated](const size_t count, std::vector<std::unique_ptr<size_t>>& objects) {
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            objects.emplace_back(std::make_unique<size_t>(numCreated++));
+        }
+    };
+
+    for (size_t frame = 0; frame < 3; ++frame)
+    {
+        recycler.Reset();
+        /** Objects are handed out in the same order every frame, and created only at the first frame. */
+        for (size_t idx = 0; idx < 10; ++idx)
+        {
+            REQUIRE(recycler.Request(allocateChunk) == idx);
+        }
+        REQUIRE(recycler.GetNumRequested() == 10);
+    }
+
+    /** Chunks grow geometrically: 4, 4, 8. */
+    REQUIRE(recycler.GetNumAllocated() == 16);
+    REQUIRE(recycler.GetNumChunks() == 3);
+    REQUIRE(numCreated == 16);
+}
+
+TEST_CASE("Upload ring benchmark", "[.][benchmark][upload_ring]")
+{
+    /** CPU side of UploadRingBuffer; host memory stands in for persistently mapped partition. */
+    constexpr size_t NumUploads = 10'000;
+    constexpr size_t NumFrames  = 100;
+    const glm::mat4  data{1.f};
+
+    sy::LinearAllocator    allocator{NumUploads * sizeof(glm::mat4)};
+    std::vector<std::byte> partition(allocator.GetCapacity());
+    const auto             upload = [&allocator, &partition, &data](size_t) {
+        const size_t offset = *allocator.Allocate(sizeof(glm::mat4), sizeof(glm::mat4));
+        std::memcpy(partition.data() + offset, &data, sizeof(glm::mat4));
+    };
+
+    for (const size_t numWorkers : {0, 3, 7})
+    {
+        sy::ThreadPool pool{numWorkers};
+        const auto     begin = std::chrono::high_resolution_clock::now();
+        for (size_t frame = 0; frame < NumFrames; ++frame)
+        {
+            allocator.Reset();
+            pool.ParallelFor(NumUploads, upload);
+        }
+        const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+        REQUIRE(allocator.GetNumFailedAllocations() == 0);
+        spdlog::info("[Upload Ring] {} uploads per frame, {} threads: {:.3f} ms per frame", NumUploads, pool.GetNumThreads(), elapsed / NumFrames);
+    }
+}
@@ -0,0 +1,2198 @@
+#include <PCH.h>
+#include <catch.hpp>
+#include <Render/TextureResidencyPolicy.h>
+#include <Render/AsyncComputePlacement.h>
+#include <Render/TransientResourceAliasing.h>
+#include <Render/RenderGraph.h>
+#include <Render/RenderGraphProfiler.h>
+#include <Render/RenderGraphSchedule.h>
+#include <Render/RenderNode.h>
+#include <Render/Vertex.h>
+#include <Render/RenderPass.h>
+#include <Core/ThreadPool.h>
+#include <VK/VulkanContext.h>
+#include <VK/DescriptorSlotAllocator.h>
+#include <VK/DescriptorWriteQueue.h>
+#include <VK/DescriptorAllocator.h>
+#include <VK/BufferBuilder.h>
+#include <VK/CommandBuffer.h>
+#include <Core/LinearRecycler.h>
+#include <Window/WindowBuilder.h>
+#include <Window/Window.h>
+
+namespace
+{
+/** Node which encodes fixed amount of commands into its own CPU command stream, instead of the given command buffer. */
+class SyntheticRecordNode final : public sy::render::RenderNode
+{
+public:
+    static constexpr size_t CommandsPerNode = 2000;
+
+    using RenderNode::RenderNode;
+
+    void Record(sy::vk::CommandBuffer& cmdBuffer) override
+    {
+        commandStream.clear();
+        uint32_t state = static_cast<uint32_t>(GetId()) * 2654435761u;
+        for (size_t cmdIdx = 0; cmdIdx < CommandsPerNode; ++cmdIdx)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            commandStream.emplace_back(state);
+            commandStream.emplace_back(static_cast<uint32_t>(cmdIdx));
+        }
+    }
+
+    [[nodiscard]] size_t GetNumRecordedCommands() const { return commandStream.size() / 2; }
+
+private:
+    std::vector<uint32_t> commandStream;
+};
+
+/**
+ * Pass which encodes bind vertex buffer, bind index buffer, push constants and draw of each draw into CPU command stream.
+ * Command stream is chosen by handle of the command buffer, so command buffer of range N must have handle N + 1.
+ */
+class SyntheticDrawPass final : public sy::render::RenderPass
+{
+public:
+    SyntheticDrawPass(const std::string_view name, sy::vk::VulkanContext& vulkanContext, const size_t numDraws) :
+        RenderPass(name, vulkanContext), numDraws(numDraws)
+    {
+    }
+
+    using RenderPass::RecordDrawRange;
+
+    void ResetCommandStreams(const size_t numCmdBuffers) { commandStreams.assign(numCmdBuffers, {}); }
+
+    [[nodiscard]] size_t GetNumRecordedCommands() const
+    {
+        size_t numCommands = 0;
+        for (const auto& commandStream : commandStreams)
+        {
+            numCommands += commandStream.size() / 2;
+        }
+        return numCommands;
+    }
+
+protected:
+    [[nodiscard]] size_t GetNumDraws() const override { return numDraws; }
+
+    void OnBeginDraws(const sy::vk::CommandBuffer& cmdBuffer) const override
+    {
+        auto& commandStream = QueryCommandStream(cmdBuffer);
+        commandStream.clear();
+        commandStream.emplace_back(std::numeric_limits<uint32_t>::max());
+        commandStream.emplace_back(0);
+    }
+
+    void RecordDraws(const sy::vk::CommandBuffer& cmdBuffer, const size_t begin, const size_t end) const override
+    {
+        auto& commandStream = QueryCommandStream(cmdBuffer);
+        for (size_t drawIdx = begin; drawIdx < end; ++drawIdx)
+        {
+            uint32_t state = static_cast<uint32_t>(drawIdx) * 2654435761u + 1;
+            for (uint32_t cmdIdx = 0; cmdIdx < 4; ++cmdIdx)
+            {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                commandStream.emplace_back(cmdIdx);
+                commandStream.emplace_back(state);
+            }
+        }
+    }
+
+private:
+    [[nodiscard]] std::vector<uint32_t>& QueryCommandStream(const sy::vk::CommandBuffer& cmdBuffer) const
+    {
+        return commandStreams[reinterpret_cast<size_t>(cmdBuffer.GetNative()) - 1];
+    }
+
+private:
+    const size_t                               numDraws;
+    mutable std::vector<std::vector<uint32_t>> commandStreams;
+};
+} // namespace
+
+TEST_CASE("TextureResidencyPolicy", "[texture_residency]")
+{
+    using sy::render::TextureResidencyPolicy;
+    /** Resident size for each base mip; mips of 64, 16, 4 and 1 bytes. */
+    const std::vector<size_t> residentSizes = {85, 21, 5, 1};
+
+    SECTION("Evict top mips of least recently used textures")
+    {
+        TextureResidencyPolicy policy{TextureResidencyPolicy::Config{
+            .BudgetBytes          = 200,
+            .ColdFrameThreshold   = 8,
+            .MinResidentMips      = 1,
+            .MaxEvictionsPerFrame = 4}};
+
+        policy.Register(0, residentSizes, 0);
+        policy.Register(1, residentSizes, 0);
+        policy.Register(2, residentSizes, 0);
+        policy.MarkUsed(0, 10);
+        policy.MarkUsed(1, 5);
+        policy.MarkUsed(2, 1);
+
+        auto decisions = policy.Evaluate(20);
+        REQUIRE(decisions.size() == 1);
+        REQUIRE(decisions[0].Target == 2);
+        REQUIRE(decisions[0].BaseMip == 1);
+        REQUIRE(policy.GetStatistics().ResidentBytes == 85 + 85 + 21);
+        REQUIRE(policy.GetStatistics().EvictionsThisFrame == 1);
+        REQUIRE(policy.GetStatistics().EvictedMipsThisFrame == 1);
+
+        policy.SetBudget(100);
+        decisions = policy.Evaluate(21);
+        REQUIRE(decisions.size() == 2);
+        REQUIRE(decisions[0].Target == 2);
+        REQUIRE(decisions[0].BaseMip == 3); /* Tail mip always resident. */
+        REQUIRE(decisions[1].Target == 1);
+        REQUIRE(decisions[1].BaseMip == 2);
+        REQUIRE(policy.GetStatistics().ResidentBytes == 85 + 5 + 1);
+        REQUIRE(policy.GetStatistics().TotalEvictions == 3);
+    }
+
+    SECTION("Hot textures are never evicted")
+    {
+        TextureResidencyPolicy policy{TextureResidencyPolicy::Config{
+            .BudgetBytes        = 100,
+            .ColdFrameThreshold = 8}};
+
+        policy.Register(0, residentSizes, 0);
+        policy.Register(1, residentSizes, 0);
+        policy.MarkUsed(0, 15);
+        policy.MarkUsed(1, 16);
+
+        const auto decisions = policy.Evaluate(20);
+        REQUIRE(decisions.empty());
+        REQUIRE(policy.GetStatistics().ResidentBytes == 170);
+        REQUIRE(policy.GetResidentBaseMip(0) == 0);
+        REQUIRE(policy.GetResidentBaseMip(1) == 0);
+    }
+
+    SECTION("Eviction and restoration are rate limited")
+    {
+        TextureResidencyPolicy policy{TextureResidencyPolicy::Config{
+            .BudgetBytes             = 10,
+            .ColdFrameThreshold      = 1,
+            .MaxEvictionsPerFrame    = 1,
+            .MaxRestorationsPerFrame = 1}};
+
+        policy.Register(0, residentSizes, 0);
+        policy.Register(1, residentSizes, 0);
+
+        REQUIRE(policy.Evaluate(5).size() == 1);
+        REQUIRE(policy.GetResidentBaseMip(0) == 3);
+        REQUIRE(policy.GetResidentBaseMip(1) == 0);
+        REQUIRE(policy.Evaluate(6).size() == 1);
+        REQUIRE(policy.GetResidentBaseMip(1) == 2);
+
+        policy.SetBudget(1000);
+        policy.MarkUsed(0, 7);
+        policy.MarkUsed(1, 7);
+        auto decisions = policy.Evaluate(7);
+        REQUIRE(decisions.size() == 1);
+        REQUIRE(decisions[0].BaseMip == 0);
+        REQUIRE(policy.GetStatistics().RestorationsThisFrame == 1);
+
+        decisions = policy.Evaluate(7);
+        REQUIRE(decisions.size() == 1);
+        REQUIRE(policy.GetStatistics().ResidentBytes == 170);
+        REQUIRE(policy.GetStatistics().TotalRestorations == 2);
+    }
+
+    SECTION("Actual allocation size overrides estimation")
+    {
+        TextureResidencyPolicy policy;
+        policy.Register(0, residentSizes, 0);
+        REQUIRE(policy.GetResidentBytes(0) == 85);
+        policy.UpdateResidentBytes(0, 128);
+        REQUIRE(policy.GetResidentBytes(0) == 128);
+        policy.Unregister(0);
+        REQUIRE(!policy.Contains(0));
+        REQUIRE(policy.GetStatistics().NumTrackedTextures == 0);
+    }
+
+    SECTION("Actual allocation size replaces registered size of the base mip")
+    {
+        TextureResidencyPolicy policy{TextureResidencyPolicy::Config{
+            .BudgetBytes        = 50,
+            .ColdFrameThreshold = 1}};
+        policy.Register(0, residentSizes, 0);
+        policy.UpdateResidentBytes(0, 128);
+
+        REQUIRE(policy.Evaluate(5).size() == 1);
+        REQUIRE(policy.GetResidentBaseMip(0) == 1);
+        REQUIRE(policy.GetStatistics().ResidentBytes == 21);
+
+        /** Restoration accounts actual size of the base mip, so resident bytes do not drift while streaming. */
+        policy.SetBudget(1000);
+        policy.MarkUsed(0, 6);
+        REQUIRE(policy.Evaluate(6).size() == 1);
+        REQUIRE(policy.GetResidentBaseMip(0) == 0);
+        REQUIRE(policy.GetStatistics().ResidentBytes == 128);
+    }
+}
+
+TEST_CASE("Packed vertex formats", "[vertex]")
+{
+    using namespace sy::render;
+    REQUIRE(SizeOfVertex(EVertexType::PT0NPacked) == 20);
+    REQUIRE(SizeOfVertex(EVertexType::QPT0NPacked) == 16);
+    REQUIRE(SizeOfVertex(EVertexType::QPT0NPacked) * 2 == SizeOfVertex(EVertexType::PT0N));
+
+    const std::vector<VertexPT0N> vertices = {
+        {.Position = {-1.f, 0.f, 2.f}, .TexCoords0 = {0.f, 1.f}, .Normal = {0.f, 1.f, 0.f}},
+        {.Position = {3.f, 4.f, 2.5f}, .TexCoords0 = {0.25f, 0.75f}, .Normal = {0.f, 0.f, -1.f}}};
+
+    const VertexBounds bounds = CalculateVertexBounds(vertices);
+    REQUIRE(bounds.Min == glm::vec3{-1.f, 0.f, 2.f});
+    REQUIRE(bounds.Max == glm::vec3{3.f, 4.f, 2.5f});
+
+    SECTION("Texture coordinates and normals")
+    {
+        std::vector<uint8_t> packed(SizeOfVertex(EVertexType::PT0NPacked) * vertices.size());
+        REQUIRE(PackVertices(vertices, EVertexType::PT0NPacked, bounds, packed));
+
+        const auto* packedVertices = reinterpret_cast<const VertexPT0NPacked*>(packed.data());
+        REQUIRE(packedVertices[1].Position == vertices[1].Position);
+        REQUIRE(glm::unpackHalf2x16(packedVertices[1].TexCoords0) == vertices[1].TexCoords0);
+
+        const glm::vec3 normal = glm::vec3{glm::unpackUnorm3x10_1x2(packedVertices[1].Normal)} * 2.f - 1.f;
+        REQUIRE(glm::length(normal - vertices[1].Normal) < 0.005f);
+    }
+
+    SECTION("Quantized positions")
+    {
+        std::vector<uint8_t> packed(SizeOfVertex(EVertexType::QPT0NPacked) * vertices.size());
+        REQUIRE(PackVertices(vertices, EVertexType::QPT0NPacked, bounds, packed));
+
+        const auto* packedVertices = reinterpret_cast<const VertexQPT0NPacked*>(packed.data());
+        for (size_t idx = 0; idx < vertices.size(); ++idx)
+        {
+            const glm::vec3 position = glm::vec3{packedVertices[idx].Position} / 65535.f * bounds.GetExtent() + bounds.Min;
+            REQUIRE(glm::length(position - vertices[idx].Position) < 0.001f);
+        }
+    }
+
+    SECTION("Non-packed target or size mismatch")
+    {
+        std::vector<uint8_t> packed(SizeOfVertex(EVertexType::PT0NPacked));
+        REQUIRE(!PackVertices(vertices, EVertexType::PT0NPacked, bounds, packed));
+        REQUIRE(!PackVertices(vertices, EVertexType::PT0N, bounds, packed));
+    }
+}
+
+TEST_CASE("TransientResourceAliasing", "[render_graph]")
+{
+    using sy::render::TransientResourceAliasing;
+
+    SECTION("Disjoint lifetimes share memory")
+    {
+        const std::vector<TransientResourceAliasing::Request> requests = {
+            {.Size = 100, .FirstUse = 0, .LastUse = 1},
+            {.Size = 100, .FirstUse = 2, .LastUse = 3},
+            {.Size = 50, .Alignment = 64, .FirstUse = 1, .LastUse = 2}};
+
+        const auto result = TransientResourceAliasing::Pack(requests);
+        REQUIRE(result.Heaps.size() == 1);
+        REQUIRE(result.Placements[0].Offset == 0);
+        REQUIRE(result.Placements[1].Offset == 0);
+        REQUIRE(result.Placements[2].Offset == 128);
+        REQUIRE(result.Heaps[0].Alignment == 64);
+        REQUIRE(result.BytesWithoutAliasing == 250);
+        REQUIRE(result.BytesWithAliasing == 178);
+        REQUIRE(result.PeakLiveBytes == 150);
+    }
+
+    SECTION("Gap between alive resources is reused")
+    {
+        const std::vector<TransientResourceAliasing::Request> requests = {
+            {.Size = 64, .FirstUse = 0, .LastUse = 4},
+            {.Size = 64, .FirstUse = 0, .LastUse = 0},
+            {.Size = 64, .FirstUse = 0, .LastUse = 4},
+            {.Size = 32, .FirstUse = 2, .LastUse = 3}};
+
+        const auto result = TransientResourceAliasing::Pack(requests);
+        REQUIRE(result.Placements[1].Offset == 64);
+        REQUIRE(result.Placements[3].Offset == 64);
+        REQUIRE(result.BytesWithAliasing == 192);
+        REQUIRE(result.BytesWithAliasing >= result.PeakLiveBytes);
+    }
+
+    SECTION("Incompatible memory types never alias")
+    {
+        const std::vector<TransientResourceAliasing::Request> requests = {
+            {.Size = 100, .MemoryTypeBits = 0b01, .FirstUse = 0, .LastUse = 0},
+            {.Size = 100, .MemoryTypeBits = 0b10, .FirstUse = 1, .LastUse = 1},
+            {.Size = 100, .MemoryTypeBits = 0b11, .FirstUse = 2, .LastUse = 2}};
+
+        const auto result = TransientResourceAliasing::Pack(requests);
+        REQUIRE(result.Heaps.size() == 2);
+        REQUIRE(result.Placements[0].HeapIndex != result.Placements[1].HeapIndex);
+        REQUIRE(result.Placements[2].HeapIndex == result.Placements[0].HeapIndex);
+        REQUIRE(result.BytesWithAliasing == 200);
+    }
+}
+
+TEST_CASE("RenderGraph resource lifetimes", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    /** Declared out of execution order. */
+    auto& n3 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n3");
+    n3.AsGenaralSampledImage("C");
+    n3.AsGenaralSampledImage("A");
+    n3.CreateTexture("D");
+
+    auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+    n1.AsGenaralSampledImage("A");
+    n1.CreateTexture("B");
+
+    auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+    n0.CreateTexture("A");
+
+    auto& n2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n2");
+    n2.AsGenaralSampledImage("B");
+    n2.CreateTexture("C");
+
+    renderGraph.Compile();
+
+    const auto requireLifetime = [&renderGraph](const std::string_view name, const size_t firstUse, const size_t lastUse) {
+        const auto& texture = renderGraph.GetOrCreateTexture(name);
+        REQUIRE(texture.GetFirstUse() == firstUse);
+        REQUIRE(texture.GetLastUse() == lastUse);
+    };
+
+    requireLifetime("A", 0, 3);
+    requireLifetime("B", 1, 2);
+    requireLifetime("C", 2, 3);
+    requireLifetime("D", 3, 3);
+}
+
+TEST_CASE("RenderGraph transient resource aliasing", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::EBufferState;
+    namespace key = schedule_key;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    constexpr size_t BufferSize = 1 << 20;
+    auto&            c0         = renderGraph.EmplaceNode<RenderNode>(renderGraph, "c0");
+    c0.CreateBuffer("X", EBufferState::ComputeShaderWrite, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT).GetBuilder().SetSize(BufferSize);
+    c0.ExecuteOnAsyncCompute();
+
+    auto& g0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g0");
+    g0.CreateBuffer("A", EBufferState::ComputeShaderWrite, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT).GetBuilder().SetSize(BufferSize);
+
+    auto& g1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g1");
+    g1.AsReadDependency("A", VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, EBufferState::ComputeShaderReadStorageBuffer);
+    g1.CreateBuffer("B", EBufferState::ComputeShaderWrite, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT).GetBuilder().SetSize(BufferSize);
+
+    auto& g2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g2");
+    g2.AsReadDependency("B", VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, EBufferState::ComputeShaderReadStorageBuffer);
+    g2.CreateBuffer("C", EBufferState::ComputeShaderWrite, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT).GetBuilder().SetSize(BufferSize);
+
+    /** Execution order: g0, c0 (level 0), g1 (level 1), g2 (level 2). Async compute never synchronizes with graphics. */
+    renderGraph.Compile();
+    /** Unit tests run without device, so memory requirements are given instead of queried. */
+    renderGraph.PlanTransientResources([](std::string_view) {
+        return VkMemoryRequirements{.size = BufferSize, .alignment = 256, .memoryTypeBits = std::numeric_limits<uint32_t>::max()};
+    });
+
+    const json heaps = renderGraph.BuildScheduleDump()[key::AliasingHeaps];
+    REQUIRE(heaps.size() == 1);
+    std::map<std::string, size_t> offsets;
+    for (const json& placement : heaps[0][key::Resources])
+    {
+        offsets[placement[key::Name].get<std::string>()] = placement[key::Offset].get<size_t>();
+    }
+
+    SECTION("Resources on unsynchronized queues never share memory")
+    {
+        REQUIRE(offsets.size() == 4);
+        REQUIRE(offsets["X"] != offsets["A"]);
+        REQUIRE(offsets["X"] != offsets["B"]);
+        REQUIRE(offsets["X"] != offsets["C"]);
+        REQUIRE(offsets["C"] == offsets["A"]);
+    }
+
+    SECTION("First use of aliased memory waits on last access of previous resource")
+    {
+        const auto aliasingBarrier = renderGraph.QueryAliasingBarrier("C");
+        REQUIRE(aliasingBarrier.has_value());
+        REQUIRE(aliasingBarrier->get().PreviousResources == std::vector<std::string>{"A"});
+
+        const vk::AccessPattern lastAccess = vk::QueryAccessPattern(EBufferState::ComputeShaderReadStorageBuffer);
+        REQUIRE(aliasingBarrier->get().SourceStage == lastAccess.PipelineStage);
+        REQUIRE(aliasingBarrier->get().SourceAccess == lastAccess.Access);
+        REQUIRE_FALSE(renderGraph.QueryAliasingBarrier("A").has_value());
+        REQUIRE_FALSE(renderGraph.QueryAliasingBarrier("X").has_value());
+
+        /** Contents of previous resource are discarded. */
+        REQUIRE(renderGraph.GetNodeStateTransitions("g2").Buffers.back().Resource == "C");
+        REQUIRE(renderGraph.GetNodeStateTransitions("g2").Buffers.back().Source == EBufferState::None);
+    }
+}
+
+TEST_CASE("RenderGraph state transition scheduling", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::EBufferState;
+    using vk::ETextureState;
+    using TextureTransition = RenderGraph::ScheduledTextureStateTransition;
+    using BufferTransition  = RenderGraph::ScheduledBufferStateTransition;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+    n0.CreateTexture("A");
+    n0.CreateBuffer("U");
+
+    auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+    n1.AsReadDependency("A", VK_IMAGE_USAGE_SAMPLED_BIT, ETextureState::FragmentShaderReadSampledImage);
+    n1.CreateTexture("B");
+
+    auto& n2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n2");
+    n2.AsReadDependency("A", VK_IMAGE_USAGE_SAMPLED_BIT, ETextureState::ComputeShaderReadSampledImage);
+    n2.AsReadDependency("U", VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, EBufferState::ComputeShaderReadStorageBuffer);
+    n2.CreateTexture("C");
+
+    auto& n3 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n3");
+    n3.AsReadDependency("A", VK_IMAGE_USAGE_SAMPLED_BIT, ETextureState::FragmentShaderReadSampledImage);
+    n3.AsReadDependency("B", VK_IMAGE_USAGE_SAMPLED_BIT, ETextureState::FragmentShaderReadSampledImage);
+    n3.AsReadDependency("C", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::FragmentShaderReadGeneral);
+    n3.AsReadDependency("U", VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, EBufferState::FragmentShaderReadUniformBuffer);
+    n3.CreateTexture("D");
+
+    renderGraph.Compile();
+
+    SECTION("First use transitions from undefined state")
+    {
+        const auto& transitions = renderGraph.GetNodeStateTransitions("n0");
+        REQUIRE(transitions.Textures == std::vector<TextureTransition>{{.Resource = "A", .Source = ETextureState::None, .Destination = ETextureState::ColorAttachmentWrite}});
+        REQUIRE(transitions.Buffers == std::vector<BufferTransition>{{.Resource = "U", .Source = EBufferState::None, .Destination = EBufferState::ComputeShaderWrite}});
+    }
+
+    SECTION("Readers at the same dependency level share combined read state")
+    {
+        const auto& n1Transitions = renderGraph.GetNodeStateTransitions("n1");
+        REQUIRE(n1Transitions.Textures == std::vector<TextureTransition>{
+                                              {.Resource = "A", .Source = ETextureState::ColorAttachmentWrite, .Destination = ETextureState::AnyShaderReadSampledImage},
+                                              {.Resource = "B", .Source = ETextureState::None, .Destination = ETextureState::ColorAttachmentWrite}});
+
+        const auto& n2Transitions = renderGraph.GetNodeStateTransitions("n2");
+        REQUIRE(n2Transitions.Textures == std::vector<TextureTransition>{{.Resource = "C", .Source = ETextureState::None, .Destination = ETextureState::ColorAttachmentWrite}});
+        REQUIRE(n2Transitions.Buffers == std::vector<BufferTransition>{{.Resource = "U", .Source = EBufferState::ComputeShaderWrite, .Destination = EBufferState::ComputeShaderReadStorageBuffer}});
+    }
+
+    SECTION("Read after read only transitions on layout change")
+    {
+        const auto& transitions = renderGraph.GetNodeStateTransitions("n3");
+        REQUIRE(transitions.Textures == std::vector<TextureTransition>{
+                                            {.Resource = "B", .Source = ETextureState::ColorAttachmentWrite, .Destination = ETextureState::FragmentShaderReadSampledImage},
+                                            {.Resource = "C", .Source = ETextureState::ColorAttachmentWrite, .Destination = ETextureState::FragmentShaderReadGeneral},
+                                            {.Resource = "D", .Source = ETextureState::None, .Destination = ETextureState::ColorAttachmentWrite}});
+        REQUIRE(transitions.Buffers.empty());
+        REQUIRE(transitions.ReleaseTextures.empty());
+    }
+}
+
+TEST_CASE("RenderGraph queue ownership transfer scheduling", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::ETextureState;
+    using TextureTransition = RenderGraph::ScheduledTextureStateTransition;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+    n0.CreateTexture("A", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+    n0.ExecuteOnAsyncCompute();
+
+    auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+    n1.AsGenaralSampledImage("A");
+    n1.CreateTexture("B");
+
+    renderGraph.Compile();
+
+    const TextureTransition expected{
+        .Resource         = "A",
+        .Source           = ETextureState::ComputeShaderWrite,
+        .Destination      = ETextureState::AnyShaderReadSampledImage,
+        .SourceQueue      = vk::EQueueType::Compute,
+        .DestinationQueue = vk::EQueueType::Graphics};
+
+    REQUIRE(renderGraph.GetNodeStateTransitions("n0").ReleaseTextures == std::vector<TextureTransition>{expected});
+    REQUIRE(renderGraph.GetNodeStateTransitions("n1").Textures.front() == expected);
+}
+
+TEST_CASE("RenderGraph readers on different queues at the same dependency level", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::EQueueType;
+    using vk::ETextureState;
+    using TextureTransition = RenderGraph::ScheduledTextureStateTransition;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& g0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g0");
+    g0.CreateTexture("A", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& g1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g1");
+    g1.AsReadDependency("A", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    g1.CreateTexture("B", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& c1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "c1");
+    c1.AsReadDependency("A", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    c1.CreateTexture("C", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+    c1.ExecuteOnAsyncCompute();
+
+    /** Execution order: g0 (level 0), g1, c1 (level 1) */
+    renderGraph.Compile();
+
+    /** Graphics readers release ownership to compute readers after they are done. */
+    const TextureTransition expected{
+        .Resource         = "A",
+        .Source           = ETextureState::ComputeShaderReadGeneral,
+        .Destination      = ETextureState::ComputeShaderReadGeneral,
+        .SourceQueue      = EQueueType::Graphics,
+        .DestinationQueue = EQueueType::Compute};
+
+    REQUIRE(renderGraph.GetNodeStateTransitions("g1").Textures.front() == TextureTransition{.Resource = "A", .Source = ETextureState::ComputeShaderWrite, .Destination = ETextureState::ComputeShaderReadGeneral});
+    REQUIRE(renderGraph.GetNodeStateTransitions("g1").ReleaseTextures == std::vector<TextureTransition>{expected});
+    REQUIRE(renderGraph.GetNodeStateTransitions("c1").Textures.front() == expected);
+    REQUIRE(renderGraph.GetNodeStateTransitions("c1").ReleasedBy == std::vector<size_t>{1});
+
+    const auto& batches = renderGraph.GetSubmitBatches();
+    REQUIRE(batches.size() == 2);
+    REQUIRE(batches[0].Nodes == std::vector<size_t>{0, 1});
+    REQUIRE(batches[1].Queue == EQueueType::Compute);
+    REQUIRE(batches[1].WaitBatches == std::vector<size_t>{0});
+}
+
+TEST_CASE("RenderGraph readers on different queues declared interleaved", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::EQueueType;
+    using vk::ETextureState;
+    using TextureTransition = RenderGraph::ScheduledTextureStateTransition;
+    namespace key           = schedule_key;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& g0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g0");
+    g0.CreateTexture("A", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& g1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g1");
+    g1.AsReadDependency("A", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    g1.CreateTexture("B", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& c1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "c1");
+    c1.AsReadDependency("A", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    c1.CreateTexture("C", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+    c1.ExecuteOnAsyncCompute();
+
+    auto& g2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g2");
+    g2.AsReadDependency("A", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    g2.CreateTexture("D", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    /** Nodes of a level are grouped by queue. Execution order: g0 (level 0), g1, g2, c1 (level 1) */
+    renderGraph.Compile();
+
+    const json nodes = renderGraph.BuildScheduleDump()[key::Nodes];
+    REQUIRE(nodes.size() == 4);
+    REQUIRE(nodes[1][key::Name] == "g1");
+    REQUIRE(nodes[2][key::Name] == "g2");
+    REQUIRE(nodes[3][key::Name] == "c1");
+
+    /** Last graphics reader releases ownership to compute readers. */
+    const TextureTransition expected{
+        .Resource         = "A",
+        .Source           = ETextureState::ComputeShaderReadGeneral,
+        .Destination      = ETextureState::ComputeShaderReadGeneral,
+        .SourceQueue      = EQueueType::Graphics,
+        .DestinationQueue = EQueueType::Compute};
+
+    REQUIRE(renderGraph.GetNodeStateTransitions("g1").Textures.front() == TextureTransition{.Resource = "A", .Source = ETextureState::ComputeShaderWrite, .Destination = ETextureState::ComputeShaderReadGeneral});
+    REQUIRE(renderGraph.GetNodeStateTransitions("g1").ReleaseTextures.empty());
+    REQUIRE(renderGraph.GetNodeStateTransitions("g2").Textures.front().Resource == "D");
+    REQUIRE(renderGraph.GetNodeStateTransitions("g2").ReleaseTextures == std::vector<TextureTransition>{expected});
+    REQUIRE(renderGraph.GetNodeStateTransitions("c1").Textures.front() == expected);
+    REQUIRE(renderGraph.GetNodeStateTransitions("c1").ReleasedBy == std::vector<size_t>{2});
+
+    const auto& batches = renderGraph.GetSubmitBatches();
+    REQUIRE(batches.size() == 2);
+    REQUIRE(batches[0].Nodes == std::vector<size_t>{0, 1, 2});
+    REQUIRE(batches[1].Queue == EQueueType::Compute);
+    REQUIRE(batches[1].WaitBatches == std::vector<size_t>{0});
+}
+
+TEST_CASE("RenderGraph submit batches", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    SECTION("Single queue graph is submitted at once")
+    {
+        auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+        n0.CreateTexture("A");
+        auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+        n1.AsGenaralSampledImage("A");
+        n1.CreateTexture("B");
+        renderGraph.Compile();
+
+        const auto& batches = renderGraph.GetSubmitBatches();
+        REQUIRE(batches.size() == 1);
+        REQUIRE(batches[0].Nodes == std::vector<size_t>{0, 1});
+        REQUIRE(batches[0].WaitBatches.empty());
+    }
+
+    SECTION("Batches split at cross-queue sync points")
+    {
+        auto& g0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g0");
+        g0.CreateTexture("A");
+
+        auto& c0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "c0");
+        c0.AsReadDependency("A", VK_IMAGE_USAGE_SAMPLED_BIT, vk::ETextureState::ComputeShaderReadSampledImage);
+        c0.CreateTexture("B", vk::ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+        c0.ExecuteOnAsyncCompute();
+
+        auto& g1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g1");
+        g1.CreateTexture("C");
+
+        auto& g2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g2");
+        g2.AsGenaralSampledImage("B");
+        g2.AsGenaralSampledImage("C");
+        g2.CreateTexture("D");
+
+        renderGraph.Compile();
+
+        /** Execution order: g0, g1 (level 0), c0 (level 1), g2 (level 2) */
+        const auto& batches = renderGraph.GetSubmitBatches();
+        REQUIRE(batches.size() == 4);
+
+        REQUIRE(batches[0].Queue == vk::EQueueType::Graphics);
+        REQUIRE(batches[0].Nodes == std::vector<size_t>{0});
+        REQUIRE(batches[0].bIsWaitedByOtherQueue);
+
+        REQUIRE(batches[1].Queue == vk::EQueueType::Graphics);
+        REQUIRE(batches[1].Nodes == std::vector<size_t>{1});
+        REQUIRE(batches[1].WaitBatches.empty());
+        REQUIRE(!batches[1].bIsWaitedByOtherQueue);
+
+        REQUIRE(batches[2].Queue == vk::EQueueType::Compute);
+        REQUIRE(batches[2].Nodes == std::vector<size_t>{2});
+        REQUIRE(batches[2].WaitBatches == std::vector<size_t>{0});
+        REQUIRE(batches[2].bIsWaitedByOtherQueue);
+
+        REQUIRE(batches[3].Queue == vk::EQueueType::Graphics);
+        REQUIRE(batches[3].Nodes == std::vector<size_t>{3});
+        REQUIRE(batches[3].WaitBatches == std::vector<size_t>{2});
+    }
+
+    SECTION("Graph which ends on async compute has no circular wait")
+    {
+        auto& g0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g0");
+        g0.CreateTexture("A");
+
+        auto& g1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "g1");
+        g1.AsGenaralSampledImage("A");
+        g1.CreateTexture("B");
+
+        auto& c2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "c2");
+        c2.AsReadDependency("B", VK_IMAGE_USAGE_SAMPLED_BIT, vk::ETextureState::ComputeShaderReadSampledImage);
+        c2.CreateTexture("C", vk::ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+        c2.ExecuteOnAsyncCompute();
+
+        renderGraph.Compile();
+
+        /** Last batch of compute waits on last batch of graphics, so graphics joins compute in trailing submit of Execute. */
+        const auto& batches = renderGraph.GetSubmitBatches();
+        REQUIRE(batches.size() == 2);
+        REQUIRE(batches[0].Queue == vk::EQueueType::Graphics);
+        REQUIRE(batches[0].Nodes == std::vector<size_t>{0, 1});
+        REQUIRE(batches[1].Queue == vk::EQueueType::Compute);
+        REQUIRE(batches[1].Nodes == std::vector<size_t>{2});
+        REQUIRE(batches[1].WaitBatches == std::vector<size_t>{0});
+
+        /** Batches only wait on batches submitted before, which can not form a cycle. */
+        for (size_t batchIdx = 0; batchIdx < batches.size(); ++batchIdx)
+        {
+            for (const size_t waitBatchIdx : batches[batchIdx].WaitBatches)
+            {
+                REQUIRE(waitBatchIdx < batchIdx);
+            }
+        }
+    }
+}
+
+TEST_CASE("RenderGraph transfer queue synchronization", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::EBufferState;
+    using vk::EQueueType;
+    using vk::ETextureState;
+    using BufferTransition = RenderGraph::ScheduledBufferStateTransition;
+    namespace key          = schedule_key;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& upload = renderGraph.EmplaceNode<RenderNode>(renderGraph, "upload");
+    upload.CreateBuffer("Instances", EBufferState::TransferWrite, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    upload.ExecuteOnTransfer();
+
+    auto& gbuffer = renderGraph.EmplaceNode<RenderNode>(renderGraph, "gbuffer");
+    gbuffer.CreateTexture("GBuffer");
+
+    auto& culling = renderGraph.EmplaceNode<RenderNode>(renderGraph, "culling");
+    culling.AsReadDependency("Instances", VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, EBufferState::ComputeShaderReadStorageBuffer);
+    culling.CreateBuffer("Visible", EBufferState::ComputeShaderWrite, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    culling.ExecuteOnAsyncCompute();
+
+    auto& lighting = renderGraph.EmplaceNode<RenderNode>(renderGraph, "lighting");
+    lighting.AsGenaralSampledImage("GBuffer");
+    lighting.AsReadDependency("Visible", VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, EBufferState::FragmentShaderReadStorageBuffer);
+    lighting.CreateTexture("Lit");
+
+    auto& readback = renderGraph.EmplaceNode<RenderNode>(renderGraph, "readback");
+    readback.AsReadDependency("Lit", VK_IMAGE_USAGE_TRANSFER_SRC_BIT, ETextureState::TransferRead);
+    readback.CreateBuffer("Screenshot", EBufferState::TransferWrite, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    readback.ExecuteOnTransfer();
+
+    REQUIRE(RenderGraph::NumOfSupportedQueues == 3);
+    REQUIRE(readback.GetQueueType() == EQueueType::Transfer);
+    renderGraph.Compile();
+
+    /**
+     * Execution order: gbuffer, upload (level 0), culling (level 1), lighting (level 2), readback (level 3)
+     * Synchronization index: gbuffer = 1, lighting = 2 (Graphics), culling = 3 (Compute), upload = 4, readback = 5 (Transfer)
+     */
+    SECTION("Sufficient synchronization index sets of three queues")
+    {
+        using Indices = std::vector<size_t>;
+
+        const json  schedule = renderGraph.BuildScheduleDump();
+        const json& nodes    = schedule[key::Nodes];
+        REQUIRE(nodes.size() == 5);
+        REQUIRE(nodes[0][key::Name] == "gbuffer");
+        REQUIRE(nodes[0][key::SSISNext].get<Indices>() == Indices{1, 0, 0});
+
+        REQUIRE(nodes[1][key::Name] == "upload");
+        REQUIRE(nodes[1][key::Queue] == "Transfer");
+        REQUIRE(nodes[1][key::SSISNext].get<Indices>() == Indices{0, 0, 4});
+
+        /** Compute waits on transfer, not on graphics. */
+        REQUIRE(nodes[2][key::Name] == "culling");
+        REQUIRE(nodes[2][key::SSISNow].get<Indices>() == Indices{0, 0, 4});
+        REQUIRE(nodes[2][key::SSISNext].get<Indices>() == Indices{0, 3, 4});
+
+        /** Graphics only synchronizes with compute; transfer is already covered by compute. */
+        REQUIRE(nodes[3][key::Name] == "lighting");
+        REQUIRE(nodes[3][key::SSISNow].get<Indices>() == Indices{1, 3, 0});
+        REQUIRE(nodes[3][key::SSISNext].get<Indices>() == Indices{2, 3, 0});
+
+        /** Transfer carries over what it already synchronized with. */
+        REQUIRE(nodes[4][key::Name] == "readback");
+        REQUIRE(nodes[4][key::SSISNow].get<Indices>() == Indices{2, 0, 4});
+        REQUIRE(nodes[4][key::SSISNext].get<Indices>() == Indices{2, 0, 5});
+    }
+
+    SECTION("Each queue waits only on its direct producer")
+    {
+        const auto& batches = renderGraph.GetSubmitBatches();
+        REQUIRE(batches.size() == 5);
+
+        REQUIRE(batches[0].Queue == EQueueType::Graphics);
+        REQUIRE(batches[0].Nodes == std::vector<size_t>{0});
+        REQUIRE(batches[0].WaitBatches.empty());
+
+        REQUIRE(batches[1].Queue == EQueueType::Transfer);
+        REQUIRE(batches[1].Nodes == std::vector<size_t>{1});
+        REQUIRE(batches[1].bIsWaitedByOtherQueue);
+
+        REQUIRE(batches[2].Queue == EQueueType::Compute);
+        REQUIRE(batches[2].WaitBatches == std::vector<size_t>{1});
+
+        REQUIRE(batches[3].Queue == EQueueType::Graphics);
+        REQUIRE(batches[3].Nodes == std::vector<size_t>{3});
+        REQUIRE(batches[3].WaitBatches == std::vector<size_t>{2});
+
+        REQUIRE(batches[4].Queue == EQueueType::Transfer);
+        REQUIRE(batches[4].Nodes == std::vector<size_t>{4});
+        REQUIRE(batches[4].WaitBatches == std::vector<size_t>{3});
+    }
+
+    SECTION("Ownership of uploaded buffer is transferred from transfer queue")
+    {
+        const BufferTransition expected{
+            .Resource         = "Instances",
+            .Source           = EBufferState::TransferWrite,
+            .Destination      = EBufferState::ComputeShaderReadStorageBuffer,
+            .SourceQueue      = EQueueType::Transfer,
+            .DestinationQueue = EQueueType::Compute};
+
+        REQUIRE(renderGraph.GetNodeStateTransitions("upload").ReleaseBuffers == std::vector<BufferTransition>{expected});
+        REQUIRE(renderGraph.GetNodeStateTransitions("culling").Buffers.front() == expected);
+    }
+}
+
+TEST_CASE("RenderGraph compile cache", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using CompileResult = RenderGraph::ECompileResult;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+    n0.CreateTexture("A");
+    auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+    n1.AsGenaralSampledImage("A");
+    n1.CreateTexture("B");
+
+    REQUIRE(renderGraph.Compile() == CompileResult::Full);
+    REQUIRE(renderGraph.Compile() == CompileResult::Cached);
+    REQUIRE(renderGraph.GetNodeStateTransitions("n1").Textures.front().Destination == vk::ETextureState::AnyShaderReadSampledImage);
+
+    SECTION("Changing access state only reschedules state transitions")
+    {
+        renderGraph.GetOrCreateTexture("A").UpdateReaderState("n1", vk::ETextureState::FragmentShaderReadSampledImage);
+        REQUIRE(renderGraph.Compile() == CompileResult::Incremental);
+        REQUIRE(renderGraph.GetNodeStateTransitions("n1").Textures.front().Destination == vk::ETextureState::FragmentShaderReadSampledImage);
+        REQUIRE(renderGraph.Compile() == CompileResult::Cached);
+    }
+
+    SECTION("Changing structure rebuilds graph")
+    {
+        auto& n2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n2");
+        n2.AsGenaralSampledImage("B");
+        n2.CreateTexture("C");
+        REQUIRE(renderGraph.Compile() == CompileResult::Full);
+        REQUIRE(renderGraph.GetSubmitBatches().front().Nodes == std::vector<size_t>{0, 1, 2});
+        REQUIRE(renderGraph.GetOrCreateTexture("B").GetLastUse() == 2);
+    }
+
+    SECTION("Moving node to other queue rebuilds graph")
+    {
+        n1.ExecuteOnAsyncCompute();
+        REQUIRE(renderGraph.Compile() == CompileResult::Full);
+        REQUIRE(renderGraph.GetSubmitBatches().size() == 2);
+    }
+}
+
+TEST_CASE("RenderGraph incremental compile with transient resources", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::ETextureState;
+    using CompileResult = RenderGraph::ECompileResult;
+    namespace key       = schedule_key;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+    n0.CreateTexture("A");
+
+    auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+    n1.AsGenaralSampledImage("A");
+    n1.CreateTexture("Depth", ETextureState::DepthStencilAttachmentWrite, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+    auto& n2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n2");
+    n2.AsReadDependency("Depth", VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, ETextureState::FragmentShaderReadSampledImage);
+    n2.CreateTexture("B");
+
+    auto& n3 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n3");
+    n3.AsGenaralSampledImage("B");
+    n3.CreateTexture("Out");
+    renderGraph.GetOrCreateTexture("Out").MarkAsImported();
+
+    const auto queryPlacements = [&renderGraph] {
+        std::map<std::string, std::pair<size_t, size_t>> placements;
+        const json                                       heaps = renderGraph.BuildScheduleDump()[key::AliasingHeaps];
+        for (size_t heapIdx = 0; heapIdx < heaps.size(); ++heapIdx)
+        {
+            for (const json& placement : heaps[heapIdx][key::Resources])
+            {
+                placements[placement[key::Name].get<std::string>()] = std::make_pair(heapIdx, placement[key::Offset].get<size_t>());
+            }
+        }
+        return placements;
+    };
+
+    /** Sampling depth begins new rendering scope, so lifetimes of A [0, 1] and B [2, 3] are disjoint. */
+    constexpr size_t TextureSize = 1 << 20;
+    REQUIRE(renderGraph.Compile() == CompileResult::Full);
+    renderGraph.PlanTransientResources([](std::string_view) {
+        return VkMemoryRequirements{.size = TextureSize, .alignment = 256, .memoryTypeBits = std::numeric_limits<uint32_t>::max()};
+    });
+    REQUIRE(queryPlacements()["A"] == queryPlacements()["B"]);
+    REQUIRE(renderGraph.GetTransientMemoryReport().BytesWithAliasing == 2 * TextureSize);
+
+    /** Local depth read merges n1 and n2 into a scope, which widens lifetimes of A and B to overlap. */
+    renderGraph.GetOrCreateTexture("Depth").UpdateReaderState("n2", ETextureState::DepthStencilAttachmentRead);
+    REQUIRE(renderGraph.Compile() == CompileResult::Incremental);
+    REQUIRE(renderGraph.GetOrCreateTexture("A").GetLastUse() >= renderGraph.GetOrCreateTexture("B").GetFirstUse());
+    REQUIRE(queryPlacements()["A"] != queryPlacements()["B"]);
+    REQUIRE(renderGraph.GetTransientMemoryReport().BytesWithAliasing == 3 * TextureSize);
+}
+
+TEST_CASE("RenderGraph dead node culling", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using CompileResult = RenderGraph::ECompileResult;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& gbuffer = renderGraph.EmplaceNode<RenderNode>(renderGraph, "gbuffer");
+    gbuffer.CreateTexture("GBuffer");
+
+    auto& lighting = renderGraph.EmplaceNode<RenderNode>(renderGraph, "lighting");
+    lighting.AsGenaralSampledImage("GBuffer");
+    lighting.CreateTexture("Lit");
+
+    auto& present = renderGraph.EmplaceNode<RenderNode>(renderGraph, "present");
+    present.AsGenaralSampledImage("Lit");
+    present.CreateTexture("Swapchain");
+
+    auto& debugView = renderGraph.EmplaceNode<RenderNode>(renderGraph, "debug_view");
+    debugView.AsGenaralSampledImage("GBuffer");
+    debugView.CreateTexture("DebugView");
+
+    SECTION("Graph without any output does not cull")
+    {
+        REQUIRE(renderGraph.Compile() == CompileResult::Full);
+        REQUIRE(renderGraph.GetCullingReport().CulledNodes.empty());
+        REQUIRE(renderGraph.GetSubmitBatches().front().Nodes.size() == 4);
+    }
+
+    renderGraph.GetOrCreateTexture("Swapchain").MarkAsImported();
+    REQUIRE(renderGraph.Compile() == CompileResult::Full);
+
+    SECTION("Nodes which do not reach imported resource are culled")
+    {
+        const auto& report = renderGraph.GetCullingReport();
+        REQUIRE(report.CulledNodes == std::vector<std::string>{"debug_view"});
+        REQUIRE(report.NumCulledResources == 1);
+        REQUIRE(renderGraph.IsCulled("debug_view"));
+        REQUIRE(!renderGraph.GetOrCreateTexture("DebugView").HasLifetime());
+        REQUIRE(renderGraph.GetSubmitBatches().front().Nodes == std::vector<size_t>{0, 1, 2});
+        REQUIRE(renderGraph.GetOrCreateTexture("GBuffer").GetLastUse() == 1);
+        REQUIRE(renderGraph.GetNodeStateTransitions("lighting").Textures.size() == 2);
+    }
+
+    SECTION("Exporting resource revives its writers")
+    {
+        renderGraph.GetOrCreateTexture("DebugView").MarkAsExported();
+        REQUIRE(renderGraph.Compile() == CompileResult::Full);
+        REQUIRE(renderGraph.GetCullingReport().CulledNodes.empty());
+        REQUIRE(renderGraph.GetSubmitBatches().front().Nodes.size() == 4);
+
+        /** Exported resource lives until the end of graph. */
+        const auto& debugViewTexture = renderGraph.GetOrCreateTexture("DebugView");
+        REQUIRE(debugViewTexture.GetLastUse() == 3);
+    }
+}
+
+TEST_CASE("RenderGraph render pass merging", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::ETextureState;
+    using TextureTransition = RenderGraph::ScheduledTextureStateTransition;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& depthPrepass = renderGraph.EmplaceNode<RenderNode>(renderGraph, "depth_prepass");
+    depthPrepass.CreateTexture("Depth", ETextureState::DepthStencilAttachmentWrite, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+    depthPrepass.SetClearValue("Depth", VkClearValue{.depthStencil = {1.f, 0}});
+
+    auto& gbuffer = renderGraph.EmplaceNode<RenderNode>(renderGraph, "gbuffer");
+    gbuffer.AsReadDependency("Depth", VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, ETextureState::DepthStencilAttachmentRead);
+    gbuffer.CreateTexture("Albedo");
+    gbuffer.CreateTexture("Normal");
+
+    auto& lighting = renderGraph.EmplaceNode<RenderNode>(renderGraph, "lighting");
+    lighting.AsGenaralSampledImage("Albedo");
+    lighting.AsGenaralSampledImage("Normal");
+    lighting.CreateTexture("Lit");
+    renderGraph.GetOrCreateTexture("Lit").MarkAsImported();
+
+    SECTION("Depth read after depth prepass is a local read, sampling attachment of scope begins new scope")
+    {
+        renderGraph.Compile();
+        const auto& scopes = renderGraph.GetRenderingScopes();
+        REQUIRE(scopes.size() == 2);
+        REQUIRE(scopes[0].FirstNode == 0);
+        REQUIRE(scopes[0].LastNode == 1);
+        REQUIRE(scopes[1].FirstNode == 2);
+        REQUIRE(renderGraph.QueryRenderingScope(1)->get().FirstNode == 0);
+
+        const auto& depth = *scopes[0].DepthStencilAttachment;
+        REQUIRE(depth.State == ETextureState::DepthStencilAttachmentWrite);
+        REQUIRE(depth.LoadOp == VK_ATTACHMENT_LOAD_OP_CLEAR);
+        REQUIRE(depth.StoreOp == VK_ATTACHMENT_STORE_OP_DONT_CARE);
+
+        REQUIRE(scopes[0].ColorAttachments.size() == 2);
+        REQUIRE(scopes[0].ColorAttachments[0].Resource == "Albedo");
+        REQUIRE(scopes[0].ColorAttachments[0].LoadOp == VK_ATTACHMENT_LOAD_OP_DONT_CARE);
+        REQUIRE(scopes[0].ColorAttachments[0].StoreOp == VK_ATTACHMENT_STORE_OP_STORE);
+
+        /** Imported attachment keeps contents from outside of graph. */
+        REQUIRE(scopes[1].ColorAttachments.front().LoadOp == VK_ATTACHMENT_LOAD_OP_LOAD);
+        REQUIRE(scopes[1].ColorAttachments.front().StoreOp == VK_ATTACHMENT_STORE_OP_STORE);
+
+        /** Transition of local read is deferred, others are hoisted to beginning of scope. */
+        REQUIRE(scopes[0].Textures.size() == 3);
+        REQUIRE(scopes[0].RestoreTextures == std::vector<TextureTransition>{{.Resource = "Depth", .Source = ETextureState::DepthStencilAttachmentWrite, .Destination = ETextureState::DepthStencilAttachmentRead}});
+        REQUIRE(renderGraph.GetOrCreateTexture("Albedo").GetFirstUse() == 0);
+
+        const auto& report = renderGraph.GetRenderPassMergeReport();
+        REQUIRE(report.NumRenderingNodes == 3);
+        REQUIRE(report.NumScopes == 2);
+        REQUIRE(report.NumLocalReads == 1);
+        REQUIRE(report.NumEliminatedScopes == 1);
+        REQUIRE(report.NumEliminatedLoads == 1);
+        REQUIRE(report.NumEliminatedStores == 1);
+    }
+
+    SECTION("Disabled merging begins rendering scope per node")
+    {
+        renderGraph.SetRenderPassMergingEnabled(false);
+        REQUIRE(renderGraph.Compile() == RenderGraph::ECompileResult::Full);
+        REQUIRE(renderGraph.GetRenderingScopes().size() == 3);
+        REQUIRE(renderGraph.GetRenderPassMergeReport().NumEliminatedScopes == 0);
+        REQUIRE(renderGraph.GetOrCreateTexture("Albedo").GetFirstUse() == 1);
+    }
+}
+
+TEST_CASE("RenderGraph split barriers", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::ETextureState;
+    using TextureTransition = RenderGraph::ScheduledTextureStateTransition;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+    n0.CreateTexture("A", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+    n1.CreateTexture("B", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& n2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n2");
+    n2.AsReadDependency("B", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    n2.CreateTexture("C", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& n3 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n3");
+    n3.AsReadDependency("A", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    n3.AsReadDependency("C", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    n3.CreateTexture("D", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    SECTION("Transition far from previous access is split")
+    {
+        /** Execution order: n0, n1 (level 0), n2 (level 1), n3 (level 2) */
+        renderGraph.Compile();
+        const auto& splitBarriers = renderGraph.GetSplitBarriers();
+        REQUIRE(splitBarriers.size() == 1);
+        REQUIRE(splitBarriers[0].SignalNode == 0);
+        REQUIRE(splitBarriers[0].WaitNode == 3);
+        REQUIRE(splitBarriers[0].Textures == std::vector<TextureTransition>{{.Resource = "A", .Source = ETextureState::ComputeShaderWrite, .Destination = ETextureState::ComputeShaderReadGeneral}});
+
+        /** Scheduled transitions are kept as is. */
+        REQUIRE(renderGraph.GetNodeStateTransitions("n3").Textures.size() == 3);
+
+        const auto& report = renderGraph.GetSplitBarrierReport();
+        REQUIRE(report.NumTransitions == 3);
+        REQUIRE(report.NumSplitTransitions == 1);
+        REQUIRE(report.NumEvents == 1);
+    }
+
+    SECTION("Policy decides distance to split")
+    {
+        renderGraph.SetSplitBarrierPolicy({.bIsEnabled = true, .MinNodesInBetween = 3});
+        REQUIRE(renderGraph.Compile() == RenderGraph::ECompileResult::Full);
+        REQUIRE(renderGraph.GetSplitBarriers().empty());
+
+        renderGraph.SetSplitBarrierPolicy({.bIsEnabled = false});
+        renderGraph.Compile();
+        REQUIRE(renderGraph.GetSplitBarrierReport().NumSplitTransitions == 0);
+        REQUIRE(renderGraph.GetSplitBarrierReport().NumTransitions == 3);
+    }
+}
+
+TEST_CASE("RenderGraphProfiler", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using NodeTiming = RenderGraphProfiler::NodeTiming;
+
+    RenderGraphProfiler profiler{2};
+    const auto makeFrame = [](const size_t frame, const double gbufferCpu, const double gbufferGpu) {
+        return RenderGraphProfiler::FrameTimings{
+            .Frame = frame,
+            .Begin = static_cast<double>(frame) * 16000.0,
+            .Nodes = {
+                NodeTiming{.Node = "gbuffer", .CpuBegin = 0.0, .CpuDuration = gbufferCpu, .GpuBegin = 0.0, .GpuDuration = gbufferGpu},
+                NodeTiming{.Node = "ssao", .Queue = vk::EQueueType::Compute, .ThreadId = 1, .CpuBegin = 10.0, .CpuDuration = 500.0}}};
+    };
+
+    profiler.AddFrame(makeFrame(0, 9000.0, 9000.0));
+    profiler.AddFrame(makeFrame(1, 1000.0, 2000.0));
+    profiler.AddFrame(makeFrame(2, 3000.0, 4000.0));
+
+    SECTION("Statistics only cover rolling window")
+    {
+        REQUIRE(profiler.GetNumFrames() == 2);
+        const auto gbuffer = profiler.QueryStatistics("gbuffer");
+        REQUIRE(gbuffer.has_value());
+        REQUIRE(gbuffer->NumSamples == 2);
+        REQUIRE(gbuffer->AverageCpuMs == Approx(2.0));
+        REQUIRE(gbuffer->MaxCpuMs == Approx(3.0));
+        REQUIRE(gbuffer->AverageGpuMs == Approx(3.0));
+        REQUIRE(gbuffer->MaxGpuMs == Approx(4.0));
+
+        /** Node without timestamps only has CPU samples. */
+        const auto ssao = profiler.QueryStatistics("ssao");
+        REQUIRE(ssao->NumGpuSamples == 0);
+        REQUIRE(ssao->AverageCpuMs == Approx(0.5));
+        REQUIRE(!profiler.QueryStatistics("unknown").has_value());
+
+        const auto table = profiler.BuildTable();
+        REQUIRE(table.size() == 2);
+        REQUIRE(table.front().first == "gbuffer");
+
+        /** Cost estimates prefer GPU time. */
+        const json costs = profiler.BuildCostEstimates();
+        REQUIRE(costs["gbuffer"].get<double>() == Approx(3.0));
+        REQUIRE(costs["ssao"].get<double>() == Approx(0.5));
+    }
+
+    SECTION("Chrome trace has complete events of CPU and GPU scopes")
+    {
+        const json trace  = profiler.BuildChromeTrace();
+        size_t     numCpu = 0;
+        size_t     numGpu = 0;
+        for (const json& event : trace["traceEvents"])
+        {
+            if (event["ph"] == "X")
+            {
+                numCpu += event["cat"] == "cpu" ? 1 : 0;
+                numGpu += event["cat"] == "gpu" ? 1 : 0;
+                REQUIRE(event.contains("ts"));
+                REQUIRE(event.contains("dur"));
+            }
+        }
+
+        REQUIRE(numCpu == 4);
+        REQUIRE(numGpu == 2);
+        REQUIRE(trace["traceEvents"].back()["ts"].get<double>() == Approx(2.0 * 16000.0 + 10.0));
+    }
+}
+
+TEST_CASE("RenderGraph history resources", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::ETextureState;
+    using TextureTransition = RenderGraph::ScheduledTextureStateTransition;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& scene = renderGraph.EmplaceNode<RenderNode>(renderGraph, "scene");
+    scene.CreateTexture("Scene", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& taa = renderGraph.EmplaceNode<RenderNode>(renderGraph, "taa");
+    taa.AsReadDependency("Scene", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    taa.AsHistoryReadDependency("TAAHistory", VK_IMAGE_USAGE_SAMPLED_BIT, ETextureState::ComputeShaderReadSampledImage);
+    taa.CreateTexture("TAAHistory", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    /** Only consumed by history read of 'present'. */
+    auto& accumulate = renderGraph.EmplaceNode<RenderNode>(renderGraph, "accumulate");
+    accumulate.CreateTexture("Accumulation", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& present = renderGraph.EmplaceNode<RenderNode>(renderGraph, "present");
+    present.AsReadDependency("TAAHistory", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    present.AsHistoryReadDependency("Accumulation", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    present.CreateTexture("Swapchain", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& debugView = renderGraph.EmplaceNode<RenderNode>(renderGraph, "debug_view");
+    debugView.AsReadDependency("Scene", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    debugView.CreateTexture("DebugView", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    renderGraph.GetOrCreateTexture("Swapchain").MarkAsImported();
+    REQUIRE(renderGraph.Compile() == RenderGraph::ECompileResult::Full);
+
+    SECTION("History resource is multi-buffered")
+    {
+        const auto& history = renderGraph.GetOrCreateTexture("TAAHistory");
+        REQUIRE(history.IsHistory());
+        REQUIRE(history.IsMultiBuffered());
+        REQUIRE(history.GetNumInstances() == vk::NumMaxInFlightFrames);
+        REQUIRE(history.IsHistoryReadBy("taa"));
+
+        const auto& sceneTexture = renderGraph.GetOrCreateTexture("Scene");
+        REQUIRE_FALSE(sceneTexture.IsMultiBuffered());
+        REQUIRE(sceneTexture.GetNumInstances() == 1);
+    }
+
+    SECTION("History read keeps writer alive")
+    {
+        REQUIRE(renderGraph.IsCulled("debug_view"));
+        REQUIRE_FALSE(renderGraph.IsCulled("accumulate"));
+        REQUIRE_FALSE(renderGraph.IsCulled("taa"));
+    }
+
+    SECTION("History transitions from final state of previous frame")
+    {
+        REQUIRE(renderGraph.GetNodeStateTransitions("taa").Textures == std::vector<TextureTransition>{
+                                                                          {.Resource = "Scene", .Source = ETextureState::ComputeShaderWrite, .Destination = ETextureState::ComputeShaderReadGeneral},
+                                                                          {.Resource = "TAAHistory", .Source = ETextureState::ComputeShaderReadSampledImage, .Destination = ETextureState::ComputeShaderWrite, .bIsAfterHistory = true},
+                                                                          {.Resource = "TAAHistory", .Source = ETextureState::ComputeShaderReadGeneral, .Destination = ETextureState::ComputeShaderReadSampledImage, .bIsHistory = true}});
+
+        const auto& presentTransitions = renderGraph.GetNodeStateTransitions("present").Textures;
+        REQUIRE(std::find(presentTransitions.cbegin(), presentTransitions.cend(),
+                          TextureTransition{.Resource = "Accumulation", .Source = ETextureState::ComputeShaderWrite, .Destination = ETextureState::ComputeShaderReadGeneral, .bIsHistory = true}) != presentTransitions.cend());
+
+        /** Writer of Accumulation waits on history read of previous frame in flight, which used the same instance. */
+        REQUIRE(renderGraph.GetNodeStateTransitions("accumulate").Textures == std::vector<TextureTransition>{
+                                                                                 {.Resource = "Accumulation", .Source = ETextureState::ComputeShaderReadGeneral, .Destination = ETextureState::ComputeShaderWrite, .bIsAfterHistory = true}});
+
+        for (const auto& splitBarrier : renderGraph.GetSplitBarriers())
+        {
+            REQUIRE(std::none_of(splitBarrier.Textures.cbegin(), splitBarrier.Textures.cend(), [](const TextureTransition& transition) { return transition.bIsHistory || transition.bIsAfterHistory; }));
+        }
+
+        REQUIRE(renderGraph.Compile() == RenderGraph::ECompileResult::Cached);
+    }
+
+    SECTION("History is available once previous instance has been written")
+    {
+        auto& history = renderGraph.GetOrCreateTexture("TAAHistory");
+        history.SetInFlightFrameIndex(0);
+        REQUIRE_FALSE(history.HasHistory());
+
+        history.MarkCurrentInstanceAsWritten();
+        history.SetInFlightFrameIndex(1);
+        REQUIRE(history.HasHistory());
+        REQUIRE_FALSE(renderGraph.GetOrCreateTexture("Accumulation").HasHistory());
+    }
+}
+
+TEST_CASE("RenderGraph schedule dump", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::ETextureState;
+    namespace key = schedule_key;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& n0 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n0");
+    n0.CreateTexture("A", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& n1 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n1");
+    n1.CreateTexture("B", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& n2 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n2");
+    n2.AsReadDependency("B", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    n2.CreateTexture("C", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    auto& n3 = renderGraph.EmplaceNode<RenderNode>(renderGraph, "n3");
+    n3.AsReadDependency("A", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    n3.AsReadDependency("C", VK_IMAGE_USAGE_STORAGE_BIT, ETextureState::ComputeShaderReadGeneral);
+    n3.CreateTexture("D", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+
+    renderGraph.Compile();
+    const json schedule = renderGraph.BuildScheduleDump();
+    REQUIRE(schedule[key::Version] == RenderGraphSchedule::Version);
+
+    const json& nodes = schedule[key::Nodes];
+    REQUIRE(nodes.size() == 4);
+    REQUIRE(nodes[3][key::Name] == "n3");
+    REQUIRE(nodes[3][key::Queue] == "Graphics");
+    REQUIRE(nodes[3][key::DependencyLevel] == 2);
+    REQUIRE(nodes[3][key::Textures].size() == 3);
+
+    /** Resources are ordered by creation. */
+    const json& resources = schedule[key::Resources];
+    REQUIRE(resources.size() == 4);
+    REQUIRE(resources[0][key::Name] == "A");
+    REQUIRE(resources[0][key::Writer] == "n0");
+    REQUIRE(resources[0][key::WriterState] == "ComputeShaderWrite");
+    REQUIRE(resources[0][key::Readers].size() == 1);
+    REQUIRE(resources[0][key::Readers][0][key::Node] == "n3");
+    REQUIRE(resources[0][key::Readers][0][key::State] == "ComputeShaderReadGeneral");
+
+    REQUIRE(schedule[key::Batches].size() == 1);
+    REQUIRE(schedule[key::SplitBarriers].size() == 1);
+    REQUIRE(schedule[key::SplitBarriers][0][key::SignalNode] == 0);
+    REQUIRE(schedule[key::SplitBarriers][0][key::WaitNode] == 3);
+
+    const std::string dot = RenderGraphSchedule::ToGraphviz(schedule);
+    REQUIRE(dot.find("n0 -> n3 [label=\"A\\nComputeShaderWrite -> ComputeShaderReadGeneral\"]") != std::string::npos);
+    REQUIRE(dot.find("n0 -> n3 [color=blue") != std::string::npos);
+
+    /** Single queue schedule is serial. */
+    const auto result = RenderGraphSchedule::Simulate(schedule, {{"n0", 1.0}, {"n1", 1.0}, {"n2", 1.0}, {"n3", 1.0}});
+    REQUIRE(result.has_value());
+    REQUIRE(result->TotalMs == Approx(4.0));
+    REQUIRE(result->CriticalPath == std::vector<std::string>{"n0", "n1", "n2", "n3"});
+}
+
+TEST_CASE("RenderGraphSchedule simulation", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    namespace key = schedule_key;
+
+    /** g0 -> (c0 on async compute) -> g2, while g1 overlaps with c0. */
+    const auto makeNode = [](const std::string_view name, const size_t executionIdx, const std::string_view queue) {
+        json node;
+        node[key::Name]                 = name;
+        node[key::ExecutionIndex]       = executionIdx;
+        node[key::Queue]                = queue;
+        node[key::DependencyLevel]      = 0;
+        node[key::SynchronizationIndex] = executionIdx + 1;
+        node[key::SSISNow]              = std::array<size_t, 2>{};
+        node[key::SSISNext]             = std::array<size_t, 2>{};
+        node[key::Batch]                = executionIdx;
+        return node;
+    };
+
+    const auto makeBatch = [](const std::string_view queue, const std::vector<size_t>& nodes, const std::vector<size_t>& waitBatches) {
+        json batch;
+        batch[key::Queue]       = queue;
+        batch[key::Nodes]       = nodes;
+        batch[key::WaitBatches] = waitBatches;
+        return batch;
+    };
+
+    json schedule;
+    schedule[key::Nodes]   = {makeNode("g0", 0, "Graphics"), makeNode("c0", 1, "Compute"), makeNode("g1", 2, "Graphics"), makeNode("g2", 3, "Graphics")};
+    schedule[key::Batches] = {makeBatch("Graphics", {0}, {}), makeBatch("Compute", {1}, {0}), makeBatch("Graphics", {2}, {}), makeBatch("Graphics", {3}, {1})};
+
+    const robin_hood::unordered_map<std::string, double> costs = RenderGraphSchedule::LoadNodeCosts(json{{"g0", 2.0}, {"c0", 4.0}, {"g1", 3.0}, {"unknown", "invalid"}});
+    REQUIRE(costs.size() == 3);
+
+    SECTION("Async compute overlaps with graphics queue")
+    {
+        const auto result = RenderGraphSchedule::Simulate(schedule, costs, {.DefaultNodeCostMs = 1.0});
+        REQUIRE(result.has_value());
+        REQUIRE(result->Nodes[1].StartMs == Approx(2.0));
+        REQUIRE(result->Nodes[2].StartMs == Approx(2.0));
+        REQUIRE(result->Nodes[3].StartMs == Approx(6.0));
+        REQUIRE(result->TotalMs == Approx(7.0));
+        REQUIRE(result->SerialMs == Approx(10.0));
+        REQUIRE(result->QueueBusyMs.at("Graphics") == Approx(6.0));
+        REQUIRE(result->QueueBusyMs.at("Compute") == Approx(4.0));
+        REQUIRE(result->CriticalPath == std::vector<std::string>{"g0", "c0", "g2"});
+    }
+
+    SECTION("Queue sync latency delays cross-queue waits")
+    {
+        const auto result = RenderGraphSchedule::Simulate(schedule, costs, {.DefaultNodeCostMs = 1.0, .QueueSyncLatencyMs = 0.5});
+        REQUIRE(result.has_value());
+        REQUIRE(result->TotalMs == Approx(8.0));
+    }
+
+    SECTION("Cheap async compute moves critical path to graphics queue")
+    {
+        const auto result = RenderGraphSchedule::Simulate(schedule, {{"g0", 2.0}, {"c0", 0.5}, {"g1", 3.0}}, {.DefaultNodeCostMs = 1.0});
+        REQUIRE(result.has_value());
+        REQUIRE(result->TotalMs == Approx(6.0));
+        REQUIRE(result->CriticalPath == std::vector<std::string>{"g0", "g1", "g2"});
+    }
+
+    SECTION("Circular wait is rejected")
+    {
+        schedule[key::Batches] = {makeBatch("Graphics", {0, 2, 3}, {1}), makeBatch("Compute", {1}, {0})};
+        REQUIRE_FALSE(RenderGraphSchedule::Simulate(schedule, costs).has_value());
+    }
+
+    SECTION("Graphviz")
+    {
+        const std::string dot = RenderGraphSchedule::ToGraphviz(schedule);
+        REQUIRE(dot.starts_with("digraph RenderGraph"));
+        REQUIRE(dot.find("subgraph cluster_Compute") != std::string::npos);
+        REQUIRE(dot.find("n0 -> n1 [color=red") != std::string::npos);
+        REQUIRE(dot.find("n1 -> n3 [color=red") != std::string::npos);
+    }
+}
+
+TEST_CASE("AsyncComputePlacement", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::EQueueType;
+    using Node   = AsyncComputePlacement::Node;
+    using Queues = std::vector<EQueueType>;
+
+    SECTION("Independent branch is moved to async compute")
+    {
+        const std::vector<Node> nodes{
+            {.Dependencies = {}, .CostMs = 2.0},
+            {.Dependencies = {0}, .CostMs = 2.0},
+            {.Dependencies = {}, .CostMs = 2.0, .bIsMovable = true},
+            {.Dependencies = {1, 2}, .CostMs = 1.0}};
+
+        const auto result = AsyncComputePlacement::Solve(nodes);
+        REQUIRE(result.Queues == Queues{EQueueType::Graphics, EQueueType::Graphics, EQueueType::Compute, EQueueType::Graphics});
+        REQUIRE(result.NumMovedNodes == 1);
+        REQUIRE(result.Initial.CriticalPathMs == Approx(7.0));
+        REQUIRE(result.Initial.NumSyncPoints == 0);
+        REQUIRE(result.Placed.CriticalPathMs == Approx(5.0));
+        REQUIRE(result.Placed.NumSyncPoints == 1);
+    }
+
+    SECTION("Node on critical chain stays on graphics")
+    {
+        const std::vector<Node> nodes{
+            {.Dependencies = {}, .CostMs = 2.0},
+            {.Dependencies = {0}, .CostMs = 2.0, .bIsMovable = true},
+            {.Dependencies = {1}, .CostMs = 2.0}};
+
+        const auto result = AsyncComputePlacement::Solve(nodes);
+        REQUIRE(result.NumMovedNodes == 0);
+        REQUIRE(result.Placed.CriticalPathMs == Approx(6.0));
+    }
+
+    SECTION("Sync cost outweighs overlap")
+    {
+        const std::vector<Node> nodes{
+            {.Dependencies = {}, .CostMs = 2.0},
+            {.Dependencies = {0}, .CostMs = 2.0},
+            {.Dependencies = {}, .CostMs = 0.1, .bIsMovable = true},
+            {.Dependencies = {1, 2}, .CostMs = 1.0}};
+
+        REQUIRE(AsyncComputePlacement::Solve(nodes, {.SyncCostMs = 5.0}).NumMovedNodes == 0);
+        REQUIRE(AsyncComputePlacement::Solve(nodes, {.SyncCostMs = 0.05}).NumMovedNodes == 1);
+    }
+
+    SECTION("Ties are broken by execution order")
+    {
+        /** Moving either of branches gives the same critical path, and moving both makes graphics wait longer. */
+        const std::vector<Node> nodes{
+            {.Dependencies = {}, .CostMs = 1.0},
+            {.Dependencies = {}, .CostMs = 1.0, .bIsMovable = true},
+            {.Dependencies = {}, .CostMs = 1.0, .bIsMovable = true},
+            {.Dependencies = {0, 1, 2}, .CostMs = 1.0}};
+
+        const auto result = AsyncComputePlacement::Solve(nodes);
+        REQUIRE(result.Queues == Queues{EQueueType::Graphics, EQueueType::Compute, EQueueType::Graphics, EQueueType::Graphics});
+        REQUIRE(result.Placed.CriticalPathMs == Approx(3.0));
+        REQUIRE(AsyncComputePlacement::Solve(nodes).Queues == result.Queues);
+    }
+
+    SECTION("Queue waits once on already synchronized queue")
+    {
+        const std::vector<Node> nodes{
+            {.Dependencies = {}, .CostMs = 1.0},
+            {.Dependencies = {}, .CostMs = 1.0},
+            {.Dependencies = {0, 1}, .CostMs = 1.0},
+            {.Dependencies = {1}, .CostMs = 1.0}};
+        const Queues queues{EQueueType::Compute, EQueueType::Compute, EQueueType::Graphics, EQueueType::Graphics};
+
+        const auto estimate = AsyncComputePlacement::Evaluate(nodes, queues, {.SyncCostMs = 0.5});
+        REQUIRE(estimate.NumSyncPoints == 1);
+        REQUIRE(estimate.CriticalPathMs == Approx(4.5));
+    }
+}
+
+TEST_CASE("RenderGraph async compute placement", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using vk::ETextureState;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+
+    auto& gbuffer = renderGraph.EmplaceNode<RenderNode>(renderGraph, "gbuffer");
+    gbuffer.CreateTexture("GBuffer");
+
+    auto& ao = renderGraph.EmplaceNode<RenderNode>(renderGraph, "ao");
+    ao.CreateTexture("AO", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+    ao.AllowAsyncCompute();
+
+    auto& taa = renderGraph.EmplaceNode<RenderNode>(renderGraph, "taa");
+    taa.AsHistoryReadDependency("TAAHistory", VK_IMAGE_USAGE_SAMPLED_BIT, ETextureState::ComputeShaderReadSampledImage);
+    taa.CreateTexture("TAAHistory", ETextureState::ComputeShaderWrite, VK_IMAGE_USAGE_STORAGE_BIT);
+    taa.AllowAsyncCompute();
+
+    auto& lighting = renderGraph.EmplaceNode<RenderNode>(renderGraph, "lighting");
+    lighting.AsGenaralSampledImage("GBuffer");
+    lighting.AsGenaralSampledImage("AO");
+    lighting.AsGenaralSampledImage("TAAHistory");
+    lighting.CreateTexture("Lit");
+
+    REQUIRE(renderGraph.Compile() == RenderGraph::ECompileResult::Full);
+
+    const robin_hood::unordered_map<std::string, double> nodeCosts{{"gbuffer", 2.0}, {"ao", 2.0}, {"taa", 2.0}, {"lighting", 1.0}};
+    REQUIRE(renderGraph.PlaceAsyncCompute(nodeCosts));
+    REQUIRE(ao.IsExecuteOnAsyncCompute());
+    /** History resource does not move between queues. */
+    REQUIRE_FALSE(taa.IsExecuteOnAsyncCompute());
+    REQUIRE(renderGraph.GetAsyncComputePlacement().NumMovedNodes == 1);
+    REQUIRE(renderGraph.GetAsyncComputePlacement().Placed.CriticalPathMs < renderGraph.GetAsyncComputePlacement().Initial.CriticalPathMs);
+
+    REQUIRE(renderGraph.Compile() == RenderGraph::ECompileResult::Full);
+    REQUIRE(renderGraph.GetSubmitBatches().size() > 1);
+
+    /** Placement is already optimal for the same costs. */
+    REQUIRE_FALSE(renderGraph.PlaceAsyncCompute(nodeCosts));
+    REQUIRE(renderGraph.Compile() == RenderGraph::ECompileResult::Cached);
+}
+
+TEST_CASE("DescriptorSlotAllocator", "[descriptor_allocator]")
+{
+    using namespace sy;
+    using namespace sy::vk;
+
+    DescriptorSlotAllocator allocator{4, 16};
+    REQUIRE(allocator.GetStatistics().Capacity == 4);
+    REQUIRE(allocator.GetStatistics().NumGrows == 0);
+
+    SECTION("Lowest free slot first")
+    {
+        for (uint32_t expected = 0; expected < 4; ++expected)
+        {
+            REQUIRE(allocator.Allocate() == expected);
+        }
+        REQUIRE(allocator.GetOccupancy() == Approx(1.0));
+    }
+
+    SECTION("Freed slot is recycled after every in-flight frames which could use it")
+    {
+        const auto slot0 = allocator.Allocate();
+        const auto slot1 = allocator.Allocate();
+        REQUIRE((slot0 == 0u && slot1 == 1u));
+
+        allocator.Free(*slot0, 0);
+        REQUIRE(allocator.IsAllocated(*slot0));
+        REQUIRE(allocator.GetStatistics().NumPendingFrees == 1);
+
+        /** Slot freed before BeginFrame of the same frame may still be used by previous in-flight frame. */
+        allocator.BeginFrame(0);
+        REQUIRE(allocator.IsAllocated(*slot0));
+        allocator.BeginFrame(1);
+        REQUIRE(allocator.Allocate() == 2u);
+
+        allocator.BeginFrame(NumMaxInFlightFrames);
+        REQUIRE_FALSE(allocator.IsAllocated(*slot0));
+        REQUIRE(allocator.GetStatistics().NumPendingFrees == 0);
+        REQUIRE(allocator.GetStatistics().NumAllocated == 2);
+        REQUIRE(allocator.GetStatistics().HighWaterMark == 3);
+        REQUIRE(allocator.Allocate() == *slot0);
+    }
+
+    SECTION("Capacity grows up to max capacity")
+    {
+        for (size_t idx = 0; idx < 16; ++idx)
+        {
+            REQUIRE(allocator.Allocate().has_value());
+        }
+
+        const auto& statistics = allocator.GetStatistics();
+        REQUIRE(statistics.Capacity == 16);
+        REQUIRE(statistics.NumGrows == 2);
+        REQUIRE(statistics.HighWaterMark == 16);
+
+        REQUIRE_FALSE(allocator.Allocate().has_value());
+        REQUIRE(statistics.NumFailedAllocations == 1);
+
+        allocator.Free(5, 1);
+        allocator.BeginFrame(NumMaxInFlightFrames);
+        REQUIRE(allocator.IsAllocated(5));
+        allocator.BeginFrame(1 + NumMaxInFlightFrames);
+        REQUIRE(allocator.Allocate() == 5u);
+    }
+}
+
+TEST_CASE("DescriptorAllocator binding capacities", "[descriptor_allocator]")
+{
+    using namespace sy;
+    using namespace sy::vk;
+
+    VkPhysicalDeviceDescriptorIndexingProperties properties{};
+    properties.maxPerStageUpdateAfterBindResources                = 1000000;
+    properties.maxDescriptorSetUpdateAfterBindSampledImages       = 8000;
+    properties.maxPerStageDescriptorUpdateAfterBindSampledImages  = 6000;
+    properties.maxDescriptorSetUpdateAfterBindSamplers            = 1000;
+    properties.maxPerStageDescriptorUpdateAfterBindSamplers       = 1000;
+    properties.maxDescriptorSetUpdateAfterBindStorageImages       = 4000;
+    properties.maxPerStageDescriptorUpdateAfterBindStorageImages  = 5000;
+    properties.maxDescriptorSetUpdateAfterBindUniformBuffers      = 100;
+    properties.maxPerStageDescriptorUpdateAfterBindUniformBuffers = 100;
+    properties.maxDescriptorSetUpdateAfterBindStorageBuffers      = 500000;
+    properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers = 500000;
+
+    const auto capacityOf = [](const DescriptorAllocator::BindingCapacities& capacities, const EDescriptorType type) {
+        return capacities[ToUnderlying(type)];
+    };
+
+    SECTION("Limits of each descriptor type")
+    {
+        const auto capacities = DescriptorAllocator::CalculateBindingCapacities(properties);
+        /** Sampled image limit is shared with combined image sampler. */
+        REQUIRE(capacityOf(capacities, EDescriptorType::SampledImage) == 3000);
+        REQUIRE(capacityOf(capacities, EDescriptorType::CombinedImageSampler) == 1000);
+        REQUIRE(capacityOf(capacities, EDescriptorType::StorageImage) == 4000);
+        REQUIRE(capacityOf(capacities, EDescriptorType::UniformBuffer) == 100);
+        REQUIRE(capacityOf(capacities, EDescriptorType::StorageBuffer) == MaxBindlessDescriptorsPerBinding);
+        REQUIRE(capacityOf(capacities, EDescriptorType::UniformBufferDynamic) == 0);
+    }
+
+    SECTION("Per stage resource limit is shared by every bindings")
+    {
+        properties.maxPerStageUpdateAfterBindResources = 10000;
+        const auto capacities                          = DescriptorAllocator::CalculateBindingCapacities(properties);
+        REQUIRE(capacityOf(capacities, EDescriptorType::SampledImage) == 2000);
+        REQUIRE(capacityOf(capacities, EDescriptorType::StorageImage) == 2000);
+        REQUIRE(capacityOf(capacities, EDescriptorType::UniformBuffer) == 100);
+        REQUIRE(capacityOf(capacities, EDescriptorType::StorageBuffer) == 2000);
+    }
+}
+
+TEST_CASE("DescriptorAllocator descriptor buffer fallback", "[descriptor_allocator]")
+{
+    using namespace sy;
+    using namespace sy::vk;
+
+    VkPhysicalDeviceLimits limits{};
+    limits.maxPerStageResources                = 10000000;
+    limits.maxDescriptorSetSampledImages       = 1000000;
+    limits.maxPerStageDescriptorSampledImages  = 1000000;
+    limits.maxDescriptorSetSamplers            = 1000000;
+    limits.maxPerStageDescriptorSamplers       = 1000000;
+    limits.maxDescriptorSetStorageImages       = 1000000;
+    limits.maxPerStageDescriptorStorageImages  = 1000000;
+    limits.maxDescriptorSetUniformBuffers      = 1000000;
+    limits.maxPerStageDescriptorUniformBuffers = 1000000;
+    limits.maxDescriptorSetStorageBuffers      = 1000000;
+    limits.maxPerStageDescriptorStorageBuffers = 1000000;
+
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT properties{};
+    properties.combinedImageSamplerDescriptorSingleArray = VK_TRUE;
+    properties.sampledImageDescriptorSize                = 32;
+    properties.combinedImageSamplerDescriptorSize        = 48;
+    properties.storageImageDescriptorSize                = 32;
+    properties.uniformBufferDescriptorSize               = 16;
+    properties.storageBufferDescriptorSize               = 16;
+    properties.maxResourceDescriptorBufferRange          = 1 << 27;
+    properties.maxSamplerDescriptorBufferRange           = 1 << 27;
+
+    SECTION("Descriptor buffer is used when device limits are enough")
+    {
+        const auto capacities = DescriptorAllocator::CalculateDescriptorBufferCapacities(limits);
+        for (const EDescriptorType descriptorType : DescriptorAllocator::BindlessDescriptorTypes)
+        {
+            REQUIRE(capacities[ToUnderlying(descriptorType)] == MaxBindlessDescriptorsPerBinding);
+        }
+        REQUIRE(DescriptorAllocator::IsDescriptorBufferUsable(properties, capacities));
+    }
+
+    SECTION("Falls back when per stage limits are too small for bindless")
+    {
+        limits.maxPerStageDescriptorSampledImages = 16;
+        const auto capacities                     = DescriptorAllocator::CalculateDescriptorBufferCapacities(limits);
+        REQUIRE(capacities[ToUnderlying(EDescriptorType::SampledImage)] == 8);
+        REQUIRE_FALSE(DescriptorAllocator::IsDescriptorBufferUsable(properties, capacities));
+    }
+
+    SECTION("Falls back when descriptors do not fit in descriptor buffer range")
+    {
+        properties.maxResourceDescriptorBufferRange = 1 << 20;
+        REQUIRE_FALSE(DescriptorAllocator::IsDescriptorBufferUsable(properties, DescriptorAllocator::CalculateDescriptorBufferCapacities(limits)));
+    }
+
+    SECTION("Falls back when combined image samplers are stored as split arrays")
+    {
+        properties.combinedImageSamplerDescriptorSingleArray = VK_FALSE;
+        REQUIRE_FALSE(DescriptorAllocator::IsDescriptorBufferUsable(properties, DescriptorAllocator::CalculateDescriptorBufferCapacities(limits)));
+    }
+}
+
+TEST_CASE("DescriptorWriteQueue stress", "[descriptor_allocator]")
+{
+    using namespace sy;
+    using namespace sy::vk;
+
+    constexpr size_t   NumProducers       = 16;
+    constexpr uint32_t NumSlotsPerThread  = 512;
+    constexpr uint32_t SharedSlot         = NumProducers * NumSlotsPerThread;
+    constexpr size_t   NumWritesPerThread = NumSlotsPerThread * 2 + 1;
+    constexpr size_t   NumFlushes         = 64;
+
+    /** Buffer range carries the pass which wrote the slot, and offset carries the producer. */
+    const auto makeInfo = [](const size_t producer, const size_t pass) {
+        return VkDescriptorBufferInfo{.buffer = VK_NULL_HANDLE, .offset = producer, .range = pass};
+    };
+
+    DescriptorWriteQueue                                            writeQueue;
+    DescriptorWriteQueue::Batch                                     batch;
+    std::map<std::pair<uint32_t, uint32_t>, VkDescriptorBufferInfo> appliedWrites;
+    size_t                                                          numAppliedWrites = 0;
+
+    const auto flush = [&]() {
+        writeQueue.Flush(VK_NULL_HANDLE, batch);
+        for (size_t idx = 0; idx < batch.Writes.size(); ++idx)
+        {
+            const VkWriteDescriptorSet& write = batch.Writes[idx];
+            REQUIRE(write.pBufferInfo != nullptr);
+            REQUIRE(write.pImageInfo == nullptr);
+            /** Writes are sorted by slot, so each slot appears once per flush. */
+            if (idx > 0)
+            {
+                const VkWriteDescriptorSet& prevWrite = batch.Writes[idx - 1];
+                REQUIRE(std::tie(prevWrite.dstBinding, prevWrite.dstArrayElement) < std::tie(write.dstBinding, write.dstArrayElement));
+            }
+            appliedWrites[{write.dstBinding, write.dstArrayElement}] = *write.pBufferInfo;
+        }
+        numAppliedWrites += batch.Writes.size();
+    };
+
+    std::atomic<size_t> numFinishedProducers = 0;
+    {
+        std::vector<std::jthread> producers;
+        for (size_t producer = 0; producer < NumProducers; ++producer)
+        {
+            producers.emplace_back([&writeQueue, &numFinishedProducers, &makeInfo, producer]() {
+                const auto firstSlot = static_cast<uint32_t>(producer * NumSlotsPerThread);
+                for (size_t pass = 0; pass < 2; ++pass)
+                {
+                    for (uint32_t slot = firstSlot; slot < firstSlot + NumSlotsPerThread; ++slot)
+                    {
+                        writeQueue.Enqueue(EDescriptorType::StorageBuffer, slot, makeInfo(producer, pass));
+                    }
+                }
+
+                writeQueue.Enqueue(EDescriptorType::UniformBuffer, SharedSlot, makeInfo(producer, 0));
+                ++numFinishedProducers;
+            });
+        }
+
+        /** Flushes while producers are still enqueueing, as BeginFrame does while streaming threads run. */
+        for (size_t flushIdx = 0; flushIdx < NumFlushes && numFinishedProducers.load() < NumProducers; ++flushIdx)
+        {
+            flush();
+        }
+    }
+    flush();
+
+    const auto statistics = writeQueue.GetStatistics();
+    REQUIRE(statistics.NumThreadQueues == NumProducers);
+    REQUIRE(statistics.NumEnqueued == NumProducers * NumWritesPerThread);
+    REQUIRE(statistics.NumFlushed == numAppliedWrites);
+    REQUIRE(statistics.NumFlushed + statistics.NumDeduplicated == statistics.NumEnqueued);
+    REQUIRE(statistics.NumContendedEnqueues <= statistics.NumEnqueued);
+
+    /** Second pass of each producer is enqueued later, so it must win over the first pass. */
+    REQUIRE(appliedWrites.size() == NumProducers * NumSlotsPerThread + 1);
+    for (size_t producer = 0; producer < NumProducers; ++producer)
+    {
+        for (uint32_t slot = 0; slot < NumSlotsPerThread; ++slot)
+        {
+            const auto& info = appliedWrites[{ToUnderlying(EDescriptorType::StorageBuffer), static_cast<uint32_t>(producer * NumSlotsPerThread) + slot}];
+            REQUIRE(info.offset == producer);
+            REQUIRE(info.range == 1);
+        }
+    }
+    REQUIRE(appliedWrites.contains({ToUnderlying(EDescriptorType::UniformBuffer), SharedSlot}));
+
+    SECTION("Writes to the same slot in single flush are deduplicated")
+    {
+        writeQueue.Enqueue(EDescriptorType::SampledImage, 7, VkDescriptorImageInfo{.sampler = VK_NULL_HANDLE, .imageView = VK_NULL_HANDLE, .imageLayout = VK_IMAGE_LAYOUT_GENERAL});
+        writeQueue.Enqueue(EDescriptorType::SampledImage, 7, VkDescriptorImageInfo{.sampler = VK_NULL_HANDLE, .imageView = VK_NULL_HANDLE, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL});
+        writeQueue.Enqueue(EDescriptorType::StorageBuffer, 7, makeInfo(0, 2));
+        writeQueue.Flush(VK_NULL_HANDLE, batch);
+
+        REQUIRE(batch.Writes.size() == 2);
+        REQUIRE(batch.Writes[0].dstBinding == ToUnderlying(EDescriptorType::SampledImage));
+        REQUIRE(batch.Writes[0].pImageInfo->imageLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        REQUIRE(batch.Writes[1].pBufferInfo->range == 2);
+        REQUIRE(writeQueue.GetStatistics().NumDeduplicated == statistics.NumDeduplicated + 1);
+    }
+}
+
+TEST_CASE("BufferBuilder persistent mapping", "[buffer]")
+{
+    using namespace sy;
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+
+    /** Host visible templates are mapped once at creation, instead of map/unmap at every access. */
+    REQUIRE(vk::BufferBuilder::StagingBufferTemplate(vulkanContext).IsValidToBuild());
+    REQUIRE(vk::BufferBuilder::UniformBufferTemplate(vulkanContext).IsValidToBuild());
+    REQUIRE(vk::BufferBuilder::StorageBufferTemplate(vulkanContext).IsValidToBuild());
+    REQUIRE(vk::BufferBuilder::VertexBufferTemplate(vulkanContext).SetPersistentlyMapped(false).IsValidToBuild());
+
+    /** Aliased buffer has no allocation of its own to be mapped. */
+    const auto aliased = vk::BufferBuilder::StagingBufferTemplate(vulkanContext)
+                             .SetAliasingMemory(reinterpret_cast<VmaAllocation>(uintptr_t{1}), 0);
+    REQUIRE_FALSE(aliased.IsValidToBuild());
+    REQUIRE(vk::BufferBuilder{aliased}.SetPersistentlyMapped(false).IsValidToBuild());
+}
+
+TEST_CASE("RenderPass draw splitting", "[render_pass]")
+{
+    using namespace sy;
+    using namespace sy::render;
+
+    REQUIRE(RenderPass::SplitDraws(0, 8).empty());
+
+    /** Small draw lists are not worth secondary command buffers, so they are recorded into the primary directly. */
+    const auto smallDraws = RenderPass::SplitDraws(300, 8);
+    REQUIRE(smallDraws.size() == 1);
+    REQUIRE(smallDraws[0].Offset == 0);
+    REQUIRE(smallDraws[0].Size == 300);
+    REQUIRE(RenderPass::SplitDraws(50000, 1).size() == 1);
+
+    const auto mediumDraws = RenderPass::SplitDraws(1000, 8);
+    REQUIRE(mediumDraws.size() == 3);
+
+    constexpr size_t NumDraws  = 50001;
+    const auto       ranges    = RenderPass::SplitDraws(NumDraws, 8);
+    size_t           nextBegin = 0;
+    REQUIRE(ranges.size() == 8);
+    for (const auto& range : ranges)
+    {
+        REQUIRE(range.Offset == nextBegin);
+        REQUIRE(range.Size > 0);
+        nextBegin += range.Size;
+    }
+    REQUIRE(nextBegin == NumDraws);
+}
+
+TEST_CASE("RenderGraph recording chunks", "[render_graph]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    namespace key = schedule_key;
+    constexpr size_t NumNodes      = 40;
+    constexpr size_t NodesPerLevel = 10;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+    for (size_t idx = 0; idx < NumNodes; ++idx)
+    {
+        auto& node = renderGraph.EmplaceNode<RenderNode>(renderGraph, std::format("n{}", idx));
+        if (idx >= NodesPerLevel)
+        {
+            node.AsGenaralSampledImage(std::format("T{}", idx - NodesPerLevel));
+        }
+        node.CreateTexture(std::format("T{}", idx));
+    }
+    renderGraph.Compile();
+
+    const json  schedule = renderGraph.BuildScheduleDump();
+    const auto& batches  = renderGraph.GetSubmitBatches();
+    for (const size_t numThreads : {1, 3, 8})
+    {
+        const auto chunks = renderGraph.SplitRecordingChunks(numThreads);
+        REQUIRE(chunks.size() <= numThreads);
+
+        size_t nextBegin = 0;
+        for (const auto& chunk : chunks)
+        {
+            REQUIRE(chunk.Batch == 0);
+            REQUIRE(chunk.Begin == nextBegin);
+            REQUIRE(chunk.Begin < chunk.End);
+            nextBegin = chunk.End;
+
+            /** Rendering scope never spans multiple command buffers. */
+            if (chunk.Begin > 0)
+            {
+                const json& scope         = schedule[key::Nodes][batches[0].Nodes[chunk.Begin]][key::RenderingScope];
+                const json& previousScope = schedule[key::Nodes][batches[0].Nodes[chunk.Begin - 1]][key::RenderingScope];
+                REQUIRE((scope.is_null() || scope != previousScope));
+            }
+        }
+        REQUIRE(nextBegin == NumNodes);
+    }
+}
+
+TEST_CASE("RenderGraph compile benchmark", "[.][benchmark][render_graph_compile]")
+{
+    using namespace sy;
+    using namespace sy::render;
+    using CompileResult = RenderGraph::ECompileResult;
+    constexpr size_t NumNodes      = 1000;
+    constexpr size_t NodesPerLevel = 10;
+    constexpr size_t NumFanIn      = 3;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    RenderGraph       renderGraph{vulkanContext};
+    for (size_t idx = 0; idx < NumNodes; ++idx)
+    {
+        auto& node = renderGraph.EmplaceNode<RenderNode>(renderGraph, std::format("n{}", idx));
+        for (size_t fanIn = 1; fanIn <= NumFanIn && idx >= fanIn * NodesPerLevel; ++fanIn)
+        {
+            node.AsGenaralSampledImage(std::format("T{}", idx - fanIn * NodesPerLevel));
+        }
+        node.CreateTexture(std::format("T{}", idx));
+        if (idx % 4 == 3)
+        {
+            node.ExecuteOnAsyncCompute();
+        }
+    }
+
+    const auto measure = [&renderGraph](const CompileResult expected) {
+        const auto begin  = std::chrono::high_resolution_clock::now();
+        const auto result = renderGraph.Compile();
+        REQUIRE(result == expected);
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+    };
+
+    spdlog::info("[RenderGraph Compile] {} nodes, full: {:.3f} ms", NumNodes, measure(CompileResult::Full));
+    spdlog::info("[RenderGraph Compile] {} nodes, cached: {:.3f} ms", NumNodes, measure(CompileResult::Cached));
+
+    renderGraph.GetOrCreateTexture("T0").UpdateReaderState(std::format("n{}", NodesPerLevel), vk::ETextureState::FragmentShaderReadSampledImage);
+    spdlog::info("[RenderGraph Compile] {} nodes, incremental: {:.3f} ms", NumNodes, measure(CompileResult::Incremental));
+}
+
+TEST_CASE("RenderGraph parallel recording benchmark", "[.][benchmark][render_graph_recording]")
+{
+    /** Chunk partitioning and per-chunk node recording of RenderGraph::Execute; state transitions and submission need vulkan device, so they are not measured. */
+    using namespace sy;
+    using namespace sy::render;
+    namespace key                      = schedule_key;
+    constexpr size_t NumNodes          = 200;
+    constexpr size_t NodesPerLevel     = 20;
+    constexpr size_t NumMeasuredFrames = 50;
+
+    const auto                        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext                 vulkanContext{*window};
+    RenderGraph                       renderGraph{vulkanContext};
+    std::vector<SyntheticRecordNode*> syntheticNodes;
+    for (size_t idx = 0; idx < NumNodes; ++idx)
+    {
+        auto& node = renderGraph.EmplaceNode<SyntheticRecordNode>(renderGraph, std::format("n{}", idx));
+        if (idx >= NodesPerLevel)
+        {
+            node.AsGenaralSampledImage(std::format("T{}", idx - NodesPerLevel));
+        }
+        node.CreateTexture(std::format("T{}", idx));
+        syntheticNodes.emplace_back(static_cast<SyntheticRecordNode*>(&node));
+    }
+    renderGraph.Compile();
+
+    const auto& batches = renderGraph.GetSubmitBatches();
+    REQUIRE(batches.size() == 1);
+    REQUIRE(batches[0].Nodes.size() == NumNodes);
+
+    /** Nodes are declared level by level, so execution index of node is equal to its ID. */
+    const json schedule = renderGraph.BuildScheduleDump();
+    for (size_t idx = 0; idx < NumNodes; ++idx)
+    {
+        REQUIRE(schedule[key::Nodes][idx][key::Name] == std::format("n{}", idx));
+    }
+
+    size_t numHandles = 0;
+    for (const size_t numThreads : {1, 4, 8})
+    {
+        ThreadPool pool{numThreads - 1};
+
+        /** Commands are not encoded into command buffer, so fake handles stand in for vkAllocateCommandBuffers. */
+        std::vector<std::unique_ptr<vk::CommandBuffer>> cmdBuffers;
+        for (size_t chunkIdx = 0; chunkIdx < renderGraph.SplitRecordingChunks(numThreads).size(); ++chunkIdx)
+        {
+            cmdBuffers.emplace_back(std::make_unique<vk::CommandBuffer>("Command Buffer", vulkanContext, vk::EQueueType::Graphics, reinterpret_cast<VkCommandBuffer>(++numHandles)));
+        }
+
+        size_t numChunks = 0;
+        double totalMs   = 0.0;
+        for (size_t frame = 0; frame < NumMeasuredFrames; ++frame)
+        {
+            const auto begin  = std::chrono::high_resolution_clock::now();
+            const auto chunks = renderGraph.SplitRecordingChunks(numThreads);
+            pool.ParallelFor(chunks.size(), [&](const size_t chunkIdx) {
+                const auto& chunk = chunks[chunkIdx];
+                for (size_t idx = chunk.Begin; idx < chunk.End; ++idx)
+                {
+                    syntheticNodes[batches[chunk.Batch].Nodes[idx]]->Record(*cmdBuffers[chunkIdx]);
+                }
+            });
+            totalMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+            numChunks = chunks.size();
+        }
+
+        size_t numCommands = 0;
+        for (const SyntheticRecordNode* node : syntheticNodes)
+        {
+            numCommands += node->GetNumRecordedCommands();
+        }
+        REQUIRE(numCommands == NumNodes * SyntheticRecordNode::CommandsPerNode);
+        spdlog::info("[RenderGraph Recording] {} nodes, {} threads, {} chunks: {:.3f} ms/frame", NumNodes, numThreads, numChunks, totalMs / NumMeasuredFrames);
+    }
+}
+
+TEST_CASE("Command buffer recycling benchmark", "[.][benchmark][command_buffer_recycling]")
+{
+    /** Bookkeeping cost of CommandPool::RequestCommandBuffer only; fake handles stand in for vkAllocateCommandBuffers. */
+    using namespace sy;
+    constexpr size_t NumCmdBuffersPerFrame = 1000;
+    constexpr size_t NumFrames             = 100;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    size_t            numHandles    = 0;
+    const auto        allocateChunk = [&vulkanContext, &numHandles](const size_t count, std::vector<std::unique_ptr<vk::CommandBuffer>>& chunk) {
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            chunk.emplace_back(std::make_unique<vk::CommandBuffer>("Command Buffer", vulkanContext, vk::EQueueType::Graphics, reinterpret_cast<VkCommandBuffer>(++numHandles)));
+        }
+    };
+
+    const auto measure = [](auto&& frame) {
+        const auto begin = std::chrono::high_resolution_clock::now();
+        for (size_t frameIdx = 0; frameIdx < NumFrames; ++frameIdx)
+        {
+            frame();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count() / NumFrames;
+    };
+
+    /** Previous scheme: slot from offset pool, and std::function deleter which returns the slot at the next frame. */
+    struct Deallocation
+    {
+        const OffsetPool::Slot_t slot;
+    };
+    using LegacyCommandBuffer = std::unique_ptr<vk::CommandBuffer, std::function<void(vk::CommandBuffer*)>>;
+    OffsetPool                                      offsetPool{1, 16};
+    std::vector<std::unique_ptr<vk::CommandBuffer>> legacyCmdBuffers;
+    std::vector<Deallocation>                       pendingDeallocations;
+    const double                                    legacyElapsed = measure([&]() {
+        for (const Deallocation& deallocation : pendingDeallocations)
+        {
+            offsetPool.Deallocate(deallocation.slot);
+        }
+        pendingDeallocations.clear();
+
+        for (size_t idx = 0; idx < NumCmdBuffersPerFrame; ++idx)
+        {
+            const auto         slot = offsetPool.Allocate();
+            const Deallocation deallocation{.slot = slot};
+            if (slot.Offset >= legacyCmdBuffers.size())
+            {
+                allocateChunk(1, legacyCmdBuffers);
+            }
+
+            legacyCmdBuffers[slot.Offset]->SetName("Command Buffer");
+            LegacyCommandBuffer cmdBuffer{legacyCmdBuffers[slot.Offset].get(), [&pendingDeallocations, deallocation](vk::CommandBuffer*) {
+                                              pendingDeallocations.emplace_back(deallocation);
+                                          }};
+        }
+    });
+
+    LinearRecycler<vk::CommandBuffer> cmdBuffers{8};
+    size_t                            numHandedOut    = 0;
+    const double                      recyclerElapsed = measure([&]() {
+        cmdBuffers.Reset();
+        for (size_t idx = 0; idx < NumCmdBuffersPerFrame; ++idx)
+        {
+            vk::CommandBuffer& cmdBuffer = cmdBuffers.Request(allocateChunk);
+            cmdBuffer.SetName("Command Buffer");
+            const vk::ManagedCommandBuffer handle{cmdBuffer};
+            numHandedOut += handle ? 1 : 0;
+        }
+    });
+
+    REQUIRE(numHandedOut == NumCmdBuffersPerFrame * NumFrames);
+    REQUIRE(cmdBuffers.GetNumAllocated() >= NumCmdBuffersPerFrame);
+    spdlog::info("[Command Buffer Recycling] {} requests per frame, offset pool + std::function deleter: {:.4f} ms", NumCmdBuffersPerFrame, legacyElapsed);
+    spdlog::info("[Command Buffer Recycling] {} requests per frame, linear recycler ({} chunks): {:.4f} ms", NumCmdBuffersPerFrame, cmdBuffers.GetNumChunks(), recyclerElapsed);
+}
+
+TEST_CASE("RenderPass parallel recording benchmark", "[.][benchmark][render_pass_recording]")
+{
+    /**
+     * RenderPass::RenderDraws without command buffer allocation and vkCmdExecuteCommands:
+     * draws are split by SplitDraws, then each range is recorded through RecordDrawRange on recording threads.
+     */
+    using namespace sy;
+    using namespace sy::render;
+    constexpr size_t NumDraws          = 50000;
+    constexpr size_t NumMeasuredFrames = 50;
+
+    const auto        window = window::WindowBuilder{}.Build();
+    vk::VulkanContext vulkanContext{*window};
+    for (const size_t numThreads : {1, 2, 4, 8})
+    {
+        ThreadPool        pool{numThreads - 1};
+        SyntheticDrawPass renderPass{"Synthetic Draw Pass", vulkanContext, NumDraws};
+        renderPass.SetRecordingThreadPool(&pool);
+
+        const auto ranges = RenderPass::SplitDraws(NumDraws, renderPass.GetNumRecordingThreads());
+        std::vector<std::unique_ptr<vk::CommandBuffer>> cmdBuffers;
+        for (size_t rangeIdx = 0; rangeIdx < ranges.size(); ++rangeIdx)
+        {
+            cmdBuffers.emplace_back(std::make_unique<vk::CommandBuffer>("Command Buffer", vulkanContext, vk::EQueueType::Graphics, reinterpret_cast<VkCommandBuffer>(rangeIdx + 1)));
+        }
+        renderPass.ResetCommandStreams(ranges.size());
+
+        double totalMs = 0.0;
+        for (size_t frame = 0; frame < NumMeasuredFrames; ++frame)
+        {
+            const auto begin = std::chrono::high_resolution_clock::now();
+            pool.ParallelFor(ranges.size(), [&](const size_t rangeIdx) {
+                renderPass.RecordDrawRange(*cmdBuffers[rangeIdx], ranges[rangeIdx]);
+            });
+            totalMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+        }
+
+        /** Pipeline bind of each command buffer, and 4 commands of each draw. */
+        REQUIRE(renderPass.GetNumRecordedCommands() == ranges.size() + NumDraws * 4);
+        spdlog::info("[RenderPass Recording] {} draws, {} threads, {} command buffers: {:.3f} ms/frame", NumDraws, numThreads, ranges.size(), totalMs / NumMeasuredFrames);
+    }
+}
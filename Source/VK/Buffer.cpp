@@ -35,30 +35,45 @@ size_t CalculateAlignedBufferSize(VulkanContext& vulkanContext,
 Buffer::Buffer(const BufferBuilder& builder) :
     VulkanWrapper(builder.name, builder.vulkanContext, VK_OBJECT_TYPE_BUFFER), alignedSize(CalculateAlignedBufferSize(builder.vulkanContext, builder.size, *builder.usage)), usage(*builder.usage | (builder.dataToTransfer.has_value() ? VK_BUFFER_USAGE_TRANSFER_DST_BIT : 0)), memoryUsage(*builder.memoryUsage), initialState(builder.targetInitialState)
 {
-    const VkBufferCreateInfo createInfo{
-        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-        .size = this->alignedSize,
-        .usage = this->usage,
-        .sharingMode = VK_SHARING_MODE_EXCLUSIVE};
-
-    const VmaAllocationCreateInfo allocationCreateInfo{
-        .usage = this->memoryUsage};
+    const VkBufferCreateInfo createInfo = BuildCreateInfo(builder);
 
     auto& vulkanContext = builder.vulkanContext;
     const auto& vulkanRHI = vulkanContext.GetRHI();
 
     NativeHandle handle = VK_NULL_HANDLE;
-    VK_ASSERT(
-        vmaCreateBuffer(vulkanRHI.GetAllocator(), &createInfo, &allocationCreateInfo, &handle, &allocation, nullptr),
-        "Failed to create buffer {}.", builder.name);
+    if (builder.aliasingAllocation != VK_NULL_HANDLE)
+    {
+        /** Memory owned by someone else(ex. RenderGraph transient heap). */
+        VK_ASSERT(vkCreateBuffer(vulkanRHI.GetDevice(), &createInfo, nullptr, &handle),
+                  "Failed to create aliasing buffer {}.", builder.name);
+        VK_ASSERT(vmaBindBufferMemory2(vulkanRHI.GetAllocator(), builder.aliasingAllocation, builder.aliasingOffset, handle, nullptr),
+                  "Failed to bind aliasing memory to buffer {}.", builder.name);
 
-    UpdateHandle(
-        handle,
-        [handle, allocation = allocation](const VulkanRHI& rhi) {
-            vmaDestroyBuffer(rhi.GetAllocator(), handle, allocation);
-        });
+        UpdateHandle(
+            handle,
+            [handle](const VulkanRHI& rhi) {
+                vkDestroyBuffer(rhi.GetDevice(), handle, nullptr);
+            });
+    }
+    else
+    {
+        const VmaAllocationCreateInfo allocationCreateInfo{
+            .flags = builder.bPersistentlyMapped ? VMA_ALLOCATION_CREATE_MAPPED_BIT : 0u,
+            .usage = this->memoryUsage,
+            .requiredFlags = builder.memoryProperty};
+
+        VmaAllocationInfo allocationInfo{};
+        VK_ASSERT(
+            vmaCreateBuffer(vulkanRHI.GetAllocator(), &createInfo, &allocationCreateInfo, &handle, &allocation, &allocationInfo),
+            "Failed to create buffer {}.", builder.name);
+        mappedData = static_cast<std::byte*>(allocationInfo.pMappedData);
+
+        UpdateHandle(
+            handle,
+            [handle, allocation = allocation](const VulkanRHI& rhi) {
+                vmaDestroyBuffer(rhi.GetAllocator(), handle, allocation);
+            });
+    }
 
     const bool bRequiredDataTransfer = builder.dataToTransfer.has_value();
     const bool bRequiredStateChange = initialState != EBufferState::None;
@@ -80,10 +95,9 @@ Buffer::Buffer(const BufferBuilder& builder) :
                         .SetSize(builder.size)
                         .Build();
 
-                void* mappedStagingBuffer = vulkanRHI.Map(*stagingBuffer);
-                std::memcpy(mappedStagingBuffer, builder.dataToTransfer->data(),
+                std::memcpy(stagingBuffer->GetMappedSpan().data(), builder.dataToTransfer->data(),
                             builder.dataToTransfer->size());
-                vulkanRHI.Unmap(*stagingBuffer);
+                stagingBuffer->Flush();
 
                 cmdBuffer->CopyBufferSimple(*stagingBuffer, 0, *this, 0, builder.size);
             }
@@ -102,5 +116,47 @@ Buffer::Buffer(const BufferBuilder& builder) :
         vulkanRHI.SubmitImmediateTo(*cmdBuffer);
     }
 }
+
+void Buffer::Flush(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    SY_ASSERT(!IsAliased(), "Aliased buffer {} can not be flushed by itself.", GetName());
+    VK_ASSERT(vmaFlushAllocation(GetRHI().GetAllocator(), allocation, offset, size), "Failed to flush buffer {}.", GetName());
+}
+
+void Buffer::Invalidate(const VkDeviceSize offset, const VkDeviceSize size) const
+{
+    SY_ASSERT(!IsAliased(), "Aliased buffer {} can not be invalidated by itself.", GetName());
+    VK_ASSERT(vmaInvalidateAllocation(GetRHI().GetAllocator(), allocation, offset, size), "Failed to invalidate buffer {}.", GetName());
+}
+
+VkMemoryRequirements Buffer::QueryMemoryRequirements(const BufferBuilder& builder)
+{
+    const VkBufferCreateInfo createInfo = BuildCreateInfo(builder);
+    const VkDeviceBufferMemoryRequirements requirementsInfo{
+        .sType = VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS,
+        .pNext = nullptr,
+        .pCreateInfo = &createInfo};
+
+    VkMemoryRequirements2 requirements{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+        .pNext = nullptr};
+    vkGetDeviceBufferMemoryRequirements(builder.vulkanContext.GetRHI().GetDevice(), &requirementsInfo, &requirements);
+    return requirements.memoryRequirements;
+}
+
+VkBufferCreateInfo Buffer::BuildCreateInfo(const BufferBuilder& builder)
+{
+    /** Descriptor buffer refers uniform/storage buffers by device address. */
+    constexpr VkBufferUsageFlags DescriptorUsages      = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    const bool                   bRequireDeviceAddress = builder.vulkanContext.GetRHI().IsDescriptorBufferSupported() && (*builder.usage & DescriptorUsages) != 0;
+
+    return VkBufferCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .size = CalculateAlignedBufferSize(builder.vulkanContext, builder.size, *builder.usage),
+        .usage = *builder.usage | (builder.dataToTransfer.has_value() ? VK_BUFFER_USAGE_TRANSFER_DST_BIT : 0) | (bRequireDeviceAddress ? VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT : 0),
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE};
+}
 } // namespace vk
 } // namespace sy
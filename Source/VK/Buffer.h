@@ -19,9 +19,25 @@ public:
     [[nodiscard]] auto GetDescriptorInfo(const size_t offset = 0) const { return VkDescriptorBufferInfo{GetNative(), offset, GetAlignedSize()}; }
     [[nodiscard]] const VmaAllocation& GetAllocation() const { return allocation; }
     [[nodiscard]] Range<uint32_t> GetFullSubresourceRange() const { return Range<uint32_t>{0, static_cast<uint32_t>(alignedSize)}; }
+    /** Aliased buffer doesn't own its memory. */
+    [[nodiscard]] bool IsAliased() const { return allocation == VK_NULL_HANDLE; }
+    [[nodiscard]] bool IsPersistentlyMapped() const { return mappedData != nullptr; }
+    /** Empty if the buffer is not persistently mapped. */
+    [[nodiscard]] std::span<std::byte> GetMappedSpan() const { return mappedData != nullptr ? std::span<std::byte>{mappedData, alignedSize} : std::span<std::byte>{}; }
+
+    /** Makes host writes visible to device. Required only on non host coherent memory, otherwise it is no-op. */
+    void Flush(VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE) const;
+    /** Makes device writes visible to host. Required only on non host coherent memory, otherwise it is no-op. */
+    void Invalidate(VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE) const;
+
+    [[nodiscard]] static VkMemoryRequirements QueryMemoryRequirements(const BufferBuilder& builder);
+
+private:
+    [[nodiscard]] static VkBufferCreateInfo BuildCreateInfo(const BufferBuilder& builder);
 
 private:
     VmaAllocation allocation = VK_NULL_HANDLE;
+    std::byte* mappedData = nullptr;
     /** It can be extend its size later maybe? */
     const size_t alignedSize;
     const VkBufferUsageFlags usage;
@@ -12,8 +12,11 @@ bool BufferBuilder::IsValidToBuild() const
     SY_ASSERT(bIsValidSize, "BufferBuilder has invalid size to build buffer.");
     SY_ASSERT(bIsValidUsage, "BufferBuilder has invalid usage to build buffer.");
     SY_ASSERT(bIsValidMemoryUsage, "BufferBuilder has invalid memory usage to build buffer.");
+    /** Aliased buffer does not own its memory, so it can not be mapped by itself. */
+    const bool bIsValidMapping = !bPersistentlyMapped || aliasingAllocation == VK_NULL_HANDLE;
+    SY_ASSERT(bIsValidMapping, "Aliased buffer can not be persistently mapped.");
 
-    return bIsValidSize && bIsValidUsage && bIsValidMemoryUsage;
+    return bIsValidSize && bIsValidUsage && bIsValidMemoryUsage && bIsValidMapping;
 }
 
 std::unique_ptr<Buffer> BufferBuilder::Build() const
@@ -27,6 +30,7 @@ BufferBuilder BufferBuilder::UniformBufferTemplate(VulkanContext& vulkanContext)
     return BufferBuilder{vulkanContext}
         .SetUsage(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT)
         .SetMemoryUsage(VMA_MEMORY_USAGE_CPU_TO_GPU)
+        .SetPersistentlyMapped()
         .SetTargetInitialState(EBufferState::General);
 }
 
@@ -35,6 +39,7 @@ BufferBuilder BufferBuilder::StorageBufferTemplate(VulkanContext& vulkanContext)
     return BufferBuilder{vulkanContext}
         .SetUsage(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)
         .SetMemoryUsage(VMA_MEMORY_USAGE_CPU_TO_GPU)
+        .SetPersistentlyMapped()
         .SetTargetInitialState(EBufferState::General);
 }
 
@@ -42,7 +47,8 @@ BufferBuilder BufferBuilder::StagingBufferTemplate(VulkanContext& vulkanContext)
 {
     return BufferBuilder{vulkanContext}
         .SetUsage(VK_BUFFER_USAGE_TRANSFER_SRC_BIT)
-        .SetMemoryUsage(VMA_MEMORY_USAGE_CPU_ONLY);
+        .SetMemoryUsage(VMA_MEMORY_USAGE_CPU_ONLY)
+        .SetPersistentlyMapped();
 }
 
 BufferBuilder BufferBuilder::VertexBufferTemplate(VulkanContext& vulkanContext)
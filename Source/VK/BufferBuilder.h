@@ -96,6 +96,21 @@ public:
         return SetDataToTransfer(typedData).SetSize(typedData.size_bytes());
     }
 
+    /** Memory stays mapped for whole lifetime of the buffer; it can be accessed through Buffer::GetMappedSpan without map/unmap. */
+    BufferBuilder& SetPersistentlyMapped(const bool bPersistentlyMapped = true)
+    {
+        this->bPersistentlyMapped = bPersistentlyMapped;
+        return *this;
+    }
+
+    /** Bind to given memory instead of own dedicated allocation. Memory must outlive the buffer. */
+    BufferBuilder& SetAliasingMemory(const VmaAllocation allocation, const VkDeviceSize offset)
+    {
+        aliasingAllocation = allocation;
+        aliasingOffset     = offset;
+        return *this;
+    }
+
     [[nodiscard]] bool IsValidToBuild() const;
 
     [[nodiscard]] std::unique_ptr<Buffer> Build() const;
@@ -115,9 +130,12 @@ private:
     size_t         size               = 1;
     EBufferState   targetInitialState = EBufferState::None;
     /** @todo May builder have vector of bytes instead of span? cause it can be dangling in some situation. */
-    std::optional<std::span<const uint8_t>> dataToTransfer = std::nullopt;
-    std::optional<VkBufferUsageFlags>       usage          = std::nullopt;
-    std::optional<VmaMemoryUsage>           memoryUsage    = std::nullopt;
-    VkMemoryPropertyFlags                   memoryProperty = 0;
+    std::optional<std::span<const uint8_t>> dataToTransfer      = std::nullopt;
+    std::optional<VkBufferUsageFlags>       usage               = std::nullopt;
+    std::optional<VmaMemoryUsage>           memoryUsage         = std::nullopt;
+    VkMemoryPropertyFlags                   memoryProperty      = 0;
+    VmaAllocation                           aliasingAllocation  = VK_NULL_HANDLE;
+    VkDeviceSize                            aliasingOffset      = 0;
+    bool                                    bPersistentlyMapped = false;
 };
 } // namespace sy::vk
@@ -22,7 +22,8 @@ VkBufferMemoryBarrier2 BufferStateTransition::Build() const
     const bool bValidStates = srcState && dstState;
     SY_ASSERT(bValidStates, "Both states are does not setup. It result in redundant transition.");
     const bool bStatesAreNotEqual = bValidStates && (*srcState != *dstState);
-    SY_ASSERT(bStatesAreNotEqual, "State are equal. It may result in redudant transition.");
+    const bool bIsQueueOwnershipTransfer = srcQueueType != dstQueueType;
+    SY_ASSERT(bStatesAreNotEqual || bIsQueueOwnershipTransfer, "State are equal. It may result in redudant transition.");
 
     bool bIsValidNativeHandle = false;
     if (IsUsedNativeHandle())
@@ -49,8 +50,8 @@ VkBufferMemoryBarrier2 BufferStateTransition::Build() const
     const VkBufferMemoryBarrier2 barrier{
         .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
         .pNext = nullptr,
-        .srcStageMask = srcAccessPattern.PipelineStage,
-        .srcAccessMask = srcAccessPattern.Access,
+        .srcStageMask = srcAccessPattern.PipelineStage | aliasingSrcStageMask,
+        .srcAccessMask = srcAccessPattern.Access | aliasingSrcAccessMask,
         .dstStageMask = dstAccessPattern.PipelineStage,
         .dstAccessMask = dstAccessPattern.Access,
         .srcQueueFamilyIndex = srcQueueType ? vulkanRHI.GetQueueFamilyIndex(*srcQueueType) : VK_QUEUE_FAMILY_IGNORED,
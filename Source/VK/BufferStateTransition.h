@@ -35,6 +35,13 @@ public:
     void SetDestinationQueueType(const EQueueType queueType) { this->dstQueueType = queueType; }
     void SetSubresourceRange(const Range<uint32_t> range) { this->subresourceRange = range; }
 
+    /** Memory was occupied by other resource; wait on its last access. Contents are discarded, so source state stays undefined. */
+    void SetAliasingSource(const VkPipelineStageFlags2 stageMask, const VkAccessFlags2 accessMask)
+    {
+        this->aliasingSrcStageMask  = stageMask;
+        this->aliasingSrcAccessMask = accessMask;
+    }
+
 	VkBufferMemoryBarrier2 Build() const;
 
 private:
@@ -46,6 +53,8 @@ private:
     std::optional<EQueueType> srcQueueType = std::nullopt;
     std::optional<EQueueType> dstQueueType = std::nullopt;
     std::optional<Range<uint32_t>> subresourceRange = std::nullopt;
+    VkPipelineStageFlags2 aliasingSrcStageMask = VK_PIPELINE_STAGE_2_NONE;
+    VkAccessFlags2 aliasingSrcAccessMask = VK_ACCESS_2_NONE;
 
 };
 } // namespace sy::vk
\ No newline at end of file
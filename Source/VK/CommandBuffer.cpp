@@ -1,32 +1,46 @@
 #include <PCH.h>
 #include <VK/CommandBuffer.h>
-#include <VK/CommandPool.h>
 #include <VK/VulkanRHI.h>
 #include <VK/Pipeline.h>
 #include <VK/Buffer.h>
 #include <VK/Texture.h>
+#include <VK/Event.h>
+#include <VK/QueryPool.h>
 
 namespace sy::vk
 {
-CommandBuffer::CommandBuffer(const std::string_view name, VulkanContext& vulkanContext, const CommandPool& cmdPool) :
-    VulkanWrapper<VkCommandBuffer>(name, vulkanContext, VK_OBJECT_TYPE_COMMAND_BUFFER), queueType(cmdPool.GetQueueType())
+static VkDependencyInfo BuildDependencyInfo(const std::span<const TextureStateTransition> textureTransitions, const std::span<const BufferStateTransition> bufferTransitions,
+                                            std::vector<VkImageMemoryBarrier2>& imageBarriers, std::vector<VkBufferMemoryBarrier2>& bufferBarriers)
 {
-    const VkCommandBufferAllocateInfo allocInfo{
-        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-        .pNext = nullptr,
-        .commandPool = cmdPool.GetNative(),
-        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-        .commandBufferCount = 1};
+    imageBarriers.resize(textureTransitions.size());
+    std::transform(
+        textureTransitions.begin(), textureTransitions.end(),
+        imageBarriers.begin(),
+        [](const TextureStateTransition& transition) {
+            return transition.Build();
+        });
 
-    NativeHandle handle = VK_NULL_HANDLE;
-    VK_ASSERT(vkAllocateCommandBuffers(GetRHI().GetDevice(), &allocInfo, &handle),
-              "Failed to creating command buffer.");
-    UpdateHandle(handle, SY_VK_WRAPPER_EMPTY_DELETER);
+    bufferBarriers.resize(bufferTransitions.size());
+    std::transform(
+        bufferTransitions.begin(), bufferTransitions.end(),
+        bufferBarriers.begin(),
+        [](const BufferStateTransition& transition) {
+            return transition.Build();
+        });
+
+    return VkDependencyInfo{
+        .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+        .pNext = nullptr,
+        .bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers.size()),
+        .pBufferMemoryBarriers = bufferBarriers.data(),
+        .imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers.size()),
+        .pImageMemoryBarriers = imageBarriers.data()};
 }
 
-void CommandBuffer::Reset() const
+CommandBuffer::CommandBuffer(const std::string_view name, VulkanContext& vulkanContext, const EQueueType queueType, const VkCommandBuffer handle) :
+    VulkanWrapper<VkCommandBuffer>(name, vulkanContext, VK_OBJECT_TYPE_COMMAND_BUFFER), queueType(queueType)
 {
-    vkResetCommandBuffer(GetNative(), 0);
+    UpdateHandle(handle, SY_VK_WRAPPER_EMPTY_DELETER);
 }
 
 void CommandBuffer::Begin() const
@@ -41,6 +55,27 @@ void CommandBuffer::Begin() const
               GetName());
 }
 
+void CommandBuffer::Begin(const VkCommandBufferInheritanceRenderingInfo& renderingInheritance) const
+{
+    const VkCommandBufferInheritanceInfo inheritanceInfo{
+        .sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+        .pNext                = &renderingInheritance,
+        .renderPass           = VK_NULL_HANDLE,
+        .subpass              = 0,
+        .framebuffer          = VK_NULL_HANDLE,
+        .occlusionQueryEnable = VK_FALSE,
+        .queryFlags           = 0,
+        .pipelineStatistics   = 0};
+
+    const VkCommandBufferBeginInfo beginInfo{
+        .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .pNext            = nullptr,
+        .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+        .pInheritanceInfo = &inheritanceInfo};
+
+    VK_ASSERT(vkBeginCommandBuffer(GetNative(), &beginInfo), "Failed to begin secondary command buffer {}.", GetName());
+}
+
 void CommandBuffer::End() const
 {
     VK_ASSERT(vkEndCommandBuffer(GetNative()), "Failed to end command buffer {}.", GetName());
@@ -56,6 +91,12 @@ void CommandBuffer::EndRendering() const
     vkCmdEndRendering(GetNative());
 }
 
+void CommandBuffer::ExecuteCommands(const CRefSpan<CommandBuffer> secondaryCmdBuffers) const
+{
+    const auto natives = TransformVulkanWrappersToNatives<CommandBuffer>(secondaryCmdBuffers);
+    vkCmdExecuteCommands(GetNative(), static_cast<uint32_t>(natives.size()), natives.data());
+}
+
 void CommandBuffer::ApplyStateTransition(const TextureStateTransition transition) const
 {
     VkImageMemoryBarrier2 barriers[] = {transition.Build()};
@@ -71,7 +112,7 @@ void CommandBuffer::ApplyStateTransition(BufferStateTransition transition) const
 void CommandBuffer::ApplyStateTransitions(const std::span<const TextureStateTransition> transitions) const
 {
     std::vector<VkImageMemoryBarrier2> barriers;
-    barriers.reserve(transitions.size());
+    barriers.resize(transitions.size());
     std::transform(
 		transitions.begin(), transitions.end(), 
 		barriers.begin(), 
@@ -85,7 +126,7 @@ void CommandBuffer::ApplyStateTransitions(const std::span<const TextureStateTran
 void CommandBuffer::ApplyStateTransitions(std::span<const BufferStateTransition> transitions) const
 {
     std::vector<VkBufferMemoryBarrier2> barriers;
-    barriers.reserve(transitions.size());
+    barriers.resize(transitions.size());
     std::transform(
         transitions.begin(), transitions.end(),
         barriers.begin(),
@@ -118,12 +159,65 @@ void CommandBuffer::BatchStateTransitions(const std::span<const BufferStateTrans
 
 void CommandBuffer::FlushBatchedStateTransitions()
 {
-    ApplyStateTransitions(batchedTextureStateTransitions);
-    ApplyStateTransitions(batchedBufferStateTransitions);
+    if (batchedTextureStateTransitions.empty() && batchedBufferStateTransitions.empty())
+    {
+        return;
+    }
+
+    /** All batched transitions are submitted through single pipeline barrier. */
+    std::vector<VkImageMemoryBarrier2> imageBarriers;
+    imageBarriers.resize(batchedTextureStateTransitions.size());
+    std::transform(
+        batchedTextureStateTransitions.begin(), batchedTextureStateTransitions.end(),
+        imageBarriers.begin(),
+        [](const TextureStateTransition& transition) {
+            return transition.Build();
+        });
+
+    std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+    bufferBarriers.resize(batchedBufferStateTransitions.size());
+    std::transform(
+        batchedBufferStateTransitions.begin(), batchedBufferStateTransitions.end(),
+        bufferBarriers.begin(),
+        [](const BufferStateTransition& transition) {
+            return transition.Build();
+        });
+
+    PipelineBarrier({}, bufferBarriers, imageBarriers);
     batchedTextureStateTransitions.clear();
     batchedBufferStateTransitions.clear();
 }
 
+void CommandBuffer::SetEvent(const Event& event, const std::span<const TextureStateTransition> textureTransitions, const std::span<const BufferStateTransition> bufferTransitions) const
+{
+    std::vector<VkImageMemoryBarrier2>  imageBarriers;
+    std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+    const VkDependencyInfo              dependencyInfo = BuildDependencyInfo(textureTransitions, bufferTransitions, imageBarriers, bufferBarriers);
+
+    vkCmdSetEvent2(GetNative(), event.GetNative(), &dependencyInfo);
+}
+
+void CommandBuffer::WaitEvent(const Event& event, const std::span<const TextureStateTransition> textureTransitions, const std::span<const BufferStateTransition> bufferTransitions) const
+{
+    std::vector<VkImageMemoryBarrier2>  imageBarriers;
+    std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+    const VkDependencyInfo              dependencyInfo = BuildDependencyInfo(textureTransitions, bufferTransitions, imageBarriers, bufferBarriers);
+
+    const VkEvent eventHandle = event.GetNative();
+    vkCmdWaitEvents2(GetNative(), 1, &eventHandle, &dependencyInfo);
+}
+
+void CommandBuffer::ResetEvent(const Event& event, const VkPipelineStageFlags2 stageMask) const
+{
+    vkCmdResetEvent2(GetNative(), event.GetNative(), stageMask);
+}
+
+void CommandBuffer::WriteTimestamp(const QueryPool& queryPool, const VkPipelineStageFlags2 stage, const uint32_t query) const
+{
+    SY_ASSERT(query < queryPool.GetNumQueries(), "Out of range timestamp query of {}.", queryPool.GetName());
+    vkCmdWriteTimestamp2(GetNative(), stage, queryPool.GetNative(), query);
+}
+
 void CommandBuffer::BindPipeline(const Pipeline& pipeline) const
 {
     vkCmdBindPipeline(GetNative(), pipeline.GetBindPoint(), pipeline.GetNative());
@@ -138,6 +232,20 @@ void CommandBuffer::BindDescriptorSet(VkDescriptorSet descriptorSet, const Pipel
                             descriptorSets, 0, nullptr);
 }
 
+void CommandBuffer::BindDescriptorBuffer(const VkDeviceAddress address, const VkBufferUsageFlags usage, const Pipeline& pipeline) const
+{
+    const VkDescriptorBufferBindingInfoEXT bindingInfo{
+        .sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+        .pNext   = nullptr,
+        .address = address,
+        .usage   = usage};
+    vkCmdBindDescriptorBuffersEXT(GetNative(), 1, &bindingInfo);
+
+    constexpr uint32_t     bufferIndex = 0;
+    constexpr VkDeviceSize offset      = 0;
+    vkCmdSetDescriptorBufferOffsetsEXT(GetNative(), pipeline.GetBindPoint(), pipeline.GetLayout(), 0, 1, &bufferIndex, &offset);
+}
+
 void CommandBuffer::BindVertexBuffers(const uint32_t firstBinding, const std::span<CRef<Buffer>> buffers, const std::span<size_t> offsets) const
 {
     std::vector<VkBuffer> handles;
@@ -6,15 +6,17 @@
 
 namespace sy::vk
 {
-class CommandPool;
 class Fence;
+class Event;
+class QueryPool;
 class Pipeline;
 class Buffer;
 class Texture;
 class CommandBuffer : public VulkanWrapper<VkCommandBuffer>
 {
 public:
-    CommandBuffer(std::string_view name, VulkanContext& vulkanContext, const CommandPool& cmdPool);
+    /** Wraps command buffer which is allocated by the command pool; command pool owns its memory. */
+    CommandBuffer(std::string_view name, VulkanContext& vulkanContext, EQueueType queueType, VkCommandBuffer handle);
     ~CommandBuffer() override = default;
 
     [[nodiscard]] EQueueType GetQueueType() const
@@ -22,12 +24,15 @@ public:
         return queueType;
     }
 
-    void Reset() const;
     void Begin() const;
+    /** Begin secondary command buffer which continues dynamic rendering of primary command buffer, with matching attachment formats. */
+    void Begin(const VkCommandBufferInheritanceRenderingInfo& renderingInheritance) const;
     void End() const;
 
     void BeginRendering(const VkRenderingInfo& renderingInfo) const;
     void EndRendering() const;
+    /** Secondary command buffers are executed in given order. */
+    void ExecuteCommands(CRefSpan<CommandBuffer> secondaryCmdBuffers) const;
 
     void ApplyStateTransition(TextureStateTransition transition) const;
     void ApplyStateTransition(BufferStateTransition transition) const;
@@ -40,8 +45,19 @@ public:
     void BatchStateTransitions(std::span<const BufferStateTransition> transitions);
     void FlushBatchedStateTransitions();
 
+    /** Split barrier: transitions begin at SetEvent and complete at WaitEvent. Both must be given the same transitions. */
+    void SetEvent(const Event& event, std::span<const TextureStateTransition> textureTransitions, std::span<const BufferStateTransition> bufferTransitions) const;
+    void WaitEvent(const Event& event, std::span<const TextureStateTransition> textureTransitions, std::span<const BufferStateTransition> bufferTransitions) const;
+    /** Event can be reset right after the wait on the same queue, once given stages of previous commands are done. */
+    void ResetEvent(const Event& event, VkPipelineStageFlags2 stageMask) const;
+
+    /** Query must be reset before written. */
+    void WriteTimestamp(const QueryPool& queryPool, VkPipelineStageFlags2 stage, uint32_t query) const;
+
     void BindPipeline(const Pipeline& pipeline) const;
     void BindDescriptorSet(VkDescriptorSet descriptorSet, const Pipeline& pipeline) const;
+    /** Binds descriptor buffer as set 0 of the pipeline layout. Pipeline must be created with VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT. */
+    void BindDescriptorBuffer(VkDeviceAddress address, VkBufferUsageFlags usage, const Pipeline& pipeline) const;
     void BindVertexBuffers(uint32_t firstBinding, std::span<CRef<Buffer>> buffers, std::span<size_t> offsets) const;
     void BindVertexBuffers(uint32_t firstBinding, std::span<VkBuffer> buffers, std::span<size_t> offsets) const;
     void BindIndexBuffer(const Buffer& indexBuffer, size_t offset = 0) const;
@@ -8,7 +8,7 @@ namespace sy
 namespace vk
 {
 CommandPool::CommandPool(VulkanContext& vulkanContext, const EQueueType queueType) :
-    VulkanWrapper<VkCommandPool>("Unknown Pool", vulkanContext, VK_OBJECT_TYPE_COMMAND_POOL), queueType(queueType), offsetPool(1, 16)
+    VulkanWrapper<VkCommandPool>("Unknown Pool", vulkanContext, VK_OBJECT_TYPE_COMMAND_POOL), queueType(queueType)
 {
     switch (queueType)
     {
@@ -31,7 +31,7 @@ CommandPool::CommandPool(VulkanContext& vulkanContext, const EQueueType queueTyp
     const VkCommandPoolCreateInfo cmdPoolCreateInfo{
         .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
         .pNext = nullptr,
-        .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
         .queueFamilyIndex = queueFamilyIdx};
 
     NativeHandle handle = VK_NULL_HANDLE;
@@ -44,38 +44,49 @@ CommandPool::CommandPool(VulkanContext& vulkanContext, const EQueueType queueTyp
         });
 }
 
-ManagedCommandBuffer CommandPool::RequestCommandBuffer(std::string_view name)
+ManagedCommandBuffer CommandPool::RequestCommandBuffer(const std::string_view name)
 {
-    const auto allocatedSlot = offsetPool.Allocate();
-    const Deallocation deallocation{.slot = allocatedSlot};
+    return RequestCommandBuffer(cmdBuffers, VK_COMMAND_BUFFER_LEVEL_PRIMARY, name);
+}
 
-    if (allocatedSlot.Offset >= cmdBuffers.size())
-    {
-        cmdBuffers.emplace_back(std::make_unique<CommandBuffer>(name, GetContext(), *this));
-    }
+ManagedCommandBuffer CommandPool::RequestSecondaryCommandBuffer(const std::string_view name)
+{
+    return RequestCommandBuffer(secondaryCmdBuffers, VK_COMMAND_BUFFER_LEVEL_SECONDARY, name);
+}
 
-    cmdBuffers[allocatedSlot.Offset]->Reset();
-    return ManagedCommandBuffer{
-        cmdBuffers[allocatedSlot.Offset].get(),
-        [this, deallocation](CommandBuffer*) {
-            pendingDeallocations.emplace_back(deallocation);
-        }};
+ManagedCommandBuffer CommandPool::RequestCommandBuffer(LinearRecycler<CommandBuffer>& recycler, const VkCommandBufferLevel level, const std::string_view name)
+{
+    CommandBuffer& cmdBuffer = recycler.Request([this, level](const size_t count, std::vector<std::unique_ptr<CommandBuffer>>& chunk) {
+        const VkCommandBufferAllocateInfo allocInfo{
+            .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .pNext              = nullptr,
+            .commandPool        = GetNative(),
+            .level              = level,
+            .commandBufferCount = static_cast<uint32_t>(count)};
+
+        std::vector<VkCommandBuffer> handles(count);
+        VK_ASSERT(vkAllocateCommandBuffers(GetRHI().GetDevice(), &allocInfo, handles.data()), "Failed to allocate {} command buffers from {}.", count, GetName());
+        for (const VkCommandBuffer handle : handles)
+        {
+            chunk.emplace_back(std::make_unique<CommandBuffer>("Command Buffer", GetContext(), queueType, handle));
+        }
+    });
+
+    cmdBuffer.SetName(name);
+    return ManagedCommandBuffer{cmdBuffer};
 }
 
 void CommandPool::Reset() const
 {
+    /** Memory of command buffers is kept to be reused by the next frame. */
     const auto& vulkanRHI = GetRHI();
-    vkResetCommandPool(vulkanRHI.GetDevice(), GetNative(), VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT);
+    vkResetCommandPool(vulkanRHI.GetDevice(), GetNative(), 0);
 }
 
 void CommandPool::BeginFrame()
 {
-    for (auto& deallocation : pendingDeallocations)
-    {
-        offsetPool.Deallocate(deallocation.slot);
-    }
-    pendingDeallocations.clear();
-
+    cmdBuffers.Reset();
+    secondaryCmdBuffers.Reset();
     Reset();
 }
 } // namespace vk
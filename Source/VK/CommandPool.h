@@ -1,25 +1,27 @@
 #pragma once
 #include <PCH.h>
 #include <VK/VulkanWrapper.h>
+#include <Core/LinearRecycler.h>
 
 namespace sy::vk
 {
 class VulkanRHI;
 class CommandBuffer;
 class Fence;
+/**
+ * Command buffers are handed out linearly during the frame and recycled in bulk when the pool is reset at BeginFrame,
+ * so requested command buffer is always in initial state and never needs to be reset individually.
+ */
 class CommandPool : public VulkanWrapper<VkCommandPool>
 {
-public:
-    struct Deallocation
-    {
-        const OffsetPool::Slot_t slot;
-    };
-
 public:
     CommandPool(VulkanContext& vulkanContext, EQueueType queueType);
     ~CommandPool() override = default;
 
+    /** Valid until BeginFrame of the pool. */
     ManagedCommandBuffer RequestCommandBuffer(std::string_view name);
+    /** Secondary command buffer to be executed by primary command buffer of the same queue family. Valid until BeginFrame of the pool. */
+    ManagedCommandBuffer RequestSecondaryCommandBuffer(std::string_view name);
 
     [[nodiscard]] EQueueType GetQueueType() const
     {
@@ -30,10 +32,17 @@ public:
 
     void Reset() const;
 
+    [[nodiscard]] size_t GetNumRequestedCommandBuffers() const { return cmdBuffers.GetNumRequested(); }
+    [[nodiscard]] size_t GetNumAllocatedCommandBuffers() const { return cmdBuffers.GetNumAllocated(); }
+
 private:
-    const EQueueType                            queueType;
-    OffsetPool                                  offsetPool;
-    std::vector<std::unique_ptr<CommandBuffer>> cmdBuffers;
-    std::vector<Deallocation>                   pendingDeallocations;
+    ManagedCommandBuffer RequestCommandBuffer(LinearRecycler<CommandBuffer>& recycler, VkCommandBufferLevel level, std::string_view name);
+
+private:
+    constexpr static size_t MinCommandBufferChunkSize = 8;
+
+    const EQueueType              queueType;
+    LinearRecycler<CommandBuffer> cmdBuffers{MinCommandBufferChunkSize};
+    LinearRecycler<CommandBuffer> secondaryCmdBuffers{MinCommandBufferChunkSize};
 };
 } // namespace sy::vk
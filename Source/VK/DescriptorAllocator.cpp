@@ -7,6 +7,9 @@
 #include <VK/Texture.h>
 #include <VK/TextureView.h>
 #include <VK/Sampler.h>
+#include <VK/DescriptorBuffer.h>
+#include <VK/CommandBuffer.h>
+#include <VK/Pipeline.h>
 
 namespace sy
 {
@@ -24,31 +27,43 @@ DescriptorAllocator::~DescriptorAllocator()
 void DescriptorAllocator::Startup()
 {
     spdlog::info("Startup Descriptor Manager.");
-    const auto poolSizeBuilder = DescriptorPoolSizeBuilder{}
-                                     .AddDescriptors(vk::EDescriptorType::CombinedImageSampler, 1000)
-                                     .AddDescriptors(vk::EDescriptorType::UniformBuffer, 1000)
-                                     .AddDescriptors(vk::EDescriptorType::StorageBuffer, 1000)
-                                     .AddDescriptors(vk::EDescriptorType::SampledImage, 1000)
-                                     .AddDescriptors(vk::EDescriptorType::CombinedImageSampler, 1000)
-                                     .AddDescriptors(vk::EDescriptorType::StorageImage, 1000);
+    const auto& vulkanRHI  = vulkanContext.GetRHI();
+    auto        capacities = CalculateBindingCapacities(vulkanRHI.GetDescriptorIndexingProperties());
+
+    backend = EDescriptorBackend::DescriptorSet;
+    if (preferredBackend == EDescriptorBackend::DescriptorBuffer && vulkanRHI.IsDescriptorBufferSupported())
+    {
+        const auto descriptorBufferCapacities = CalculateDescriptorBufferCapacities(vulkanRHI.GetLimits());
+        if (IsDescriptorBufferUsable(vulkanRHI.GetDescriptorBufferProperties(), descriptorBufferCapacities))
+        {
+            backend    = EDescriptorBackend::DescriptorBuffer;
+            capacities = descriptorBufferCapacities;
+        }
+    }
+    spdlog::info("Bindless descriptor backend: {}", magic_enum::enum_name(backend));
+
+    DescriptorPoolSizeBuilder poolSizeBuilder;
+    for (const EDescriptorType descriptorType : BindlessDescriptorTypes)
+    {
+        poolSizeBuilder.AddDescriptors(descriptorType, capacities[ToUnderlying(descriptorType)]);
+    }
 
     const auto nativePoolSizes = poolSizeBuilder.BuildAsNative();
     const auto poolSizes       = poolSizeBuilder.Build();
 
-    const VkDescriptorPoolCreateInfo poolCreateInfo{
-        .sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-        .pNext         = nullptr,
-        .flags         = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
-        .maxSets       = static_cast<uint32_t>(poolSizeBuilder.GetDescriptorCount()),
-        .poolSizeCount = static_cast<uint32_t>(nativePoolSizes.size()),
-        .pPoolSizes    = nativePoolSizes.data()};
+    /** Descriptors of descriptor buffer can always be updated after bind, but variable descriptor count is not allowed. */
+    const bool bUseDescriptorBuffer = backend == EDescriptorBackend::DescriptorBuffer;
 
     std::vector<VkDescriptorBindingFlags> bindingFlags;
     bindingFlags.resize(nativePoolSizes.size());
 
-    constexpr auto flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+    /** Fresh slots are written while previous frames are pending, which requires update unused while pending. */
+    const VkDescriptorBindingFlags flags = bUseDescriptorBuffer ? VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT : (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT);
     std::fill(bindingFlags.begin(), bindingFlags.end(), flags);
-    bindingFlags.back() = (flags | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT_EXT);
+    if (!bUseDescriptorBuffer)
+    {
+        bindingFlags.back() = (flags | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT_EXT);
+    }
 
     std::vector<VkDescriptorSetLayoutBinding> bindings;
     bindings.resize(nativePoolSizes.size());
@@ -79,44 +94,86 @@ void DescriptorAllocator::Startup()
     const VkDescriptorSetLayoutCreateInfo bindlessLayoutInfo{
         .sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
         .pNext        = &extendedLayoutInfo,
-        .flags        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+        .flags        = bUseDescriptorBuffer ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
         .bindingCount = static_cast<uint32_t>(bindings.size()),
         .pBindings    = bindings.data()};
 
-    const auto& vulkanRHI = vulkanContext.GetRHI();
     spdlog::trace("Creating Bindless descriptor set layout...");
     VK_ASSERT(vkCreateDescriptorSetLayout(vulkanRHI.GetDevice(), &bindlessLayoutInfo, nullptr, &bindlessLayout),
               "Failed to create bindless descriptor set layout.");
 
-    spdlog::trace("Creating pool package...");
-    VK_ASSERT(vkCreateDescriptorPool(vulkanRHI.GetDevice(), &poolCreateInfo, nullptr, &descriptorPoolPackage.DescriptorPool), "Failed to create descriptor pool.");
-
-    const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT descriptorSetVariableDescriptorCountAllocateInfo{
-        .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT,
-        .pNext              = nullptr,
-        .descriptorSetCount = 1,
-        .pDescriptorCounts  = descriptorCounts.data()};
-
-    const VkDescriptorSetAllocateInfo setAllocateInfo{
-        .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-        .pNext              = &descriptorSetVariableDescriptorCountAllocateInfo,
-        .descriptorPool     = descriptorPoolPackage.DescriptorPool,
-        .descriptorSetCount = 1,
-        .pSetLayouts        = &bindlessLayout};
-
-    VK_ASSERT(vkAllocateDescriptorSets(vulkanRHI.GetDevice(), &setAllocateInfo, &descriptorPoolPackage.DescriptorSet), "Failed to allocate descriptor set.");
+    if (bUseDescriptorBuffer)
+    {
+        spdlog::trace("Creating descriptor buffer...");
+        descriptorBuffer = std::make_unique<DescriptorBuffer>(vulkanContext, bindlessLayout, BindlessDescriptorTypes);
+    }
+    else
+    {
+        const VkDescriptorPoolCreateInfo poolCreateInfo{
+            .sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+            .pNext         = nullptr,
+            .flags         = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+            .maxSets       = 1,
+            .poolSizeCount = static_cast<uint32_t>(nativePoolSizes.size()),
+            .pPoolSizes    = nativePoolSizes.data()};
+
+        spdlog::trace("Creating pool package...");
+        VK_ASSERT(vkCreateDescriptorPool(vulkanRHI.GetDevice(), &poolCreateInfo, nullptr, &descriptorPoolPackage.DescriptorPool), "Failed to create descriptor pool.");
+
+        const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT descriptorSetVariableDescriptorCountAllocateInfo{
+            .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT,
+            .pNext              = nullptr,
+            .descriptorSetCount = 1,
+            .pDescriptorCounts  = &descriptorCounts.back()};
+
+        const VkDescriptorSetAllocateInfo setAllocateInfo{
+            .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+            .pNext              = &descriptorSetVariableDescriptorCountAllocateInfo,
+            .descriptorPool     = descriptorPoolPackage.DescriptorPool,
+            .descriptorSetCount = 1,
+            .pSetLayouts        = &bindlessLayout};
+
+        VK_ASSERT(vkAllocateDescriptorSets(vulkanRHI.GetDevice(), &setAllocateInfo, &descriptorPoolPackage.DescriptorSet), "Failed to allocate descriptor set.");
+    }
 
     for (const auto& poolSize : poolSizes)
     {
-        auto& offsetPoolPackage = descriptorPoolPackage.OffsetPoolPackages[ToUnderlying(poolSize.Type)];
-        offsetPoolPackage.Pool.Grow(poolSize.Size);
-        offsetPoolPackage.AllocatedSlots.resize(poolSize.Size);
+        auto& bindingPackage         = descriptorPoolPackage.BindingPackages[ToUnderlying(poolSize.Type)];
+        bindingPackage.SlotAllocator = DescriptorSlotAllocator{std::min<size_t>(MaxBindlessResourcesPerDescriptor, poolSize.Size), poolSize.Size};
+        spdlog::trace("Bindless binding {}: {} descriptors.", magic_enum::enum_name(poolSize.Type), poolSize.Size);
     }
 }
 
 void DescriptorAllocator::Shutdown()
 {
     spdlog::info("Shutdown Descriptor Manager.");
+    for (const EDescriptorType descriptorType : BindlessDescriptorTypes)
+    {
+        const auto statistics = GetStatistics(descriptorType);
+        spdlog::info("Bindless binding {}: high-water {}/{} slots (max {}), {} grows, {} failed allocations.",
+                     magic_enum::enum_name(descriptorType),
+                     statistics.HighWaterMark,
+                     statistics.Capacity,
+                     statistics.MaxCapacity,
+                     statistics.NumGrows,
+                     statistics.NumFailedAllocations);
+    }
+
+    if (descriptorBuffer != nullptr)
+    {
+        spdlog::info("Descriptor buffer writes: {}", descriptorBuffer->GetNumWrites());
+        descriptorBuffer.reset();
+    }
+
+    const auto writeStatistics = writeQueue.GetStatistics();
+    spdlog::info("Descriptor writes: {} enqueued from {} threads, {} contended, {} deduplicated, {} flushed in {} batches.",
+                 writeStatistics.NumEnqueued,
+                 writeStatistics.NumThreadQueues,
+                 writeStatistics.NumContendedEnqueues,
+                 writeStatistics.NumDeduplicated,
+                 writeStatistics.NumFlushed,
+                 writeStatistics.NumFlushes);
+
     const auto& vulkanRHI = vulkanContext.GetRHI();
     vkDestroyDescriptorPool(vulkanRHI.GetDevice(), descriptorPoolPackage.DescriptorPool, nullptr);
     vkDestroyDescriptorSetLayout(vulkanRHI.GetDevice(), bindlessLayout, nullptr);
@@ -124,98 +181,52 @@ void DescriptorAllocator::Shutdown()
 
 void DescriptorAllocator::BeginFrame()
 {
-    auto& pendingList = pendingDeallocations[frameTracker.GetFrameIndex()];
-    for (const Allocation& allocation : pendingList)
+    for (BindingPackage& bindingPackage : descriptorPoolPackage.BindingPackages)
     {
-        allocation.Owner.Pool.Deallocate(allocation.AllocatedSlot);
+        std::lock_guard lock{bindingPackage.Mutex};
+        bindingPackage.SlotAllocator.BeginFrame(frameTracker.GetFrameCounter());
+    }
+
+    /** Written slots are fresh ones which no in-flight frame uses, so they can be updated while previous frames are pending. */
+    writeQueue.Flush(GetDescriptorSet(), writeBatch);
+    if (!writeBatch.Writes.empty())
+    {
+        vkUpdateDescriptorSets(vulkanContext.GetRHI().GetDevice(),
+                               static_cast<uint32_t>(writeBatch.Writes.size()),
+                               writeBatch.Writes.data(), 0, nullptr);
     }
-    pendingList.clear();
 }
 
 void DescriptorAllocator::EndFrame()
 {
-    const bool bHasBufferDescriptorToUpdate = !bufferWriteDescriptors.empty();
-    const bool bHasImageDescriptorToUpdate  = !imageWriteDescriptors.empty();
-    if (bHasBufferDescriptorToUpdate || bHasImageDescriptorToUpdate)
-    {
-        combinedWriteDescriptorSets.reserve(bufferWriteDescriptors.size() + imageWriteDescriptors.size());
-        if (bHasBufferDescriptorToUpdate)
-        {
-            for (size_t idx = 0; idx < bufferWriteDescriptors.size(); ++idx)
-            {
-                bufferWriteDescriptors[idx].pBufferInfo = &bufferInfos[idx];
-            }
-
-            combinedWriteDescriptorSets.assign(bufferWriteDescriptors.begin(), bufferWriteDescriptors.end());
-        }
-
-        if (bHasImageDescriptorToUpdate)
-        {
-            for (size_t idx = 0; idx < imageWriteDescriptors.size(); ++idx)
-            {
-                imageWriteDescriptors[idx].pImageInfo = &imageInfos[idx];
-            }
-
-            combinedWriteDescriptorSets.insert(combinedWriteDescriptorSets.end(), imageWriteDescriptors.begin(),
-                                               imageWriteDescriptors.end());
-        }
-
-        if (!combinedWriteDescriptorSets.empty())
-        {
-            vkUpdateDescriptorSets(vulkanContext.GetRHI().GetDevice(),
-                                   static_cast<uint32_t>(combinedWriteDescriptorSets.size()),
-                                   combinedWriteDescriptorSets.data(), 0, nullptr);
-            bufferWriteDescriptors.clear();
-            bufferInfos.clear();
-            imageWriteDescriptors.clear();
-            imageInfos.clear();
-            combinedWriteDescriptorSets.clear();
-        }
-    }
+    /* Empty */
 }
 
 Descriptor DescriptorAllocator::RequestDescriptor(const vk::Buffer& buffer, const bool bIsDynamic)
 {
-    const auto descriptorType    = vk::BufferUsageToDescriptorType(buffer.GetUsage(), bIsDynamic);
-    const auto descriptorBinding = ToUnderlying(descriptorType);
-    auto&      offsetPoolPackage = descriptorPoolPackage.OffsetPoolPackages[descriptorBinding];
-
-    auto&  allocatedSlots = offsetPoolPackage.AllocatedSlots;
-    size_t slotOffset;
+    const auto descriptorType = vk::BufferUsageToDescriptorType(buffer.GetUsage(), bIsDynamic);
+    Descriptor descriptor     = AllocateDescriptor(descriptorType);
+    if (!descriptor)
     {
-        std::lock_guard               lock{offsetPoolPackage.Mutex};
-        const FixedOffsetPool::Slot_t allocatedSlot = offsetPoolPackage.Pool.Allocate();
-        slotOffset                                  = allocatedSlot.Offset;
-        allocatedSlots[slotOffset]                  = allocatedSlot;
+        return nullptr;
     }
 
-    // Add new write descriptor set to write descriptor set list
+    EnqueueWrite(descriptorType, static_cast<uint32_t>(descriptor->Offset), buffer.GetDescriptorInfo());
+    return descriptor;
+}
+
+Descriptor DescriptorAllocator::RequestDescriptor(const vk::Buffer& buffer, const VkDeviceSize offset, const VkDeviceSize range)
+{
+    SY_ASSERT(offset + range <= buffer.GetAlignedSize(), "Descriptor range is out of buffer.");
+    const auto descriptorType = vk::BufferUsageToDescriptorType(buffer.GetUsage(), false);
+    Descriptor descriptor     = AllocateDescriptor(descriptorType);
+    if (!descriptor)
     {
-        std::lock_guard lock{bufferWriteDescriptorMutex};
-
-        const VkWriteDescriptorSet writeDescriptorSet{
-            .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-            .pNext            = nullptr,
-            .dstSet           = GetDescriptorSet(),
-            .dstBinding       = descriptorBinding,
-            .dstArrayElement  = static_cast<uint32_t>(slotOffset),
-            .descriptorCount  = 1,
-            .descriptorType   = ToNative(descriptorType),
-            .pImageInfo       = nullptr,
-            .pTexelBufferView = nullptr};
-
-        bufferInfos.emplace_back(buffer.GetDescriptorInfo());
-        bufferWriteDescriptors.emplace_back(writeDescriptorSet);
+        return nullptr;
     }
 
-    return {
-        &allocatedSlots[slotOffset],
-        [this, &offsetPoolPackage](const FixedOffsetPool::Slot_t* slotPtr) {
-            auto&           pendingList      = pendingDeallocations[frameTracker.GetFrameIndex()];
-            auto&           pendingListMutex = pendingMutexList[frameTracker.GetFrameIndex()];
-            std::lock_guard lock{pendingListMutex};
-            pendingList.emplace_back(*slotPtr, offsetPoolPackage);
-        }};
+    EnqueueWrite(descriptorType, static_cast<uint32_t>(descriptor->Offset), VkDescriptorBufferInfo{buffer.GetNative(), offset, range});
+    return descriptor;
 }
 
 Descriptor DescriptorAllocator::RequestDescriptor(HandleManager& handleManager, const Handle<Buffer> handle, bool bIsDynamic)
@@ -232,51 +243,34 @@ Descriptor DescriptorAllocator::RequestDescriptor(HandleManager& handleManager,
 
 Descriptor DescriptorAllocator::RequestDescriptor(const vk::Texture& texture, const TextureView& view, const Sampler& sampler, const ETextureState expectedState, const bool bIsCombinedSampler)
 {
-    const auto descriptorType    = vk::ImageUsageToDescriptorType(texture.GetUsage(), bIsCombinedSampler);
-    const auto descriptorBinding = ToUnderlying(descriptorType);
-    auto&      offsetPoolPackage = descriptorPoolPackage.OffsetPoolPackages[descriptorBinding];
+    const auto descriptorType = vk::ImageUsageToDescriptorType(texture.GetUsage(), bIsCombinedSampler);
+    Descriptor descriptor     = AllocateDescriptor(descriptorType);
+    if (!descriptor)
+    {
+        return nullptr;
+    }
+
+    EnqueueTextureWrite(descriptorType, descriptor->Offset, view, sampler, expectedState);
+    return descriptor;
+}
 
-    auto&  allocatedSlots = offsetPoolPackage.AllocatedSlots;
-    size_t slotOffset;
+bool DescriptorAllocator::UpdateDescriptor(Descriptor& descriptor, const Texture& texture, const TextureView& view, const Sampler& sampler, const ETextureState expectedState, const bool bIsCombinedSampler)
+{
+    SY_ASSERT(descriptor, "Trying to update invalid descriptor.");
+    if (!descriptor)
     {
-        std::lock_guard               lock{offsetPoolPackage.Mutex};
-        const FixedOffsetPool::Slot_t allocatedSlot = offsetPoolPackage.Pool.Allocate();
-        slotOffset                                  = allocatedSlot.Offset;
-        allocatedSlots[slotOffset]                  = allocatedSlot;
+        return false;
     }
 
-    // Add new write descriptor set to write descriptor set list
+    Descriptor newDescriptor = RequestDescriptor(texture, view, sampler, expectedState, bIsCombinedSampler);
+    if (!newDescriptor)
     {
-        std::lock_guard lock{imageWriteDescriptorMutex};
-
-        const VkWriteDescriptorSet writeDescriptorSet{
-            .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-            .pNext            = nullptr,
-            .dstSet           = GetDescriptorSet(),
-            .dstBinding       = descriptorBinding,
-            .dstArrayElement  = static_cast<uint32_t>(slotOffset),
-            .descriptorCount  = 1,
-            .descriptorType   = ToNative(descriptorType),
-            .pImageInfo       = nullptr,
-            .pTexelBufferView = nullptr};
-
-        const auto [pipelineStage, accessFlag, layout] = QueryAccessPattern(expectedState);
-        const VkDescriptorImageInfo descriptorImageInfo{
-            .sampler     = sampler.GetNative(),
-            .imageView   = view.GetNative(),
-            .imageLayout = layout};
-        imageInfos.emplace_back(descriptorImageInfo);
-        imageWriteDescriptors.emplace_back(writeDescriptorSet);
+        return false;
     }
 
-    return {
-        &allocatedSlots[slotOffset],
-        [this, &offsetPoolPackage](const FixedOffsetPool::Slot_t* slotPtr) {
-            auto&           pendingList      = pendingDeallocations[frameTracker.GetFrameIndex()];
-            auto&           pendingListMutex = pendingMutexList[frameTracker.GetFrameIndex()];
-            std::lock_guard lock{pendingListMutex};
-            pendingList.emplace_back(*slotPtr, offsetPoolPackage);
-        }};
+    /** Previous slot is freed at current frame, and slot allocator holds it until every in-flight frames which could use it are completed. */
+    descriptor = std::move(newDescriptor);
+    return true;
 }
 
 Descriptor DescriptorAllocator::RequestDescriptor(HandleManager& handleManager, const Handle<Texture> texture, const Handle<TextureView> view, const Handle<Sampler> sampler, const ETextureState expectedState, const bool bIsCombinedSampler)
@@ -306,5 +300,169 @@ Descriptor DescriptorAllocator::RequestDescriptor(HandleManager& handleManager,
     return RequestDescriptor(*texture, *view, *sampler, expectedState, bIsCombinedSampler);
 }
 
+DescriptorAllocator::BindingCapacities DescriptorAllocator::CalculateBindingCapacities(const VkPhysicalDeviceDescriptorIndexingProperties& properties)
+{
+    const auto limitOf = [](const uint32_t setLimit, const uint32_t perStageLimit, const size_t numSharedBindings) {
+        return static_cast<size_t>(std::min(setLimit, perStageLimit)) / numSharedBindings;
+    };
+
+    BindingCapacities capacities{};
+    /** Combined image sampler is counted as both of sampled image and sampler. */
+    const size_t sampledImages = limitOf(properties.maxDescriptorSetUpdateAfterBindSampledImages, properties.maxPerStageDescriptorUpdateAfterBindSampledImages, 2);
+
+    capacities[ToUnderlying(EDescriptorType::SampledImage)]         = sampledImages;
+    capacities[ToUnderlying(EDescriptorType::CombinedImageSampler)] = std::min(sampledImages, limitOf(properties.maxDescriptorSetUpdateAfterBindSamplers, properties.maxPerStageDescriptorUpdateAfterBindSamplers, 1));
+    capacities[ToUnderlying(EDescriptorType::StorageImage)]         = limitOf(properties.maxDescriptorSetUpdateAfterBindStorageImages, properties.maxPerStageDescriptorUpdateAfterBindStorageImages, 1);
+    capacities[ToUnderlying(EDescriptorType::UniformBuffer)]        = limitOf(properties.maxDescriptorSetUpdateAfterBindUniformBuffers, properties.maxPerStageDescriptorUpdateAfterBindUniformBuffers, 1);
+    capacities[ToUnderlying(EDescriptorType::StorageBuffer)]        = limitOf(properties.maxDescriptorSetUpdateAfterBindStorageBuffers, properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers, 1);
+
+    /** Every bindings are visible to all stages, so they also share per stage resource limit. */
+    const size_t maxPerBinding = std::min<size_t>(properties.maxPerStageUpdateAfterBindResources / BindlessDescriptorTypes.size(), MaxBindlessDescriptorsPerBinding);
+    for (const EDescriptorType descriptorType : BindlessDescriptorTypes)
+    {
+        size_t& capacity = capacities[ToUnderlying(descriptorType)];
+        capacity         = std::min(capacity, maxPerBinding);
+    }
+
+    return capacities;
+}
+
+DescriptorAllocator::BindingCapacities DescriptorAllocator::CalculateDescriptorBufferCapacities(const VkPhysicalDeviceLimits& limits)
+{
+    /** Layout of descriptor buffer is not created with update after bind pool, so ordinary limits are applied. */
+    VkPhysicalDeviceDescriptorIndexingProperties properties{};
+    properties.maxPerStageUpdateAfterBindResources                = limits.maxPerStageResources;
+    properties.maxDescriptorSetUpdateAfterBindSampledImages       = limits.maxDescriptorSetSampledImages;
+    properties.maxPerStageDescriptorUpdateAfterBindSampledImages  = limits.maxPerStageDescriptorSampledImages;
+    properties.maxDescriptorSetUpdateAfterBindSamplers            = limits.maxDescriptorSetSamplers;
+    properties.maxPerStageDescriptorUpdateAfterBindSamplers       = limits.maxPerStageDescriptorSamplers;
+    properties.maxDescriptorSetUpdateAfterBindStorageImages       = limits.maxDescriptorSetStorageImages;
+    properties.maxPerStageDescriptorUpdateAfterBindStorageImages  = limits.maxPerStageDescriptorStorageImages;
+    properties.maxDescriptorSetUpdateAfterBindUniformBuffers      = limits.maxDescriptorSetUniformBuffers;
+    properties.maxPerStageDescriptorUpdateAfterBindUniformBuffers = limits.maxPerStageDescriptorUniformBuffers;
+    properties.maxDescriptorSetUpdateAfterBindStorageBuffers      = limits.maxDescriptorSetStorageBuffers;
+    properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers = limits.maxPerStageDescriptorStorageBuffers;
+    return CalculateBindingCapacities(properties);
+}
+
+bool DescriptorAllocator::IsDescriptorBufferUsable(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties, const BindingCapacities& capacities)
+{
+    /** Otherwise combined image samplers are stored as array of images followed by array of samplers, which slot writes do not handle. */
+    if (properties.combinedImageSamplerDescriptorSingleArray != VK_TRUE)
+    {
+        spdlog::warn("Descriptor buffer requires split combined image sampler arrays.");
+        return false;
+    }
+
+    VkDeviceSize resourceRange = 0;
+    for (const EDescriptorType descriptorType : BindlessDescriptorTypes)
+    {
+        const size_t capacity = capacities[ToUnderlying(descriptorType)];
+        if (capacity < MaxBindlessResourcesPerDescriptor)
+        {
+            spdlog::warn("Descriptor buffer can hold only {} descriptors of {}.", capacity, magic_enum::enum_name(descriptorType));
+            return false;
+        }
+
+        resourceRange += static_cast<VkDeviceSize>(capacity) * DescriptorBuffer::QueryDescriptorSize(properties, descriptorType);
+    }
+
+    const VkDeviceSize samplerRange = static_cast<VkDeviceSize>(capacities[ToUnderlying(EDescriptorType::CombinedImageSampler)]) *
+                                      DescriptorBuffer::QueryDescriptorSize(properties, EDescriptorType::CombinedImageSampler);
+    if (resourceRange > properties.maxResourceDescriptorBufferRange || samplerRange > properties.maxSamplerDescriptorBufferRange)
+    {
+        spdlog::warn("Descriptor buffer range is not enough to hold bindless descriptors.");
+        return false;
+    }
+
+    return true;
+}
+
+VkPipelineCreateFlags DescriptorAllocator::GetPipelineCreateFlags() const
+{
+    return backend == EDescriptorBackend::DescriptorBuffer ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
+}
+
+void DescriptorAllocator::BindDescriptors(const CommandBuffer& cmdBuffer, const Pipeline& pipeline) const
+{
+    if (descriptorBuffer != nullptr)
+    {
+        cmdBuffer.BindDescriptorBuffer(descriptorBuffer->GetDeviceAddress(), descriptorBuffer->GetUsage(), pipeline);
+        return;
+    }
+
+    cmdBuffer.BindDescriptorSet(GetDescriptorSet(), pipeline);
+}
+
+DescriptorSlotAllocator::Statistics DescriptorAllocator::GetStatistics(const EDescriptorType descriptorType) const
+{
+    const BindingPackage& bindingPackage = descriptorPoolPackage.BindingPackages[ToUnderlying(descriptorType)];
+    std::lock_guard       lock{bindingPackage.Mutex};
+    return bindingPackage.SlotAllocator.GetStatistics();
+}
+
+Descriptor DescriptorAllocator::AllocateDescriptor(const EDescriptorType descriptorType)
+{
+    BindingPackage& bindingPackage = descriptorPoolPackage.BindingPackages[ToUnderlying(descriptorType)];
+    std::lock_guard lock{bindingPackage.Mutex};
+    const auto      slotOpt = bindingPackage.SlotAllocator.Allocate();
+    if (!slotOpt)
+    {
+        spdlog::error("Bindless binding {} is exhausted. Capacity: {}", magic_enum::enum_name(descriptorType), bindingPackage.SlotAllocator.GetStatistics().Capacity);
+        return nullptr;
+    }
+
+    /** Deque does not move existing slots when it grows. */
+    if (bindingPackage.Slots.size() < bindingPackage.SlotAllocator.GetStatistics().Capacity)
+    {
+        bindingPackage.Slots.resize(bindingPackage.SlotAllocator.GetStatistics().Capacity);
+    }
+
+    SlotType<void>& slot = bindingPackage.Slots[*slotOpt];
+    slot.Offset          = *slotOpt;
+    return {
+        &slot,
+        [this, &bindingPackage](const SlotType<void>* slotPtr) {
+            std::lock_guard lock{bindingPackage.Mutex};
+            bindingPackage.SlotAllocator.Free(static_cast<uint32_t>(slotPtr->Offset), frameTracker.GetFrameCounter());
+        }};
+}
+
+void DescriptorAllocator::EnqueueTextureWrite(const EDescriptorType descriptorType, const size_t slotOffset, const TextureView& view, const Sampler& sampler, const ETextureState expectedState)
+{
+    const auto [pipelineStage, accessFlag, layout] = QueryAccessPattern(expectedState);
+    const VkDescriptorImageInfo descriptorImageInfo{
+        .sampler     = sampler.GetNative(),
+        .imageView   = view.GetNative(),
+        .imageLayout = layout};
+    EnqueueWrite(descriptorType, static_cast<uint32_t>(slotOffset), descriptorImageInfo);
+}
+
+void DescriptorAllocator::EnqueueWrite(const EDescriptorType descriptorType, const uint32_t arrayElement, const VkDescriptorImageInfo& imageInfo)
+{
+    if (descriptorBuffer != nullptr)
+    {
+        /**
+         * Slot is owned by the caller and it is never rewritten while in use, since UpdateDescriptor moves to fresh slot
+         * and freed slot is recycled after in-flight frames. So it can be written right away without going through write queue.
+         */
+        descriptorBuffer->Write(descriptorType, arrayElement, imageInfo);
+        return;
+    }
+
+    writeQueue.Enqueue(descriptorType, arrayElement, imageInfo);
+}
+
+void DescriptorAllocator::EnqueueWrite(const EDescriptorType descriptorType, const uint32_t arrayElement, const VkDescriptorBufferInfo& bufferInfo)
+{
+    if (descriptorBuffer != nullptr)
+    {
+        descriptorBuffer->Write(descriptorType, arrayElement, bufferInfo);
+        return;
+    }
+
+    writeQueue.Enqueue(descriptorType, arrayElement, bufferInfo);
+}
+
 } // namespace vk
 } // namespace sy
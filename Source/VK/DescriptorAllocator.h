@@ -1,5 +1,7 @@
 #pragma once
 #include <PCH.h>
+#include <VK/DescriptorSlotAllocator.h>
+#include <VK/DescriptorWriteQueue.h>
 
 namespace sy::vk
 {
@@ -9,6 +11,9 @@ class Texture;
 class TextureView;
 class Sampler;
 class FrameTracker;
+class DescriptorBuffer;
+class CommandBuffer;
+class Pipeline;
 class DescriptorAllocator final : public Subsystem
 {
 public:
@@ -76,25 +81,30 @@ public:
         std::array<size_t, ToUnderlying(EDescriptorType::EnumMax)> poolSizes;
     };
 
-    struct OffsetPoolPackage
+    struct BindingPackage
     {
-        FixedOffsetPool                      Pool;
-        std::vector<FixedOffsetPool::Slot_t> AllocatedSlots;
-        std::mutex                           Mutex;
+        DescriptorSlotAllocator SlotAllocator;
+        /** Descriptors point to these slots, so slots must not be moved when allocator grows. */
+        std::deque<SlotType<void>> Slots;
+        mutable std::mutex         Mutex;
     };
 
     struct PoolPackage
     {
-        VkDescriptorPool                                                      DescriptorPool = VK_NULL_HANDLE;
-        VkDescriptorSet                                                       DescriptorSet  = VK_NULL_HANDLE;
-        std::array<OffsetPoolPackage, ToUnderlying(EDescriptorType::EnumMax)> OffsetPoolPackages;
+        VkDescriptorPool                                                   DescriptorPool = VK_NULL_HANDLE;
+        VkDescriptorSet                                                    DescriptorSet  = VK_NULL_HANDLE;
+        std::array<BindingPackage, ToUnderlying(EDescriptorType::EnumMax)> BindingPackages;
     };
 
-    struct Allocation
-    {
-        FixedOffsetPool::Slot_t AllocatedSlot;
-        OffsetPoolPackage&      Owner;
-    };
+    using BindingCapacities = std::array<size_t, ToUnderlying(EDescriptorType::EnumMax)>;
+
+    /** Descriptor types which are declared in bindless layout. Binding index is equal to the descriptor type. */
+    constexpr static std::array BindlessDescriptorTypes = {
+        EDescriptorType::SampledImage,
+        EDescriptorType::CombinedImageSampler,
+        EDescriptorType::StorageImage,
+        EDescriptorType::UniformBuffer,
+        EDescriptorType::StorageBuffer};
 
 public:
     DescriptorAllocator(VulkanContext& vulkanContext, const FrameTracker& frameTracker);
@@ -106,37 +116,78 @@ public:
     void BeginFrame();
     void EndFrame();
 
+    /** Must be set before startup. Descriptor buffer is used only if the device supports it, otherwise it falls back to descriptor set. */
+    void SetPreferredBackend(const EDescriptorBackend backend)
+    {
+        preferredBackend = backend;
+    }
+
+    [[nodiscard]] EDescriptorBackend GetBackend() const
+    {
+        return backend;
+    }
+
+    /** Pipelines which use bindless layout must be created with these flags. */
+    [[nodiscard]] VkPipelineCreateFlags GetPipelineCreateFlags() const;
+    void                                BindDescriptors(const CommandBuffer& cmdBuffer, const Pipeline& pipeline) const;
+
     [[nodiscard]] VkDescriptorSetLayout GetDescriptorSetLayout() const
     {
         return bindlessLayout;
     }
 
+    /** Null if descriptor buffer backend is used. */
     [[nodiscard]] VkDescriptorSet GetDescriptorSet() const
     {
         return descriptorPoolPackage.DescriptorSet;
     }
 
+    /**
+     * Capacity of each bindless binding from update-after-bind limits of device. (maxDescriptorSetUpdateAfterBind*, maxPerStageDescriptorUpdateAfterBind*)
+     * Limit which is shared by multiple bindings is split evenly between them, and capacity never exceeds MaxBindlessDescriptorsPerBinding.
+     */
+    [[nodiscard]] static BindingCapacities CalculateBindingCapacities(const VkPhysicalDeviceDescriptorIndexingProperties& properties);
+    /** Capacity of each binding of descriptor buffer, from ordinary descriptor limits of device. */
+    [[nodiscard]] static BindingCapacities CalculateDescriptorBufferCapacities(const VkPhysicalDeviceLimits& limits);
+    /** Descriptor buffer must hold at least MaxBindlessResourcesPerDescriptor descriptors per binding, within descriptor buffer ranges of device. */
+    [[nodiscard]] static bool IsDescriptorBufferUsable(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties, const BindingCapacities& capacities);
+    [[nodiscard]] DescriptorSlotAllocator::Statistics GetStatistics(EDescriptorType descriptorType) const;
+    [[nodiscard]] DescriptorWriteQueue::Statistics GetWriteStatistics() const { return writeQueue.GetStatistics(); }
+
+    /** Returns null descriptor if binding of the descriptor type is exhausted. */
     Descriptor RequestDescriptor(const Buffer& buffer, bool bIsDynamic = false);
+    /** Descriptor of sub range of the buffer. Offset must be aligned to min offset alignment of the descriptor type. */
+    Descriptor RequestDescriptor(const Buffer& buffer, VkDeviceSize offset, VkDeviceSize range);
 	// #deprecated
     Descriptor RequestDescriptor(HandleManager& handleManager, Handle<Buffer> handle, bool bIsDynamic = false);
     Descriptor RequestDescriptor(const Texture& texture, const TextureView& view, const Sampler& sampler, ETextureState expectedState, bool bIsCombinedSampler = true);
 	// #deprecated
     Descriptor RequestDescriptor(HandleManager& handleManager, Handle<Texture> texture, Handle<TextureView> view, Handle<Sampler> sampler, ETextureState expectedState, bool bIsCombinedSampler = true);
 
+    /**
+     * Moves descriptor to a fresh slot which refers the new texture. In-flight frames may still read previous slot, so it is never rewritten;
+     * it is retired and recycled after NumMaxInFlightFrames frames. Descriptor keeps previous slot and returns false if binding is exhausted.
+     */
+    bool UpdateDescriptor(Descriptor& descriptor, const Texture& texture, const TextureView& view, const Sampler& sampler, ETextureState expectedState, bool bIsCombinedSampler = true);
+
+private:
+    Descriptor AllocateDescriptor(EDescriptorType descriptorType);
+    void EnqueueWrite(EDescriptorType descriptorType, uint32_t arrayElement, const VkDescriptorImageInfo& imageInfo);
+    void EnqueueWrite(EDescriptorType descriptorType, uint32_t arrayElement, const VkDescriptorBufferInfo& bufferInfo);
+    void EnqueueTextureWrite(EDescriptorType descriptorType, size_t slotOffset, const TextureView& view, const Sampler& sampler, ETextureState expectedState);
+
 private:
-    VulkanContext&                                            vulkanContext;
-    const FrameTracker&                                       frameTracker;
-    VkDescriptorSetLayout                                     bindlessLayout = VK_NULL_HANDLE;
-    PoolPackage                                               descriptorPoolPackage;
-    std::array<std::vector<Allocation>, NumMaxInFlightFrames> pendingDeallocations;
-    std::array<std::mutex, NumMaxInFlightFrames>              pendingMutexList;
-
-    std::vector<VkWriteDescriptorSet>   combinedWriteDescriptorSets;
-    std::vector<VkWriteDescriptorSet>   imageWriteDescriptors;
-    std::vector<VkDescriptorImageInfo>  imageInfos;
-    std::mutex                          imageWriteDescriptorMutex;
-    std::vector<VkWriteDescriptorSet>   bufferWriteDescriptors;
-    std::vector<VkDescriptorBufferInfo> bufferInfos;
-    std::mutex                          bufferWriteDescriptorMutex;
+    VulkanContext&        vulkanContext;
+    const FrameTracker&   frameTracker;
+    VkDescriptorSetLayout bindlessLayout = VK_NULL_HANDLE;
+    PoolPackage           descriptorPoolPackage;
+    EDescriptorBackend    preferredBackend = EDescriptorBackend::DescriptorBuffer;
+    EDescriptorBackend    backend          = EDescriptorBackend::DescriptorSet;
+
+    std::unique_ptr<DescriptorBuffer> descriptorBuffer;
+
+    /** Descriptor writes of descriptor set backend are applied at BeginFrame, before the frame records any command. */
+    DescriptorWriteQueue        writeQueue;
+    DescriptorWriteQueue::Batch writeBatch;
 };
 } // namespace sy::vk
@@ -0,0 +1,150 @@
+#include <PCH.h>
+#include <VK/DescriptorBuffer.h>
+#include <VK/VulkanContext.h>
+#include <VK/VulkanRHI.h>
+
+namespace sy::vk
+{
+DescriptorBuffer::DescriptorBuffer(VulkanContext& vulkanContext, const VkDescriptorSetLayout layout, const std::span<const EDescriptorType> bindingTypes) :
+    vulkanContext(vulkanContext)
+{
+    const auto& vulkanRHI  = vulkanContext.GetRHI();
+    const auto& properties = vulkanRHI.GetDescriptorBufferProperties();
+    vkGetDescriptorSetLayoutSizeEXT(vulkanRHI.GetDevice(), layout, &size);
+    for (const EDescriptorType descriptorType : bindingTypes)
+    {
+        descriptorSizes[ToUnderlying(descriptorType)] = QueryDescriptorSize(properties, descriptorType);
+        vkGetDescriptorSetLayoutBindingOffsetEXT(vulkanRHI.GetDevice(), layout, ToUnderlying(descriptorType), &bindingOffsets[ToUnderlying(descriptorType)]);
+    }
+
+    const VkBufferCreateInfo createInfo{
+        .sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext       = nullptr,
+        .flags       = 0,
+        .size        = size,
+        .usage       = Usage,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE};
+
+    /** Persistently mapped; host only writes descriptors, so write combined memory is preferred. */
+    const VmaAllocationCreateInfo allocationCreateInfo{
+        .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT,
+        .usage = VMA_MEMORY_USAGE_AUTO};
+
+    VmaAllocationInfo allocationInfo{};
+    VK_ASSERT(vmaCreateBuffer(vulkanRHI.GetAllocator(), &createInfo, &allocationCreateInfo, &buffer, &allocation, &allocationInfo),
+              "Failed to create descriptor buffer.");
+    vulkanRHI.SetObjectName(reinterpret_cast<uint64_t>(buffer), VK_OBJECT_TYPE_BUFFER, "Bindless Descriptor Buffer");
+    mappedData = static_cast<std::byte*>(allocationInfo.pMappedData);
+
+    const VkBufferDeviceAddressInfo addressInfo{
+        .sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .pNext  = nullptr,
+        .buffer = buffer};
+    deviceAddress = vkGetBufferDeviceAddress(vulkanRHI.GetDevice(), &addressInfo);
+    spdlog::trace("Descriptor buffer: {} bytes.", size);
+}
+
+DescriptorBuffer::~DescriptorBuffer()
+{
+    vmaDestroyBuffer(vulkanContext.GetRHI().GetAllocator(), buffer, allocation);
+}
+
+void DescriptorBuffer::Write(const EDescriptorType descriptorType, const uint32_t arrayElement, const VkDescriptorImageInfo& imageInfo)
+{
+    VkDescriptorGetInfoEXT getInfo{
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+        .pNext = nullptr,
+        .type  = ToNative(descriptorType)};
+
+    switch (descriptorType)
+    {
+        case EDescriptorType::SampledImage:
+            getInfo.data.pSampledImage = &imageInfo;
+            break;
+        case EDescriptorType::CombinedImageSampler:
+            getInfo.data.pCombinedImageSampler = &imageInfo;
+            break;
+        case EDescriptorType::StorageImage:
+            getInfo.data.pStorageImage = &imageInfo;
+            break;
+        default:
+            SY_ASSERT(false, "Descriptor type {} is not an image descriptor.", magic_enum::enum_name(descriptorType));
+            return;
+    }
+
+    Write(descriptorType, arrayElement, getInfo);
+}
+
+void DescriptorBuffer::Write(const EDescriptorType descriptorType, const uint32_t arrayElement, const VkDescriptorBufferInfo& bufferInfo)
+{
+    const VkBufferDeviceAddressInfo bufferAddressInfo{
+        .sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .pNext  = nullptr,
+        .buffer = bufferInfo.buffer};
+
+    const VkDescriptorAddressInfoEXT addressInfo{
+        .sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+        .pNext   = nullptr,
+        .address = vkGetBufferDeviceAddress(vulkanContext.GetRHI().GetDevice(), &bufferAddressInfo) + bufferInfo.offset,
+        .range   = bufferInfo.range,
+        .format  = VK_FORMAT_UNDEFINED};
+
+    VkDescriptorGetInfoEXT getInfo{
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+        .pNext = nullptr,
+        .type  = ToNative(descriptorType)};
+
+    switch (descriptorType)
+    {
+        case EDescriptorType::UniformBuffer:
+            getInfo.data.pUniformBuffer = &addressInfo;
+            break;
+        case EDescriptorType::StorageBuffer:
+            getInfo.data.pStorageBuffer = &addressInfo;
+            break;
+        default:
+            SY_ASSERT(false, "Descriptor type {} is not a buffer descriptor.", magic_enum::enum_name(descriptorType));
+            return;
+    }
+
+    Write(descriptorType, arrayElement, getInfo);
+}
+
+void DescriptorBuffer::Write(const EDescriptorType descriptorType, const uint32_t arrayElement, const VkDescriptorGetInfoEXT& getInfo)
+{
+    const size_t       descriptorSize = descriptorSizes[ToUnderlying(descriptorType)];
+    const VkDeviceSize offset         = bindingOffsets[ToUnderlying(descriptorType)] + static_cast<VkDeviceSize>(arrayElement) * descriptorSize;
+    SY_ASSERT(descriptorSize > 0, "Descriptor type {} is not declared in descriptor buffer.", magic_enum::enum_name(descriptorType));
+    SY_ASSERT(offset + descriptorSize <= size, "Descriptor {} of {} is out of descriptor buffer.", arrayElement, magic_enum::enum_name(descriptorType));
+
+    const auto& vulkanRHI = vulkanContext.GetRHI();
+    vkGetDescriptorEXT(vulkanRHI.GetDevice(), &getInfo, descriptorSize, mappedData + offset);
+    /** No-op on host coherent memory. */
+    vmaFlushAllocation(vulkanRHI.GetAllocator(), allocation, offset, descriptorSize);
+    numWrites.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t DescriptorBuffer::QueryDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties, const EDescriptorType descriptorType)
+{
+    switch (descriptorType)
+    {
+        case EDescriptorType::Sampler:
+            return properties.samplerDescriptorSize;
+        case EDescriptorType::SampledImage:
+            return properties.sampledImageDescriptorSize;
+        case EDescriptorType::CombinedImageSampler:
+            return properties.combinedImageSamplerDescriptorSize;
+        case EDescriptorType::StorageImage:
+            return properties.storageImageDescriptorSize;
+        case EDescriptorType::UniformBuffer:
+            return properties.uniformBufferDescriptorSize;
+        case EDescriptorType::StorageBuffer:
+            return properties.storageBufferDescriptorSize;
+        case EDescriptorType::InputAttachment:
+            return properties.inputAttachmentDescriptorSize;
+        default:
+            /** Dynamic buffers are not allowed in descriptor buffer. */
+            return 0;
+    }
+}
+} // namespace sy::vk
@@ -0,0 +1,49 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::vk
+{
+/**
+ * Host visible buffer which stores descriptors of single set layout, for VK_EXT_descriptor_buffer.
+ * Descriptor is written directly into persistently mapped memory by vkGetDescriptorEXT, so writes need no lock
+ * as long as each thread writes different slot; DescriptorAllocator guarantees it by slot allocation.
+ * Writes are visible to GPU right away, so slot must not be written while any in-flight frame may read it.
+ */
+class DescriptorBuffer final : public NonCopyable
+{
+public:
+    /** Binding index of each descriptor type is equal to the descriptor type, as bindless layout of DescriptorAllocator. */
+    DescriptorBuffer(VulkanContext& vulkanContext, VkDescriptorSetLayout layout, std::span<const EDescriptorType> bindingTypes);
+    ~DescriptorBuffer() override;
+
+    void Write(EDescriptorType descriptorType, uint32_t arrayElement, const VkDescriptorImageInfo& imageInfo);
+    void Write(EDescriptorType descriptorType, uint32_t arrayElement, const VkDescriptorBufferInfo& bufferInfo);
+
+    [[nodiscard]] VkDeviceAddress    GetDeviceAddress() const { return deviceAddress; }
+    [[nodiscard]] VkBufferUsageFlags GetUsage() const { return Usage; }
+    [[nodiscard]] VkDeviceSize       GetSize() const { return size; }
+    [[nodiscard]] size_t             GetNumWrites() const { return numWrites.load(std::memory_order_relaxed); }
+
+    /** Returns zero if descriptor type can not be stored in descriptor buffer. */
+    [[nodiscard]] static size_t QueryDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties, EDescriptorType descriptorType);
+
+private:
+    void Write(EDescriptorType descriptorType, uint32_t arrayElement, const VkDescriptorGetInfoEXT& getInfo);
+
+private:
+    /** Combined image sampler embeds sampler, so the buffer also has to be sampler descriptor buffer. */
+    constexpr static VkBufferUsageFlags Usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                                                VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    VulkanContext&  vulkanContext;
+    VkBuffer        buffer        = VK_NULL_HANDLE;
+    VmaAllocation   allocation    = VK_NULL_HANDLE;
+    std::byte*      mappedData    = nullptr;
+    VkDeviceAddress deviceAddress = 0;
+    VkDeviceSize    size          = 0;
+
+    std::array<VkDeviceSize, ToUnderlying(EDescriptorType::EnumMax)> bindingOffsets{};
+    std::array<size_t, ToUnderlying(EDescriptorType::EnumMax)>       descriptorSizes{};
+    std::atomic<size_t>                                              numWrites = 0;
+};
+} // namespace sy::vk
@@ -0,0 +1,76 @@
+#include <PCH.h>
+#include <VK/DescriptorSlotAllocator.h>
+
+namespace sy::vk
+{
+DescriptorSlotAllocator::DescriptorSlotAllocator() :
+    DescriptorSlotAllocator(0, 0)
+{
+}
+
+DescriptorSlotAllocator::DescriptorSlotAllocator(const size_t initialCapacity, const size_t maxCapacity)
+{
+    SY_ASSERT(initialCapacity <= maxCapacity, "Initial capacity exceeds max capacity.");
+    SY_ASSERT(maxCapacity <= std::numeric_limits<uint32_t>::max(), "Max capacity exceeds range of slot.");
+    statistics.MaxCapacity = maxCapacity;
+    Grow(initialCapacity);
+    statistics.NumGrows = 0;
+}
+
+std::optional<uint32_t> DescriptorSlotAllocator::Allocate()
+{
+    if (freeSlots.empty())
+    {
+        if (statistics.Capacity >= statistics.MaxCapacity)
+        {
+            ++statistics.NumFailedAllocations;
+            return std::nullopt;
+        }
+
+        Grow(std::clamp<size_t>(statistics.Capacity * 2, 1, statistics.MaxCapacity));
+    }
+
+    const uint32_t slot = freeSlots.top();
+    freeSlots.pop();
+    slotStates[slot] = ESlotState::Allocated;
+
+    ++statistics.NumAllocated;
+    statistics.HighWaterMark = std::max(statistics.HighWaterMark, statistics.NumAllocated);
+    return slot;
+}
+
+void DescriptorSlotAllocator::Free(const uint32_t slot, const size_t frameCounter)
+{
+    SY_ASSERT(slot < slotStates.size() && slotStates[slot] == ESlotState::Allocated, "Slot {} is not allocated.", slot);
+    SY_ASSERT(pendingFrees.empty() || pendingFrees.back().FreedFrame <= frameCounter, "Frame counter must not go backward.");
+    slotStates[slot] = ESlotState::PendingFree;
+    pendingFrees.emplace_back(PendingFree{.FreedFrame = frameCounter, .Slot = slot});
+    ++statistics.NumPendingFrees;
+}
+
+void DescriptorSlotAllocator::BeginFrame(const size_t frameCounter)
+{
+    while (!pendingFrees.empty() && pendingFrees.front().FreedFrame + NumMaxInFlightFrames <= frameCounter)
+    {
+        const uint32_t slot = pendingFrees.front().Slot;
+        slotStates[slot]    = ESlotState::Free;
+        freeSlots.push(slot);
+        pendingFrees.pop_front();
+
+        --statistics.NumAllocated;
+        --statistics.NumPendingFrees;
+    }
+}
+
+void DescriptorSlotAllocator::Grow(const size_t newCapacity)
+{
+    for (size_t slot = statistics.Capacity; slot < newCapacity; ++slot)
+    {
+        freeSlots.push(static_cast<uint32_t>(slot));
+    }
+
+    slotStates.resize(newCapacity, ESlotState::Free);
+    statistics.Capacity = newCapacity;
+    ++statistics.NumGrows;
+}
+} // namespace sy::vk
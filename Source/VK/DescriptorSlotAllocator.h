@@ -0,0 +1,67 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::vk
+{
+/**
+ * CPU-only slot allocator of single bindless binding; it does not touch any vulkan object.
+ * Freed slot is recycled only after NumMaxInFlightFrames frames have passed since the free, since GPU may still access the descriptor until then.
+ * Frames are counted by monotonic frame counter, so slot freed before BeginFrame of a frame is not recycled by that BeginFrame.
+ * Lowest free slot is allocated first to keep occupied range compact, and capacity is doubled when full, up to max capacity.
+ */
+class DescriptorSlotAllocator
+{
+public:
+    struct Statistics
+    {
+        size_t Capacity             = 0;
+        size_t MaxCapacity          = 0;
+        /** Slots which are not free, including pending frees. */
+        size_t NumAllocated         = 0;
+        size_t NumPendingFrees      = 0;
+        size_t HighWaterMark        = 0;
+        size_t NumGrows             = 0;
+        size_t NumFailedAllocations = 0;
+    };
+
+public:
+    DescriptorSlotAllocator();
+    DescriptorSlotAllocator(size_t initialCapacity, size_t maxCapacity);
+
+    /** Returns empty if every slots up to max capacity are in use. */
+    [[nodiscard]] std::optional<uint32_t> Allocate();
+    void Free(uint32_t slot, size_t frameCounter);
+    /** Must be called after waiting in-flight frame of the frame counter. Recycles slots freed at least NumMaxInFlightFrames frames ago. */
+    void BeginFrame(size_t frameCounter);
+
+    [[nodiscard]] bool IsAllocated(uint32_t slot) const { return slot < slotStates.size() && slotStates[slot] != ESlotState::Free; }
+    [[nodiscard]] const Statistics& GetStatistics() const { return statistics; }
+    [[nodiscard]] double GetOccupancy() const
+    {
+        return statistics.Capacity > 0 ? static_cast<double>(statistics.NumAllocated) / static_cast<double>(statistics.Capacity) : 0.0;
+    }
+
+private:
+    enum class ESlotState : uint8_t
+    {
+        Free,
+        Allocated,
+        PendingFree
+    };
+
+    struct PendingFree
+    {
+        size_t   FreedFrame = 0;
+        uint32_t Slot       = 0;
+    };
+
+    void Grow(size_t newCapacity);
+
+private:
+    std::vector<ESlotState>                                              slotStates;
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<>> freeSlots;
+    /** Ordered by freed frame. */
+    std::deque<PendingFree>                                              pendingFrees;
+    Statistics                                                           statistics;
+};
+} // namespace sy::vk
@@ -0,0 +1,139 @@
+#include <PCH.h>
+#include <VK/DescriptorWriteQueue.h>
+
+namespace sy::vk
+{
+namespace
+{
+std::atomic<uint64_t> NextQueueId = 0;
+}
+
+DescriptorWriteQueue::DescriptorWriteQueue() :
+    id(NextQueueId.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+DescriptorWriteQueue::~DescriptorWriteQueue()
+{
+}
+
+void DescriptorWriteQueue::Enqueue(const EDescriptorType descriptorType, const uint32_t arrayElement, const VkDescriptorImageInfo& imageInfo)
+{
+    Enqueue(Write{.Sequence = 0, .DescriptorType = descriptorType, .ArrayElement = arrayElement, .Info = imageInfo});
+}
+
+void DescriptorWriteQueue::Enqueue(const EDescriptorType descriptorType, const uint32_t arrayElement, const VkDescriptorBufferInfo& bufferInfo)
+{
+    Enqueue(Write{.Sequence = 0, .DescriptorType = descriptorType, .ArrayElement = arrayElement, .Info = bufferInfo});
+}
+
+void DescriptorWriteQueue::Enqueue(Write&& write)
+{
+    ThreadQueue&     threadQueue = GetThreadQueue();
+    std::unique_lock lock{threadQueue.Mutex, std::try_to_lock};
+    if (!lock.owns_lock())
+    {
+        lock.lock();
+        ++threadQueue.NumContendedEnqueues;
+    }
+
+    write.Sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+    threadQueue.Writes.emplace_back(std::move(write));
+    ++threadQueue.NumEnqueued;
+}
+
+DescriptorWriteQueue::ThreadQueue& DescriptorWriteQueue::GetThreadQueue()
+{
+    thread_local robin_hood::unordered_map<uint64_t, ThreadQueue*> localThreadQueues;
+    ThreadQueue*& threadQueue = localThreadQueues[id];
+    if (threadQueue == nullptr)
+    {
+        RWLock lock{threadQueueMutex};
+        threadQueue = threadQueues.emplace_back(std::make_unique<ThreadQueue>()).get();
+    }
+
+    return *threadQueue;
+}
+
+void DescriptorWriteQueue::Flush(const VkDescriptorSet dstSet, Batch& batch)
+{
+    batch.Clear();
+    drainedWrites.clear();
+    {
+        ReadOnlyLock lock{threadQueueMutex};
+        for (const auto& threadQueue : threadQueues)
+        {
+            std::lock_guard queueLock{threadQueue->Mutex};
+            drainedWrites.insert(drainedWrites.end(),
+                                 std::make_move_iterator(threadQueue->Writes.begin()),
+                                 std::make_move_iterator(threadQueue->Writes.end()));
+            threadQueue->Writes.clear();
+        }
+    }
+
+    /** Latest write of each slot comes first, so the rest of same slot can be skipped. */
+    std::sort(drainedWrites.begin(), drainedWrites.end(),
+              [](const Write& lhs, const Write& rhs) {
+                  return std::tie(lhs.DescriptorType, lhs.ArrayElement, rhs.Sequence) < std::tie(rhs.DescriptorType, rhs.ArrayElement, lhs.Sequence);
+              });
+
+    /** Reserved up front, so info pointers stay valid while batch is filled. */
+    batch.Writes.reserve(drainedWrites.size());
+    batch.ImageInfos.reserve(drainedWrites.size());
+    batch.BufferInfos.reserve(drainedWrites.size());
+    for (size_t idx = 0; idx < drainedWrites.size(); ++idx)
+    {
+        const Write& write = drainedWrites[idx];
+        if (idx > 0 && drainedWrites[idx - 1].DescriptorType == write.DescriptorType && drainedWrites[idx - 1].ArrayElement == write.ArrayElement)
+        {
+            ++numDeduplicated;
+            continue;
+        }
+
+        VkWriteDescriptorSet writeDescriptorSet{
+            .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext            = nullptr,
+            .dstSet           = dstSet,
+            .dstBinding       = ToUnderlying(write.DescriptorType),
+            .dstArrayElement  = write.ArrayElement,
+            .descriptorCount  = 1,
+            .descriptorType   = ToNative(write.DescriptorType),
+            .pImageInfo       = nullptr,
+            .pBufferInfo      = nullptr,
+            .pTexelBufferView = nullptr};
+
+        if (const auto* imageInfo = std::get_if<VkDescriptorImageInfo>(&write.Info))
+        {
+            writeDescriptorSet.pImageInfo = &batch.ImageInfos.emplace_back(*imageInfo);
+        }
+        else
+        {
+            writeDescriptorSet.pBufferInfo = &batch.BufferInfos.emplace_back(std::get<VkDescriptorBufferInfo>(write.Info));
+        }
+
+        batch.Writes.emplace_back(writeDescriptorSet);
+    }
+
+    numFlushed += batch.Writes.size();
+    ++numFlushes;
+}
+
+DescriptorWriteQueue::Statistics DescriptorWriteQueue::GetStatistics() const
+{
+    Statistics statistics{
+        .NumDeduplicated = numDeduplicated,
+        .NumFlushed      = numFlushed,
+        .NumFlushes      = numFlushes};
+
+    ReadOnlyLock lock{threadQueueMutex};
+    statistics.NumThreadQueues = threadQueues.size();
+    for (const auto& threadQueue : threadQueues)
+    {
+        std::lock_guard queueLock{threadQueue->Mutex};
+        statistics.NumEnqueued += threadQueue->NumEnqueued;
+        statistics.NumContendedEnqueues += threadQueue->NumContendedEnqueues;
+    }
+
+    return statistics;
+}
+} // namespace sy::vk
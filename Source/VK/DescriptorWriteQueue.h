@@ -0,0 +1,87 @@
+#pragma once
+#include <PCH.h>
+
+namespace sy::vk
+{
+/**
+ * Collects descriptor writes from multiple threads and flushes them as single batch for vkUpdateDescriptorSets.
+ * Each producer thread owns its queue, so enqueue only takes lock of its own queue; the lock is contended only while Flush drains that queue.
+ * Writes to the same slot are deduplicated at flush, and the latest enqueued write wins.
+ */
+class DescriptorWriteQueue final : public NonCopyable
+{
+public:
+    struct Statistics
+    {
+        size_t NumThreadQueues      = 0;
+        size_t NumEnqueued          = 0;
+        /** Enqueues which had to wait for Flush draining the queue of the thread. */
+        size_t NumContendedEnqueues = 0;
+        size_t NumDeduplicated      = 0;
+        size_t NumFlushed           = 0;
+        size_t NumFlushes           = 0;
+    };
+
+    /** Info pointers of writes point to ImageInfos/BufferInfos, so batch must outlive vkUpdateDescriptorSets. */
+    struct Batch
+    {
+        std::vector<VkWriteDescriptorSet>   Writes;
+        std::vector<VkDescriptorImageInfo>  ImageInfos;
+        std::vector<VkDescriptorBufferInfo> BufferInfos;
+
+        void Clear()
+        {
+            Writes.clear();
+            ImageInfos.clear();
+            BufferInfos.clear();
+        }
+    };
+
+public:
+    DescriptorWriteQueue();
+    ~DescriptorWriteQueue() override;
+
+    /** Binding of the write is equal to the descriptor type, as bindless layout of DescriptorAllocator. */
+    void Enqueue(EDescriptorType descriptorType, uint32_t arrayElement, const VkDescriptorImageInfo& imageInfo);
+    void Enqueue(EDescriptorType descriptorType, uint32_t arrayElement, const VkDescriptorBufferInfo& bufferInfo);
+
+    /** Drains every thread queues into the batch. Batch is cleared first. Must not be called concurrently with other Flush. */
+    void Flush(VkDescriptorSet dstSet, Batch& batch);
+
+    /** Flush counters are owned by flushing thread, so it must not be called concurrently with Flush. */
+    [[nodiscard]] Statistics GetStatistics() const;
+
+private:
+    struct Write
+    {
+        uint64_t                                                    Sequence;
+        EDescriptorType                                             DescriptorType;
+        uint32_t                                                    ArrayElement;
+        std::variant<VkDescriptorImageInfo, VkDescriptorBufferInfo> Info;
+    };
+
+    struct ThreadQueue
+    {
+        std::mutex         Mutex;
+        std::vector<Write> Writes;
+        size_t             NumEnqueued          = 0;
+        size_t             NumContendedEnqueues = 0;
+    };
+
+    void         Enqueue(Write&& write);
+    ThreadQueue& GetThreadQueue();
+
+private:
+    /** Thread local queues are looked up by id instead of address, since address can be reused by other instance. */
+    const uint64_t        id;
+    std::atomic<uint64_t> nextSequence = 0;
+
+    mutable std::shared_mutex                 threadQueueMutex;
+    std::vector<std::unique_ptr<ThreadQueue>> threadQueues;
+
+    std::vector<Write> drainedWrites;
+    size_t             numDeduplicated = 0;
+    size_t             numFlushed      = 0;
+    size_t             numFlushes      = 0;
+};
+} // namespace sy::vk
@@ -0,0 +1,24 @@
+#include <PCH.h>
+#include <VK/Event.h>
+#include <VK/VulkanRHI.h>
+
+namespace sy::vk
+{
+Event::Event(const std::string_view name, VulkanContext& vulkanContext) :
+    VulkanWrapper<VkEvent>(name, vulkanContext, VK_OBJECT_TYPE_EVENT)
+{
+    const VkEventCreateInfo createInfo{
+        .sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = VK_EVENT_CREATE_DEVICE_ONLY_BIT};
+
+    NativeHandle handle = VK_NULL_HANDLE;
+    VK_ASSERT(vkCreateEvent(GetRHI().GetDevice(), &createInfo, nullptr, &handle), "Failed to create event.");
+
+    UpdateHandle(
+        handle,
+        [handle](const VulkanRHI& rhi) {
+            vkDestroyEvent(rhi.GetDevice(), handle, nullptr);
+        });
+}
+} // namespace sy::vk
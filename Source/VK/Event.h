@@ -0,0 +1,15 @@
+#pragma once
+#include <PCH.h>
+#include <VK/VulkanWrapper.h>
+
+namespace sy::vk
+{
+class VulkanContext;
+/** Device only event, which is set and waited by command buffers of the same queue. (Split barrier) */
+class Event : public VulkanWrapper<VkEvent>
+{
+public:
+    Event(std::string_view name, VulkanContext& vulkanContext);
+    ~Event() override = default;
+};
+} // namespace sy::vk
@@ -3,6 +3,7 @@
 #include <VK/VulkanContext.h>
 #include <VK/Fence.h>
 #include <VK/Semaphore.h>
+#include <VK/QueryPool.h>
 
 namespace sy::vk
 {
@@ -28,6 +29,7 @@ void FrameTracker::Startup()
         frame.SwapchainSemaphore = std::make_unique<Semaphore>(std::format("Swapchain Semaphore {}", frameIdx), vulkanContext, true);
         frame.PresentSemaphore = std::make_unique<Semaphore>(std::format("Present Semaphore {}", frameIdx), vulkanContext, true);
         frame.UploadSemaphore = std::make_unique<Semaphore>(std::format("Upload Semaphore {}", frameIdx), vulkanContext);
+        frame.TimestampQueryPool = std::make_unique<QueryPool>(std::format("Timestamp Query Pool {}", frameIdx), vulkanContext, VK_QUERY_TYPE_TIMESTAMP, NumMaxTimestampQueriesPerFrame);
         ++frameIdx;
     }
 }
@@ -41,6 +43,7 @@ void FrameTracker::Shutdown()
         frame.SwapchainSemaphore.reset();
         frame.PresentSemaphore.reset();
         frame.UploadSemaphore.reset();
+        frame.TimestampQueryPool.reset();
     }
 }
 
@@ -74,5 +77,10 @@ Semaphore& FrameTracker::GetCurrentInFlightUploadSemaphore()
     return *frames[GetFrameIndex()].UploadSemaphore;
 }
 
+QueryPool& FrameTracker::GetInflightTimestampQueryPool()
+{
+    return *frames[GetFrameIndex()].TimestampQueryPool;
+}
+
 
 } // namespace sy::vk
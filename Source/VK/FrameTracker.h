@@ -5,6 +5,7 @@ namespace sy::vk
 {
 class Fence;
 class Semaphore;
+class QueryPool;
 class VulkanContext;
 // todo: Should i move frame tracker to render module?
 class FrameTracker : public NonCopyable
@@ -17,6 +18,7 @@ private:
         std::unique_ptr<Semaphore> PresentSemaphore;
         std::unique_ptr<Semaphore> SwapchainSemaphore;
         std::unique_ptr<Semaphore> UploadSemaphore;
+        std::unique_ptr<QueryPool> TimestampQueryPool;
     };
 
 public:
@@ -38,6 +40,8 @@ public:
     Semaphore& GetInflightSwapchainSemaphore();
     Semaphore& GetInflightPresentSemaphore();
     Semaphore& GetCurrentInFlightUploadSemaphore();
+    /** Results of previous use are only valid until the pool is reset. */
+    QueryPool& GetInflightTimestampQueryPool();
 
     [[nodiscard]] size_t GetFrameCounter() const
     {
@@ -3,6 +3,7 @@
 #include <VK/PipelineBuilder.h>
 #include <VK/VulkanContext.h>
 #include <VK/VulkanRHI.h>
+#include <VK/DescriptorAllocator.h>
 
 namespace sy
 {
@@ -12,8 +13,10 @@ Pipeline::Pipeline(const std::string_view name, VulkanContext& vulkanContext, co
     Pipeline(name, vulkanContext, EPipelineType::Graphics, builder.GetLayout())
 {
     const auto&  vulkanRHI  = vulkanContext.GetRHI();
-    const auto   createInfo = builder.Build();
+    auto         createInfo = builder.Build();
     NativeHandle handle     = VK_NULL_HANDLE;
+    /** Every pipelines share bindless layout of descriptor allocator. */
+    createInfo.flags |= vulkanContext.GetDescriptorAllocator().GetPipelineCreateFlags();
     VK_ASSERT(vkCreateGraphicsPipelines(vulkanRHI.GetDevice(), VK_NULL_HANDLE, 1, &createInfo, nullptr, &handle),
               "Failed to create graphics pipeline {}.", name);
 
@@ -27,8 +30,9 @@ Pipeline::Pipeline(const std::string_view name, VulkanContext& vulkanContext, co
     Pipeline(name, vulkanContext, EPipelineType::Compute, builder.GetLayout())
 {
     const auto&  vulkanRHI  = vulkanContext.GetRHI();
-    const auto   createInfo = builder.Build();
+    auto         createInfo = builder.Build();
     NativeHandle handle     = VK_NULL_HANDLE;
+    createInfo.flags |= vulkanContext.GetDescriptorAllocator().GetPipelineCreateFlags();
     VK_ASSERT(vkCreateComputePipelines(vulkanRHI.GetDevice(), VK_NULL_HANDLE, 1, &createInfo, nullptr, &handle),
               "Failed to create compute pipeline {}.", name);
 
@@ -0,0 +1,49 @@
+#include <PCH.h>
+#include <VK/QueryPool.h>
+#include <VK/VulkanRHI.h>
+
+namespace sy::vk
+{
+QueryPool::QueryPool(const std::string_view name, VulkanContext& vulkanContext, const VkQueryType queryType, const uint32_t numQueries) :
+    VulkanWrapper<VkQueryPool>(name, vulkanContext, VK_OBJECT_TYPE_QUERY_POOL),
+    queryType(queryType),
+    numQueries(numQueries)
+{
+    SY_ASSERT(numQueries > 0, "Query pool {} requires at least one query.", name);
+    const VkQueryPoolCreateInfo createInfo{
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .queryType = queryType,
+        .queryCount = numQueries,
+        .pipelineStatistics = 0};
+
+    NativeHandle handle = VK_NULL_HANDLE;
+    VK_ASSERT(vkCreateQueryPool(GetRHI().GetDevice(), &createInfo, nullptr, &handle), "Failed to create query pool {}.", name);
+
+    UpdateHandle(
+        handle,
+        [handle](const VulkanRHI& rhi) {
+            vkDestroyQueryPool(rhi.GetDevice(), handle, nullptr);
+        });
+
+    /** Queries must be reset before first use. */
+    Reset(0, numQueries);
+}
+
+void QueryPool::Reset(const uint32_t firstQuery, const uint32_t numQueries) const
+{
+    SY_ASSERT(firstQuery + numQueries <= this->numQueries, "Out of range queries of query pool {}.", GetName());
+    vkResetQueryPool(GetRHI().GetDevice(), GetNative(), firstQuery, numQueries);
+}
+
+bool QueryPool::TryGetResults(const uint32_t firstQuery, const std::span<uint64_t> results) const
+{
+    SY_ASSERT(firstQuery + results.size() <= numQueries, "Out of range queries of query pool {}.", GetName());
+    const VkResult result = vkGetQueryPoolResults(GetRHI().GetDevice(), GetNative(),
+                                                  firstQuery, static_cast<uint32_t>(results.size()),
+                                                  results.size_bytes(), results.data(), sizeof(uint64_t),
+                                                  VK_QUERY_RESULT_64_BIT);
+    return result == VK_SUCCESS;
+}
+} // namespace sy::vk
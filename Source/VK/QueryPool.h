@@ -0,0 +1,26 @@
+#pragma once
+#include <PCH.h>
+#include <VK/VulkanWrapper.h>
+
+namespace sy::vk
+{
+class VulkanContext;
+class QueryPool : public VulkanWrapper<VkQueryPool>
+{
+public:
+    QueryPool(std::string_view name, VulkanContext& vulkanContext, VkQueryType queryType, uint32_t numQueries);
+    ~QueryPool() override = default;
+
+    /** Reset from host. Queries must not be in use by device. */
+    void Reset(uint32_t firstQuery, uint32_t numQueries) const;
+    /** Does not wait for device; returns false if any of queries is not available yet. */
+    [[nodiscard]] bool TryGetResults(uint32_t firstQuery, std::span<uint64_t> results) const;
+
+    [[nodiscard]] VkQueryType GetQueryType() const { return queryType; }
+    [[nodiscard]] uint32_t GetNumQueries() const { return numQueries; }
+
+private:
+    const VkQueryType queryType;
+    const uint32_t numQueries;
+};
+} // namespace sy::vk
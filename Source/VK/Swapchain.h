@@ -33,6 +33,11 @@ public:
         return currentImageIdx;
     }
 
+    [[nodiscard]] auto GetFormat() const
+    {
+        return format;
+    }
+
     [[nodiscard]] auto GetColorAttachmentInfo(VkClearColorValue clearColorValue = {0.f, 0.f, 0.f, 1.f}) const
     {
         return VkRenderingAttachmentInfoKHR{
@@ -26,42 +26,43 @@ Texture::Texture(const TextureBuilder& builder) :
     initialState(builder.targetInitialState),
     mips(builder.mips)
 {
-    const VkImageCreateInfo imageCreateInfo{
-        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-        .imageType = type,
-        .format = format,
-        .extent = VkExtent3D{
-            extent.width,
-            type != VK_IMAGE_TYPE_1D ? extent.height : 1,
-            type == VK_IMAGE_TYPE_3D ? extent.depth : 1},
-        .mipLevels = mips,
-        .arrayLayers = layers,
-        .samples = samples,
-        .tiling = tiling,
-        .usage = usage,
-        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED};
-
-    const VmaAllocationCreateInfo allocationCreateInfo{
-        .usage = memoryUsage,
-        .requiredFlags = memoryProperty};
+    const VkImageCreateInfo imageCreateInfo = BuildCreateInfo(builder);
 
     auto& vulkanContext = builder.vulkanContext;
     const auto& vulkanRHI = vulkanContext.GetRHI();
     NativeHandle handle = VK_NULL_HANDLE;
-    VK_ASSERT(vmaCreateImage(vulkanRHI.GetAllocator(),
-                             &imageCreateInfo, &allocationCreateInfo,
-                             &handle, &allocation,
-                             nullptr),
-              "Failed to create image {}.", builder.name);
-
-    UpdateHandle(
-        handle,
-        [handle, allocation = allocation](const VulkanRHI& rhi) {
-            vmaDestroyImage(rhi.GetAllocator(), handle, allocation);
-        });
+    if (builder.aliasingAllocation != VK_NULL_HANDLE)
+    {
+        /** Memory owned by someone else(ex. RenderGraph transient heap). */
+        VK_ASSERT(vkCreateImage(vulkanRHI.GetDevice(), &imageCreateInfo, nullptr, &handle),
+                  "Failed to create aliasing image {}.", builder.name);
+        VK_ASSERT(vmaBindImageMemory2(vulkanRHI.GetAllocator(), builder.aliasingAllocation, builder.aliasingOffset, handle, nullptr),
+                  "Failed to bind aliasing memory to image {}.", builder.name);
+
+        UpdateHandle(
+            handle,
+            [handle](const VulkanRHI& rhi) {
+                vkDestroyImage(rhi.GetDevice(), handle, nullptr);
+            });
+    }
+    else
+    {
+        const VmaAllocationCreateInfo allocationCreateInfo{
+            .usage = memoryUsage,
+            .requiredFlags = memoryProperty};
+
+        VK_ASSERT(vmaCreateImage(vulkanRHI.GetAllocator(),
+                                 &imageCreateInfo, &allocationCreateInfo,
+                                 &handle, &allocation,
+                                 nullptr),
+                  "Failed to create image {}.", builder.name);
+
+        UpdateHandle(
+            handle,
+            [handle, allocation = allocation](const VulkanRHI& rhi) {
+                vmaDestroyImage(rhi.GetAllocator(), handle, allocation);
+            });
+    }
 
     const bool bRequiredDataTransfer = builder.dataToTransfer.has_value();
     const bool bRequiredStateTransfer = builder.targetInitialState != ETextureState::None;
@@ -87,10 +88,9 @@ Texture::Texture(const TextureBuilder& builder) :
                                     .SetSize(builder.dataToTransfer->size_bytes())
                                     .Build();
 
-                void* mappedStagingBuffer = vulkanRHI.Map(*stagingBuffer);
-                std::memcpy(mappedStagingBuffer, builder.dataToTransfer->data(),
+                std::memcpy(stagingBuffer->GetMappedSpan().data(), builder.dataToTransfer->data(),
                             builder.dataToTransfer->size());
-                vulkanRHI.Unmap(*stagingBuffer);
+                stagingBuffer->Flush();
 
                 stateTransition.SetDestinationState(ETextureState::TransferWrite);
                 cmdBuffer->ApplyStateTransition(stateTransition);
@@ -115,4 +115,41 @@ Texture::Texture(const TextureBuilder& builder) :
         vulkanRHI.SubmitImmediateTo(*cmdBuffer);
     }
 }
+VkMemoryRequirements Texture::QueryMemoryRequirements(const TextureBuilder& builder)
+{
+    const VkImageCreateInfo imageCreateInfo = BuildCreateInfo(builder);
+    const VkDeviceImageMemoryRequirements requirementsInfo{
+        .sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS,
+        .pNext = nullptr,
+        .pCreateInfo = &imageCreateInfo,
+        .planeAspect = VK_IMAGE_ASPECT_NONE};
+
+    VkMemoryRequirements2 requirements{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+        .pNext = nullptr};
+    vkGetDeviceImageMemoryRequirements(builder.vulkanContext.GetRHI().GetDevice(), &requirementsInfo, &requirements);
+    return requirements.memoryRequirements;
+}
+
+VkImageCreateInfo Texture::BuildCreateInfo(const TextureBuilder& builder)
+{
+    const VkImageType type = *builder.type;
+    return VkImageCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = builder.aliasingAllocation != VK_NULL_HANDLE ? VK_IMAGE_CREATE_ALIAS_BIT : 0u,
+        .imageType = type,
+        .format = builder.format,
+        .extent = VkExtent3D{
+            builder.extent->width,
+            type != VK_IMAGE_TYPE_1D ? builder.extent->height : 1,
+            type == VK_IMAGE_TYPE_3D ? builder.extent->depth : 1},
+        .mipLevels = builder.mips,
+        .arrayLayers = builder.layers,
+        .samples = builder.samples,
+        .tiling = builder.tiling,
+        .usage = *builder.usage | (builder.dataToTransfer.has_value() ? VK_IMAGE_USAGE_TRANSFER_DST_BIT : 0),
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED};
+}
 } // namespace sy::vk
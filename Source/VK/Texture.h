@@ -29,6 +29,13 @@ public:
     [[nodiscard]] auto GetInitialState() const { return initialState; }
     [[nodiscard]] VkImageSubresourceRange GetFullSubresourceRange() const { return {GetImageAspect(), 0, GetMipLevels(), 0, GetArrayLayers()}; }
     [[nodiscard]] VmaAllocation GetAllocation() const { return allocation; }
+    /** Aliased texture doesn't own its memory. */
+    [[nodiscard]] bool IsAliased() const { return allocation == VK_NULL_HANDLE; }
+
+    [[nodiscard]] static VkMemoryRequirements QueryMemoryRequirements(const TextureBuilder& builder);
+
+private:
+    [[nodiscard]] static VkImageCreateInfo BuildCreateInfo(const TextureBuilder& builder);
 
 private:
     VmaAllocation allocation = VK_NULL_HANDLE;
@@ -132,8 +132,19 @@ public:
         return *this;
 	}
 
+    /** Bind to given memory instead of own dedicated allocation. Memory must outlive the texture. */
+    TextureBuilder& SetAliasingMemory(const VmaAllocation allocation, const VkDeviceSize offset)
+    {
+        aliasingAllocation = allocation;
+        aliasingOffset     = offset;
+        return *this;
+    }
+
     std::unique_ptr<Texture> Build() const;
 
+    [[nodiscard]] std::optional<Extent3D<uint32_t>> GetExtent() const { return extent; }
+    [[nodiscard]] VkSampleCountFlagBits GetSampleCount() const { return samples; }
+
 public:
     static TextureBuilder Texture2DShaderResourceTemplate(VulkanContext& vulkanContext);
     static TextureBuilder Texture2DRenderTargetTemplate(VulkanContext& vulkanContext);
@@ -156,5 +167,7 @@ private:
     ETextureState                           targetInitialState = ETextureState::None;
     std::optional<std::span<const uint8_t>> dataToTransfer     = std::nullopt;
     std::vector<VkBufferImageCopy>          copyInfos;
+    VmaAllocation                           aliasingAllocation = VK_NULL_HANDLE;
+    VkDeviceSize                            aliasingOffset     = 0;
 };
 } // namespace sy::vk
@@ -22,7 +22,8 @@ VkImageMemoryBarrier2 TextureStateTransition::Build() const
     const bool bValidStates = srcState && dstState;
     SY_ASSERT(bValidStates, "Both states are does not setup. It result in redundant transition.");
     const bool bStatesAreNotEqual = bValidStates && (*srcState != *dstState);
-    SY_ASSERT(bStatesAreNotEqual, "State are equal. It may result in redudant transition.");
+    const bool bIsQueueOwnershipTransfer = srcQueueType != dstQueueType;
+    SY_ASSERT(bStatesAreNotEqual || bIsQueueOwnershipTransfer, "State are equal. It may result in redudant transition.");
 
 	bool bIsValidNativeHandle = false;
 	if (IsUsedNativeHandle())
@@ -48,8 +49,8 @@ VkImageMemoryBarrier2 TextureStateTransition::Build() const
     const VkImageMemoryBarrier2 barrier{
         .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
         .pNext = nullptr,
-        .srcStageMask = srcAccessPattern.PipelineStage,
-        .srcAccessMask = srcAccessPattern.Access,
+        .srcStageMask = srcAccessPattern.PipelineStage | aliasingSrcStageMask,
+        .srcAccessMask = srcAccessPattern.Access | aliasingSrcAccessMask,
         .dstStageMask = dstAccessPattern.PipelineStage,
         .dstAccessMask = dstAccessPattern.Access,
         .oldLayout = srcAccessPattern.ImageLayout,
@@ -35,6 +35,13 @@ public:
     void SetDestinationQueueType(const EQueueType dstQueueType) { this->dstQueueType = dstQueueType; }
     void SetSubresourceRange(const VkImageSubresourceRange range) { this->subresourceRange = range; }
 
+    /** Memory was occupied by other resource; wait on its last access. Contents are discarded, so source state stays undefined. */
+    void SetAliasingSource(const VkPipelineStageFlags2 stageMask, const VkAccessFlags2 accessMask)
+    {
+        this->aliasingSrcStageMask  = stageMask;
+        this->aliasingSrcAccessMask = accessMask;
+    }
+
     VkImageMemoryBarrier2 Build() const;
 
 private:
@@ -46,5 +53,7 @@ private:
     std::optional<EQueueType> srcQueueType = std::nullopt;
     std::optional<EQueueType> dstQueueType = std::nullopt;
     std::optional<VkImageSubresourceRange> subresourceRange = std::nullopt;
+    VkPipelineStageFlags2 aliasingSrcStageMask = VK_PIPELINE_STAGE_2_NONE;
+    VkAccessFlags2 aliasingSrcAccessMask = VK_ACCESS_2_NONE;
 };
 } // namespace sy::vk
@@ -13,10 +13,10 @@ TextureView::TextureView(const std::string_view name,
                          const VkImageSubresourceRange subresourceRange) :
     VulkanWrapper<VkImageView>(name, vulkanContext, VK_OBJECT_TYPE_IMAGE_VIEW),
     viewType(viewType),
-    subresourceRange(subresourceRange)
+    subresourceRange(subresourceRange),
+    format(texture.GetFormat())
 {
     /** @todo should custom format for texture view? */
-    const auto format = texture.GetFormat();
     const VkImageViewCreateInfo viewCreateInfo{
         .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
         .pNext = nullptr,
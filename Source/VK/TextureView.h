@@ -14,8 +14,11 @@ public:
 
     ~TextureView() override = default;
 
+    [[nodiscard]] auto GetFormat() const { return format; }
+
 private:
     const VkImageViewType viewType;
     const VkImageSubresourceRange subresourceRange;
+    const VkFormat format;
 };
 } // namespace sy::vk
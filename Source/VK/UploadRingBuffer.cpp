@@ -0,0 +1,72 @@
+#include <PCH.h>
+#include <VK/UploadRingBuffer.h>
+#include <VK/Buffer.h>
+#include <VK/BufferBuilder.h>
+#include <VK/DescriptorAllocator.h>
+#include <VK/FrameTracker.h>
+#include <VK/VulkanContext.h>
+#include <VK/VulkanRHI.h>
+
+namespace sy::vk
+{
+UploadRingBuffer::UploadRingBuffer(VulkanContext& vulkanContext, const FrameTracker& frameTracker) :
+    vulkanContext(vulkanContext),
+    frameTracker(frameTracker),
+    /** Each partition begins at offset of its descriptor, so it has to be aligned to min storage buffer offset alignment. */
+    partitionSize(vulkanContext.GetRHI().PadStorageBufferSize(UploadRingBufferPartitionSize)),
+    allocator(partitionSize)
+{
+    /** Passes write through the span directly, so there is no point to flush; host coherent memory is required instead. */
+    buffer = BufferBuilder::StorageBufferTemplate(vulkanContext)
+                 .SetName("Upload Ring Buffer")
+                 .SetSize(partitionSize * NumMaxInFlightFrames)
+                 .SetMemoryProperty(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+                 .Build();
+    mappedData = buffer->GetMappedSpan().data();
+    SY_ASSERT(mappedData != nullptr, "Upload ring buffer must be persistently mapped.");
+
+    auto& descriptorAllocator = vulkanContext.GetDescriptorAllocator();
+    for (size_t idx = 0; idx < NumMaxInFlightFrames; ++idx)
+    {
+        descriptors[idx] = descriptorAllocator.RequestDescriptor(*buffer, idx * partitionSize, partitionSize);
+        SY_ASSERT(descriptors[idx], "Failed to allocate descriptor of upload ring buffer partition {}.", idx);
+    }
+}
+
+UploadRingBuffer::~UploadRingBuffer()
+{
+    spdlog::info("Upload ring buffer: {} bytes per frame, high-water mark {} bytes, {} failed allocations.",
+                 partitionSize, allocator.GetHighWaterMark(), allocator.GetNumFailedAllocations());
+}
+
+void UploadRingBuffer::BeginFrame()
+{
+    partitionIndex = frameTracker.GetFrameIndex();
+    allocator.Reset();
+}
+
+UploadRingBuffer::Allocation UploadRingBuffer::Allocate(const size_t size, const size_t alignment)
+{
+    const std::optional<size_t> offset = allocator.Allocate(size, alignment);
+    if (!offset)
+    {
+        spdlog::error("Upload ring buffer is exhausted; {} bytes requested, {} of {} bytes in use.", size, allocator.GetUsedBytes(), partitionSize);
+        return {};
+    }
+
+    return Allocation{
+        .Offset          = *offset,
+        .Data            = std::span<std::byte>{mappedData + partitionIndex * partitionSize + *offset, size},
+        .DescriptorIndex = static_cast<uint32_t>(descriptors[partitionIndex]->Offset)};
+}
+
+UploadRingBuffer::Statistics UploadRingBuffer::GetStatistics() const
+{
+    return Statistics{
+        .PartitionSize        = partitionSize,
+        .UsedBytes            = allocator.GetUsedBytes(),
+        .HighWaterMark        = allocator.GetHighWaterMark(),
+        .NumAllocations       = allocator.GetNumAllocations(),
+        .NumFailedAllocations = allocator.GetNumFailedAllocations()};
+}
+} // namespace sy::vk
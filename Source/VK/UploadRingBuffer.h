@@ -0,0 +1,74 @@
+#pragma once
+#include <PCH.h>
+#include <Core/LinearAllocator.h>
+
+namespace sy::vk
+{
+class VulkanContext;
+class FrameTracker;
+class Buffer;
+/**
+ * Per-frame constant upload ring shared by every passes.
+ * Single persistently mapped storage buffer is partitioned by NumMaxInFlightFrames, and each partition has its own descriptor.
+ * Partition of current frame is recycled at BeginFrame; data uploaded at frame is only valid until the frame is in flight again.
+ */
+class UploadRingBuffer final : public NonCopyable
+{
+public:
+    struct Allocation
+    {
+        /** Offset from beginning of the partition, which is also beginning of the descriptor range. */
+        size_t               Offset = 0;
+        std::span<std::byte> Data;
+        uint32_t             DescriptorIndex = 0;
+
+        [[nodiscard]] bool IsValid() const { return !Data.empty(); }
+    };
+
+    struct Statistics
+    {
+        size_t PartitionSize        = 0;
+        size_t UsedBytes            = 0;
+        size_t HighWaterMark        = 0;
+        size_t NumAllocations       = 0;
+        size_t NumFailedAllocations = 0;
+    };
+
+public:
+    UploadRingBuffer(VulkanContext& vulkanContext, const FrameTracker& frameTracker);
+    ~UploadRingBuffer() override;
+
+    /** Must be called after waiting in-flight frame which previously used the partition. */
+    void BeginFrame();
+
+    /** Thread-safe. Returns invalid allocation if partition of the frame is exhausted. */
+    [[nodiscard]] Allocation Allocate(size_t size, size_t alignment);
+
+    /** Aligned to sizeof(T), so Offset / sizeof(T) is index of the data in T[] of shader. */
+    template <typename T>
+    [[nodiscard]] Allocation Upload(const T& data)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const Allocation allocation = Allocate(sizeof(T), sizeof(T));
+        if (allocation.IsValid())
+        {
+            std::memcpy(allocation.Data.data(), &data, sizeof(T));
+        }
+
+        return allocation;
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const;
+
+private:
+    VulkanContext&          vulkanContext;
+    const FrameTracker&     frameTracker;
+    const size_t            partitionSize;
+    std::unique_ptr<Buffer> buffer;
+    std::byte*              mappedData = nullptr;
+
+    std::array<Descriptor, NumMaxInFlightFrames> descriptors;
+    size_t                                       partitionIndex = 0;
+    LinearAllocator                              allocator;
+};
+} // namespace sy::vk
@@ -3,6 +3,13 @@
 
 namespace sy::vk
 {
+/** Initial number of slots of each bindless binding. */
 constexpr uint32_t MaxBindlessResourcesPerDescriptor = 2048;
+/** Upper bound of each bindless binding regardless of device limits, since descriptor pool reserves every descriptors declared by layout. */
+constexpr uint32_t MaxBindlessDescriptorsPerBinding = 1 << 16;
 constexpr size_t NumMaxInFlightFrames = 2;
+/** Bytes of upload ring buffer reserved for each in-flight frame. */
+constexpr size_t UploadRingBufferPartitionSize = 4 * 1024 * 1024;
+/** Two timestamps(begin/end) per render graph node. */
+constexpr uint32_t NumMaxTimestampQueriesPerFrame = 1024;
 }
\ No newline at end of file
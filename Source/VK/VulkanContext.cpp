@@ -6,6 +6,7 @@
 #include <VK/FrameTracker.h>
 #include <VK/LayoutCache.h>
 #include <VK/Swapchain.h>
+#include <VK/UploadRingBuffer.h>
 
 namespace sy::vk
 {
@@ -33,6 +34,7 @@ void VulkanContext::Startup()
     pipelineLayoutCache->Startup();
 
     swapchain = std::make_unique<Swapchain>(window, *this);
+    uploadRingBuffer = std::make_unique<UploadRingBuffer>(*this, *frameTracker);
 }
 
 void VulkanContext::Shutdown()
@@ -40,12 +42,13 @@ void VulkanContext::Shutdown()
     spdlog::info("Shutdown Vulkan Context.");
     vulkanRHI->WaitForDeviceIdle();
 
+    uploadRingBuffer.reset();
     pipelineLayoutCache->Shutdown();
     descriptorAllocator->Shutdown();
     cmdPoolAllocator->Shutdown();
     frameTracker->Shutdown();
     swapchain.reset();
-    FlushDeferredDeallocations();
+    FlushDeferredDeallocations(true);
     vulkanRHI->Shutdown();
 }
 
@@ -94,6 +97,11 @@ Swapchain& VulkanContext::GetSwapchain()
     return *swapchain;
 }
 
+UploadRingBuffer& VulkanContext::GetUploadRingBuffer()
+{
+    return *uploadRingBuffer;
+}
+
 void VulkanContext::BeginFrame()
 {
     frameTracker->BeginFrame();
@@ -109,6 +117,7 @@ void VulkanContext::BeginRender()
     FlushDeferredDeallocations();
     cmdPoolAllocator->BeginFrame();
     descriptorAllocator->BeginFrame();
+    uploadRingBuffer->BeginFrame();
 }
 
 void VulkanContext::EndRender()
@@ -119,16 +128,24 @@ void VulkanContext::EndRender()
 
 void VulkanContext::EnqueueDeferredDeallocation(VulkanObjectDeleter deleter)
 {
-    this->deferredObjectDeallocations.emplace_back(std::move(deleter));
+    this->deferredObjectDeallocations.emplace_back(DeferredDeallocation{
+        .RetiredFrame = frameTracker->GetFrameCounter(),
+        .Deleter      = std::move(deleter)});
 }
 
-void VulkanContext::FlushDeferredDeallocations()
+void VulkanContext::FlushDeferredDeallocations(const bool bFlushAll)
 {
-    for (auto& deleter : deferredObjectDeallocations)
+    /**
+     * Object retired at frame N may be used by command buffers of frame N itself, which are completed
+     * once in-flight frame of N + NumMaxInFlightFrames has been waited before BeginRender.
+     */
+    const size_t currentFrame = frameTracker->GetFrameCounter();
+    while (!deferredObjectDeallocations.empty() &&
+           (bFlushAll || deferredObjectDeallocations.front().RetiredFrame + NumMaxInFlightFrames <= currentFrame))
     {
-        deleter(*vulkanRHI);
+        deferredObjectDeallocations.front().Deleter(*vulkanRHI);
+        deferredObjectDeallocations.pop_front();
     }
-    deferredObjectDeallocations.clear();
 }
 
 
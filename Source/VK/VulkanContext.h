@@ -14,6 +14,7 @@ class DescriptorAllocator;
 class FrameTracker;
 class PipelineLayoutCache;
 class Swapchain;
+class UploadRingBuffer;
 class VulkanContext : public Subsystem
 {
 public:
@@ -32,6 +33,7 @@ public:
     [[nodiscard]] DescriptorAllocator& GetDescriptorAllocator();
 	[[nodiscard]] PipelineLayoutCache& GetPipelineLayoutCache();
     [[nodiscard]] Swapchain& GetSwapchain();
+    [[nodiscard]] UploadRingBuffer& GetUploadRingBuffer();
 
     void BeginFrame();
     void EndFrame();
@@ -39,10 +41,18 @@ public:
     void BeginRender();
     void EndRender();
 
+    /** Deleter is called once every in-flight frames which could use the object are completed, NumMaxInFlightFrames frames later. */
     void EnqueueDeferredDeallocation(VulkanObjectDeleter deleter);
 
 private:
-    void FlushDeferredDeallocations();
+    struct DeferredDeallocation
+    {
+        size_t              RetiredFrame = 0;
+        VulkanObjectDeleter Deleter;
+    };
+
+    /** Device must be idle to flush every deallocations regardless of their frame. */
+    void FlushDeferredDeallocations(bool bFlushAll = false);
 
 private:
     const window::Window& window;
@@ -51,8 +61,10 @@ private:
     std::unique_ptr<CommandPoolAllocator> cmdPoolAllocator;
     std::unique_ptr<DescriptorAllocator> descriptorAllocator;
     std::unique_ptr<PipelineLayoutCache> pipelineLayoutCache;
-    std::vector<VulkanObjectDeleter> deferredObjectDeallocations;
+    /** Ordered by retired frame. */
+    std::deque<DeferredDeallocation> deferredObjectDeallocations;
 
     std::unique_ptr<Swapchain> swapchain;
+    std::unique_ptr<UploadRingBuffer> uploadRingBuffer;
 };
 } // namespace sy::vk
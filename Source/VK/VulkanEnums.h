@@ -30,4 +30,11 @@ enum class EDescriptorType : uint8_t
     StorageBufferDynamic,
     EnumMax
 };
+
+/** How bindless descriptors of DescriptorAllocator are stored. */
+enum class EDescriptorBackend
+{
+    DescriptorSet,
+    DescriptorBuffer
+};
 }
\ No newline at end of file
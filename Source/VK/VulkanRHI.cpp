@@ -57,11 +57,42 @@ void VulkanRHI::Startup()
                                  .add_required_extension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME)
                                  .add_required_extension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME)
                                  .add_required_extension(VK_KHR_MAINTENANCE1_EXTENSION_NAME)
+                                 .add_desired_extension(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME)
                                  .select()
                                  .value();
 
     physicalDevice = vkbPhysicalDevice.physical_device;
     gpuProperties = vkbPhysicalDevice.properties;
+
+    /** Descriptor buffer is optional; DescriptorAllocator falls back to descriptor set if it is not supported. */
+    uint32_t numExtensions = 0;
+    vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &numExtensions, nullptr);
+    std::vector<VkExtensionProperties> extensions(numExtensions);
+    vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &numExtensions, extensions.data());
+    const bool bHasDescriptorBufferExtension = std::any_of(extensions.cbegin(), extensions.cend(),
+                                                           [](const VkExtensionProperties& extension) {
+                                                               return std::string_view{extension.extensionName} == VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME;
+                                                           });
+    if (bHasDescriptorBufferExtension)
+    {
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT supportedDescriptorBufferFeatures{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+            .pNext = nullptr};
+        VkPhysicalDeviceBufferDeviceAddressFeatures supportedBufferDeviceAddressFeatures{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES,
+            .pNext = &supportedDescriptorBufferFeatures};
+        VkPhysicalDeviceFeatures2 supportedFeatures{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+            .pNext = &supportedBufferDeviceAddressFeatures};
+        vkGetPhysicalDeviceFeatures2(physicalDevice, &supportedFeatures);
+        bIsDescriptorBufferSupported = supportedDescriptorBufferFeatures.descriptorBuffer == VK_TRUE && supportedBufferDeviceAddressFeatures.bufferDeviceAddress == VK_TRUE;
+    }
+
+    descriptorBufferProperties = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT, .pNext = nullptr};
+    descriptorIndexingProperties = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES, .pNext = bIsDescriptorBufferSupported ? &descriptorBufferProperties : nullptr};
+    VkPhysicalDeviceProperties2 gpuProperties2{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &descriptorIndexingProperties};
+    vkGetPhysicalDeviceProperties2(physicalDevice, &gpuProperties2);
+    spdlog::info("Descriptor buffer: {}", bIsDescriptorBufferSupported ? "Supported" : "Not supported");
     gpuName = gpuProperties.deviceName;
     spdlog::trace("\n----------- GPU Properties -----------\n* Device Name: {}\n* GPU Vendor ID: {}\n* API Version: {}\n* Driver Version: {}\n* Device ID: {}\n* Max Bound Descriptor Sets: {}\n* Min Uniform Buffer Offset Alignment: {}\n* Min Storage Buffer Offset Alignment: {}\n* Max Frame Buffer Extent: {}x{}\n* Max Memory Allocation Count: {}\n* Max Sampler Allocation Count: {}\n",
                   gpuName,
@@ -90,6 +121,7 @@ void VulkanRHI::Startup()
         .descriptorBindingSampledImageUpdateAfterBind = VK_TRUE,
         .descriptorBindingStorageImageUpdateAfterBind = VK_TRUE,
         .descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE,
+        .descriptorBindingUpdateUnusedWhilePending = VK_TRUE,
         .descriptorBindingPartiallyBound = VK_TRUE,
         .descriptorBindingVariableDescriptorCount = VK_TRUE,
         .runtimeDescriptorArray = VK_TRUE,
@@ -105,12 +137,35 @@ void VulkanRHI::Startup()
         .pNext = nullptr,
         .timelineSemaphore = true};
 
-    auto vkbDeviceRes =
-        deviceBuilder.add_pNext(&dynamicRenderingFeatures)
-            .add_pNext(&descriptorIndexingFeatures)
-            .add_pNext(&synchronization2Features)
-            .add_pNext(&timelineSemaphoreFeatures)
-            .build();
+    /** Timestamp queries of in-flight frame are reset from host before reused. */
+    VkPhysicalDeviceHostQueryResetFeatures hostQueryResetFeatures{
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES,
+        .pNext = nullptr,
+        .hostQueryReset = true};
+
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptorBufferFeatures{
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+        .pNext = nullptr,
+        .descriptorBuffer = VK_TRUE};
+
+    /** Buffer descriptors of descriptor buffer are written with device address of the buffer. */
+    VkPhysicalDeviceBufferDeviceAddressFeatures bufferDeviceAddressFeatures{
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES,
+        .pNext = nullptr,
+        .bufferDeviceAddress = VK_TRUE};
+
+    deviceBuilder.add_pNext(&dynamicRenderingFeatures)
+        .add_pNext(&descriptorIndexingFeatures)
+        .add_pNext(&synchronization2Features)
+        .add_pNext(&timelineSemaphoreFeatures)
+        .add_pNext(&hostQueryResetFeatures);
+    if (bIsDescriptorBufferSupported)
+    {
+        deviceBuilder.add_pNext(&descriptorBufferFeatures)
+            .add_pNext(&bufferDeviceAddressFeatures);
+    }
+
+    auto vkbDeviceRes = deviceBuilder.build();
     SY_ASSERT(vkbDeviceRes.has_value(), "Failed to create device using GPU {}.", gpuName);
     auto& vkbDevice = vkbDeviceRes.value();
     device = vkbDevice.device;
@@ -121,6 +176,7 @@ void VulkanRHI::Startup()
         .vkGetDeviceProcAddr = vkGetDeviceProcAddr};
 
     const VmaAllocatorCreateInfo allocatorInfo{
+        .flags = bIsDescriptorBufferSupported ? VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT : 0u,
         .physicalDevice = physicalDevice,
         .device = device,
         .pVulkanFunctions = &vkFunctions,
@@ -167,6 +223,12 @@ uint32_t VulkanRHI::GetQueueFamilyIndex(const EQueueType queueType) const
     return graphicsQueueFamilyIdx;
 }
 
+bool VulkanRHI::IsTimestampSupported(const EQueueType queueType) const
+{
+    const uint32_t queueFamilyIdx = GetQueueFamilyIndex(queueType);
+    return queueFamilyIdx < queueFamilyProperties.size() && queueFamilyProperties[queueFamilyIdx].timestampValidBits > 0;
+}
+
 VkQueue VulkanRHI::GetQueue(const EQueueType queueType) const
 {
     switch (queueType)
@@ -218,6 +280,11 @@ void VulkanRHI::SubmitSync(const EQueueType queueType, const CRefSpan<CommandBuf
                            .deviceIndex = 0};
                    });
 
+    Submit(queueType, cmdBuffers, waitSemaphoreSubmitInfos, signalSemaphoreSubmitInfos);
+}
+
+void VulkanRHI::Submit(const EQueueType queueType, const CRefSpan<CommandBuffer> cmdBuffers, const std::span<const VkSemaphoreSubmitInfo> waitSemaphoreInfos, const std::span<const VkSemaphoreSubmitInfo> signalSemaphoreInfos) const
+{
     std::vector<VkCommandBufferSubmitInfo> cmdBufferSubmitInfos;
     cmdBufferSubmitInfos.resize(cmdBuffers.size());
     std::transform(cmdBuffers.begin(), cmdBuffers.end(),
@@ -234,12 +301,12 @@ void VulkanRHI::SubmitSync(const EQueueType queueType, const CRefSpan<CommandBuf
     const VkSubmitInfo2 submitInfo{
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
         .pNext = nullptr,
-        .waitSemaphoreInfoCount = static_cast<uint32_t>(waitSemaphoreSubmitInfos.size()),
-        .pWaitSemaphoreInfos = waitSemaphoreSubmitInfos.data(),
+        .waitSemaphoreInfoCount = static_cast<uint32_t>(waitSemaphoreInfos.size()),
+        .pWaitSemaphoreInfos = waitSemaphoreInfos.data(),
         .commandBufferInfoCount =  static_cast<uint32_t>(cmdBufferSubmitInfos.size()),
         .pCommandBufferInfos = cmdBufferSubmitInfos.data(),
-        .signalSemaphoreInfoCount =  static_cast<uint32_t>(signalSemaphoreSubmitInfos.size()),
-        .pSignalSemaphoreInfos = signalSemaphoreSubmitInfos.data()};
+        .signalSemaphoreInfoCount =  static_cast<uint32_t>(signalSemaphoreInfos.size()),
+        .pSignalSemaphoreInfos = signalSemaphoreInfos.data()};
 
     vkQueueSubmit2(GetQueue(queueType), 1, &submitInfo, VK_NULL_HANDLE);
 }
@@ -375,6 +442,11 @@ void VulkanRHI::InitQueues(const vkb::Device& vkbDevice)
     presentQueue = presentQueueRes.value();
     presentQueueFamilyIdx = vkbDevice.get_queue_index(vkb::QueueType::present).value();
     spdlog::trace("Present Queue successfully acquired. Family Index: {}.", presentQueueFamilyIdx);
+
+    uint32_t numQueueFamilies = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &numQueueFamilies, nullptr);
+    queueFamilyProperties.resize(numQueueFamilies);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &numQueueFamilies, queueFamilyProperties.data());
 }
 
 bool VulkanRHI::IsFormatSupportFeatures(VkFormat format, VkFormatFeatureFlagBits2 featureFlag, bool bIsOptimalTiling /*= true*/) const
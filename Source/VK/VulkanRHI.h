@@ -51,6 +51,8 @@ public:
     }
 
 	void SubmitSync(EQueueType queueType, CRefSpan<CommandBuffer> cmdBuffers, CRefSpan<Semaphore> waitSemaphores, VkPipelineStageFlags2 waitAt, RefSpan<Semaphore> signalSemaphores, VkPipelineStageFlags2 signalAt) const;
+    /** Submit with explicit semaphore values. (ex. waiting specific point of timeline semaphore) */
+    void Submit(EQueueType queueType, CRefSpan<CommandBuffer> cmdBuffers, std::span<const VkSemaphoreSubmitInfo> waitSemaphoreInfos, std::span<const VkSemaphoreSubmitInfo> signalSemaphoreInfos) const;
     void SubmitImmediateTo(const CommandBuffer& cmdBuffer) const;
 
     void Present(const VkPresentInfoKHR& presentInfo) const;
@@ -63,6 +65,37 @@ public:
     [[nodiscard]] size_t PadUniformBufferSize(size_t allocSize) const;
     [[nodiscard]] size_t PadStorageBufferSize(size_t allocSize) const;
 
+    /** Nanoseconds per timestamp tick. */
+    [[nodiscard]] float GetTimestampPeriod() const
+    {
+        return gpuProperties.limits.timestampPeriod;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceDescriptorIndexingProperties& GetDescriptorIndexingProperties() const
+    {
+        return descriptorIndexingProperties;
+    }
+
+    /** VK_EXT_descriptor_buffer and buffer device address are enabled only if both are supported. */
+    [[nodiscard]] bool IsDescriptorBufferSupported() const
+    {
+        return bIsDescriptorBufferSupported;
+    }
+
+    /** Valid only if descriptor buffer is supported. */
+    [[nodiscard]] const VkPhysicalDeviceDescriptorBufferPropertiesEXT& GetDescriptorBufferProperties() const
+    {
+        return descriptorBufferProperties;
+    }
+
+    [[nodiscard]] const VkPhysicalDeviceLimits& GetLimits() const
+    {
+        return gpuProperties.limits;
+    }
+
+    /** Queue family which reports zero valid bits can not write timestamp. */
+    [[nodiscard]] bool IsTimestampSupported(EQueueType queueType) const;
+
     [[nodiscard]] void* Map(const Buffer& buffer) const;
     void Unmap(const Buffer& buffer) const;
     [[nodiscard]] void* Map(const Texture& texture) const;
@@ -89,6 +122,9 @@ private:
     VkSurfaceKHR surface;
     VkPhysicalDevice physicalDevice;
     VkPhysicalDeviceProperties gpuProperties;
+    VkPhysicalDeviceDescriptorIndexingProperties descriptorIndexingProperties;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptorBufferProperties;
+    bool bIsDescriptorBufferSupported = false;
     VkDevice device;
     std::string gpuName;
 
@@ -103,5 +139,6 @@ private:
     uint32_t computeQueueFamilyIdx;
     uint32_t transferQueueFamilyIdx;
     uint32_t presentQueueFamilyIdx;
+    std::vector<VkQueueFamilyProperties> queueFamilyProperties;
 };
 } // namespace sy::vk
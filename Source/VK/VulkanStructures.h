@@ -7,8 +7,33 @@ class VulkanRHI;
 
 using Descriptor = OffsetSlotPtr;
 class CommandBuffer;
-using ManagedCommandBuffer = std::unique_ptr<CommandBuffer, std::function<void(CommandBuffer*)>>;
-using VulkanObjectDeleter  = std::function<void(const VulkanRHI&)>;
+using VulkanObjectDeleter = std::function<void(const VulkanRHI&)>;
+
+/**
+ * Non-owning handle of command buffer which is owned by command pool.
+ * Command buffer is recycled when the pool is reset at the begin of the in-flight frame, so handle must not be kept across that point.
+ */
+class ManagedCommandBuffer
+{
+public:
+    ManagedCommandBuffer() = default;
+    ManagedCommandBuffer(std::nullptr_t)
+    {
+    }
+
+    explicit ManagedCommandBuffer(CommandBuffer& cmdBuffer) :
+        cmdBuffer(&cmdBuffer)
+    {
+    }
+
+    [[nodiscard]] CommandBuffer* get() const { return cmdBuffer; }
+    [[nodiscard]] CommandBuffer* operator->() const { return cmdBuffer; }
+    [[nodiscard]] CommandBuffer& operator*() const { return *cmdBuffer; }
+    [[nodiscard]] explicit operator bool() const { return cmdBuffer != nullptr; }
+
+private:
+    CommandBuffer* cmdBuffer = nullptr;
+};
 
 struct TextureSubResource
 {
@@ -10,7 +10,7 @@ class VulkanContext;
 /**
 	 *	Usage: [=](){ vkDestroy...(handle); ...vmaDestroy...(allocation); }
 	 *  Capture native handle and allocation as value. It design to enqueue	deleter to vulkan context deallocation queue when wrapper object destructed.
-	 *  Then, it'll be deallocate vulkan object(or vulkan memory allocator allocation) as automatically at next begin frame.
+	 *  Then, it'll be deallocate vulkan object(or vulkan memory allocator allocation) as automatically once in-flight frames which could use it are completed.
 	 */
 template <typename VulkanHandleType>
 class VulkanWrapper : public NamedType, public NonCopyable
@@ -1,6 +1,7 @@
 #include <PCH.h>
 #include <Application/Context.h>
 #include <Core/CommandLineParser.h>
+#include <Render/RenderGraphSchedule.h>
 #include <Window/WindowBuilder.h>
 #include <catch.hpp>
 
@@ -28,6 +29,11 @@ int main(int argc, char** argv)
 #else
     using namespace sy;
     const auto   cmdLineParser = std::make_unique<CommandLineParser>(argc, argv);
+    if (!cmdLineParser->GetScheduleSimulationPath().empty())
+    {
+        return render::RenderGraphSchedule::RunSimulationTool(cmdLineParser->GetScheduleSimulationPath(), cmdLineParser->GetNodeCostsPath()) ? 0 : 1;
+    }
+
     app::Context context{*cmdLineParser, window::WindowBuilder{}};
 
     context.Startup();